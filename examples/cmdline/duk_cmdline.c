@@ -52,6 +52,9 @@
 #include <sys/syscall.h>
 #endif
 #endif
+#if defined(DUK_CMDLINE_GC_FREE_THREAD)
+#include <pthread.h>
+#endif
 
 #include <stdio.h>
 #include <stdlib.h>
@@ -134,6 +137,8 @@ static int no_auto_complete = 0;
 #endif
 
 int duk_cmdline_stack_check(void);
+void duk_cmdline_gc_free_batch(void *udata, void **ptrs, duk_size_t count);
+void duk_cmdline_gc_free_wait(void);
 
 /*
  *  Misc helpers
@@ -303,6 +308,9 @@ static duk_ret_t wrapped_compile_execute(duk_context *ctx, void *udata) {
 	duk_push_global_object(ctx);  /* 'this' binding */
 	duk_call_method(ctx, 0);
 
+	/* Run Promise jobs queued by the script (if any) to completion. */
+	(void) duk_run_jobs(ctx, -1);
+
 #if defined(DUK_CMDLINE_LOWMEM)
 	lowmem_clear_exec_timeout();
 #endif
@@ -1337,6 +1345,7 @@ static void destroy_duktape_heap(duk_context *ctx, int alloc_provider) {
 	if (ctx) {
 		duk_destroy_heap(ctx);
 	}
+	duk_cmdline_gc_free_wait();
 
 #if defined(DUK_CMDLINE_LOWMEM)
 	if (alloc_provider == ALLOC_LOWMEM) {
@@ -1925,3 +1934,118 @@ int duk_cmdline_stack_check(void) {
 	return 0;
 }
 #endif
+
+/* Example of how DUK_USE_GC_FREE_BATCH() can hand memory released by
+ * mark-and-sweep over to a worker thread.  The example assumes the default
+ * allocator (malloc/free), so it can't be used with the example allocators
+ * selected using command line options.  Without DUK_CMDLINE_GC_FREE_THREAD
+ * batches are freed synchronously.
+ */
+static void duk__gc_free_batch_sync(void **ptrs, duk_size_t count) {
+	duk_size_t i;
+
+	for (i = 0; i < count; i++) {
+		free(ptrs[i]);
+	}
+	free((void *) ptrs);
+}
+
+#if defined(DUK_CMDLINE_GC_FREE_THREAD)
+typedef struct duk__gc_free_job duk__gc_free_job;
+struct duk__gc_free_job {
+	duk__gc_free_job *next;
+	void **ptrs;
+	duk_size_t count;
+};
+
+static pthread_mutex_t duk__gc_free_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t duk__gc_free_cond = PTHREAD_COND_INITIALIZER;
+static pthread_cond_t duk__gc_free_idle_cond = PTHREAD_COND_INITIALIZER;
+static duk__gc_free_job *duk__gc_free_head = NULL;
+static duk__gc_free_job *duk__gc_free_tail = NULL;
+static int duk__gc_free_started = 0;
+static int duk__gc_free_busy = 0;
+
+static void *duk__gc_free_thread(void *arg) {
+	duk__gc_free_job *job;
+
+	(void) arg;
+
+	pthread_mutex_lock(&duk__gc_free_mutex);
+	for (;;) {
+		while (duk__gc_free_head == NULL) {
+			pthread_cond_wait(&duk__gc_free_cond, &duk__gc_free_mutex);
+		}
+		job = duk__gc_free_head;
+		duk__gc_free_head = job->next;
+		if (duk__gc_free_head == NULL) {
+			duk__gc_free_tail = NULL;
+		}
+		duk__gc_free_busy = 1;
+		pthread_mutex_unlock(&duk__gc_free_mutex);
+
+		duk__gc_free_batch_sync(job->ptrs, job->count);
+		free((void *) job);
+
+		pthread_mutex_lock(&duk__gc_free_mutex);
+		duk__gc_free_busy = 0;
+		if (duk__gc_free_head == NULL) {
+			pthread_cond_broadcast(&duk__gc_free_idle_cond);
+		}
+	}
+	return NULL;
+}
+
+void duk_cmdline_gc_free_batch(void *udata, void **ptrs, duk_size_t count) {
+	duk__gc_free_job *job;
+	pthread_t thread;
+
+	(void) udata;
+
+	job = (duk__gc_free_job *) malloc(sizeof(duk__gc_free_job));
+	if (job == NULL) {
+		duk__gc_free_batch_sync(ptrs, count);
+		return;
+	}
+	job->next = NULL;
+	job->ptrs = ptrs;
+	job->count = count;
+
+	pthread_mutex_lock(&duk__gc_free_mutex);
+	if (!duk__gc_free_started) {
+		if (pthread_create(&thread, NULL, duk__gc_free_thread, NULL) != 0) {
+			pthread_mutex_unlock(&duk__gc_free_mutex);
+			free((void *) job);
+			duk__gc_free_batch_sync(ptrs, count);
+			return;
+		}
+		(void) pthread_detach(thread);
+		duk__gc_free_started = 1;
+	}
+	if (duk__gc_free_tail != NULL) {
+		duk__gc_free_tail->next = job;
+	} else {
+		duk__gc_free_head = job;
+	}
+	duk__gc_free_tail = job;
+	pthread_cond_signal(&duk__gc_free_cond);
+	pthread_mutex_unlock(&duk__gc_free_mutex);
+}
+
+/* Wait until all pending batches have been freed. */
+void duk_cmdline_gc_free_wait(void) {
+	pthread_mutex_lock(&duk__gc_free_mutex);
+	while (duk__gc_free_head != NULL || duk__gc_free_busy) {
+		pthread_cond_wait(&duk__gc_free_idle_cond, &duk__gc_free_mutex);
+	}
+	pthread_mutex_unlock(&duk__gc_free_mutex);
+}
+#else
+void duk_cmdline_gc_free_batch(void *udata, void **ptrs, duk_size_t count) {
+	(void) udata;
+	duk__gc_free_batch_sync(ptrs, count);
+}
+
+void duk_cmdline_gc_free_wait(void) {
+}
+#endif
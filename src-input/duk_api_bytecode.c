@@ -284,7 +284,7 @@ static duk_uint8_t *duk__dump_func(duk_hthread *thr, duk_hcompfunc *func, duk_bu
 	DUK_RAW_WRITEINC_U32_BE(p, 0);
 	DUK_RAW_WRITEINC_U32_BE(p, 0);
 #endif
-	tmp32 = DUK_HEAPHDR_GET_FLAGS((duk_heaphdr *) func); /* masks flags, only duk_hobject flags */
+	tmp32 = DUK_HEAPHDR_GET_FLAGS((duk_heaphdr *) func) & DUK_HEAPHDR_FLAGS_USER_MASK; /* only duk_hobject flags */
 	tmp32 &= ~(DUK_HOBJECT_FLAG_HAVE_FINALIZER); /* finalizer flag is lost */
 	DUK_RAW_WRITEINC_U32_BE(p, tmp32);
 
@@ -455,7 +455,7 @@ static const duk_uint8_t *duk__load_func(duk_hthread *thr, const duk_uint8_t *p,
 
 	/* duk_hcompfunc flags; quite version specific */
 	tmp32 = DUK_RAW_READINC_U32_BE(p);
-	DUK_HEAPHDR_SET_FLAGS((duk_heaphdr *) h_fun, tmp32); /* masks flags to only change duk_hobject flags */
+	DUK_HEAPHDR_SET_FLAGS((duk_heaphdr *) h_fun, tmp32 & DUK_HEAPHDR_FLAGS_USER_MASK); /* only duk_hobject flags */
 
 	/* standard prototype (no need to set here, already set) */
 	DUK_ASSERT(duk_hobject_get_proto_raw(thr->heap, (duk_hobject *) h_fun) == thr->builtins[DUK_BIDX_FUNCTION_PROTOTYPE]);
@@ -335,6 +335,9 @@ DUK_EXTERNAL void duk_new(duk_hthread *thr, duk_idx_t nargs) {
 	DUK_ASSERT(duk_is_valid_index(thr, idx_func));
 
 	duk_push_object(thr); /* default instance; internal proto updated by call handling */
+#if defined(DUK_USE_HOBJECT_SHAPES)
+	duk_hobject_init_shape(thr, duk_known_hobject(thr, -1));
+#endif
 	duk_insert(thr, idx_func + 1);
 
 	duk_handle_call_unprotected(thr, idx_func, DUK_CALL_FLAG_CONSTRUCT);
@@ -486,6 +489,32 @@ DUK_EXTERNAL void duk_set_magic(duk_hthread *thr, duk_idx_t idx, duk_int_t magic
 	nf->magic = (duk_int16_t) magic;
 }
 
+/*
+ *  Promise job queue
+ */
+
+DUK_EXTERNAL duk_bool_t duk_run_jobs(duk_hthread *thr, duk_int_t max_jobs) {
+	DUK_ASSERT_API_ENTRY(thr);
+
+#if defined(DUK_USE_PROMISE_BUILTIN)
+	/* Jobs may queue more jobs; a negative limit runs until the queue
+	 * is empty.
+	 */
+	while (max_jobs != 0) {
+		if (!duk_promise_run_job(thr)) {
+			return 0;
+		}
+		if (max_jobs > 0) {
+			max_jobs--;
+		}
+	}
+	return (thr->heap->job_head != NULL);
+#else
+	DUK_UNREF(max_jobs);
+	return 0;
+#endif
+}
+
 /*
  *  Misc helpers
  */
@@ -259,3 +259,67 @@ DUK_EXTERNAL void duk_debugger_pause(duk_hthread *thr) {
 }
 
 #endif /* DUK_USE_DEBUGGER_SUPPORT */
+
+#if defined(DUK_USE_PROFILER)
+
+DUK_EXTERNAL void duk_profiler_start(duk_hthread *thr, duk_uint_t interval) {
+	DUK_ASSERT_API_ENTRY(thr);
+	DUK_ASSERT(thr->heap != NULL);
+
+	if (interval == 0) {
+		interval = DUK_PROFILER_DEFAULT_INTERVAL;
+	} else if (interval > (duk_uint_t) DUK_HTHREAD_INTCTR_DEFAULT) {
+		/* Interrupts happen at least this often anyway. */
+		interval = (duk_uint_t) DUK_HTHREAD_INTCTR_DEFAULT;
+	}
+
+	DUK_D(DUK_DPRINT("application called duk_profiler_start(), interval=%lu", (unsigned long) interval));
+
+	duk_profiler_reset(thr);
+	thr->heap->prof_interval = (duk_uint32_t) interval;
+
+	/* Interrupt on the next opcode executed so that the sampling interval
+	 * takes effect immediately rather than after the current countdown.
+	 */
+	DUK_ASSERT(thr->interrupt_counter <= thr->interrupt_init);
+	thr->interrupt_init -= thr->interrupt_counter;
+	thr->interrupt_counter = 0;
+}
+
+DUK_EXTERNAL void duk_profiler_stop(duk_hthread *thr) {
+	DUK_ASSERT_API_ENTRY(thr);
+	DUK_ASSERT(thr->heap != NULL);
+
+	/* Samples are kept for duk_profiler_dump(). */
+	thr->heap->prof_interval = 0;
+}
+
+DUK_EXTERNAL void duk_profiler_dump(duk_hthread *thr, duk_uint_t flags) {
+	DUK_ASSERT_API_ENTRY(thr);
+
+	duk_profiler_push_dump(thr, flags);
+}
+
+#else /* DUK_USE_PROFILER */
+
+DUK_EXTERNAL void duk_profiler_start(duk_hthread *thr, duk_uint_t interval) {
+	DUK_ASSERT_API_ENTRY(thr);
+	DUK_UNREF(interval);
+	DUK_ERROR_TYPE(thr, "no profiler support");
+	DUK_WO_NORETURN(return;);
+}
+
+DUK_EXTERNAL void duk_profiler_stop(duk_hthread *thr) {
+	DUK_ASSERT_API_ENTRY(thr);
+	DUK_ERROR_TYPE(thr, "no profiler support");
+	DUK_WO_NORETURN(return;);
+}
+
+DUK_EXTERNAL void duk_profiler_dump(duk_hthread *thr, duk_uint_t flags) {
+	DUK_ASSERT_API_ENTRY(thr);
+	DUK_UNREF(flags);
+	DUK_ERROR_TYPE(thr, "no profiler support");
+	DUK_WO_NORETURN(return;);
+}
+
+#endif /* DUK_USE_PROFILER */
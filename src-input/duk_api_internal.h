@@ -272,6 +272,14 @@ DUK_INTERNAL_DECL duk_hbufobj *duk_push_bufobj_raw(duk_hthread *thr,
                                                    duk_uint_t hobject_flags_and_class,
                                                    duk_small_int_t prototype_bidx);
 #endif
+#if defined(DUK_USE_COLLECTION_BUILTINS)
+DUK_INTERNAL_DECL duk_hmap *duk_push_hmap_raw(duk_hthread *thr, duk_uint_t hobject_flags_and_class, duk_small_int_t prototype_bidx);
+#endif
+#if defined(DUK_USE_PROMISE_BUILTIN)
+DUK_INTERNAL_DECL duk_hpromise *duk_push_hpromise_raw(duk_hthread *thr,
+                                                      duk_uint_t hobject_flags_and_class,
+                                                      duk_small_int_t prototype_bidx);
+#endif
 
 DUK_INTERNAL_DECL void *duk_push_fixed_buffer_nozero(duk_hthread *thr, duk_size_t len);
 DUK_INTERNAL_DECL void *duk_push_fixed_buffer_zero(duk_hthread *thr, duk_size_t len);
@@ -78,3 +78,20 @@ DUK_EXTERNAL void duk_gc(duk_hthread *thr, duk_uint_t flags) {
 	ms_flags = (duk_small_uint_t) flags;
 	duk_heap_mark_and_sweep(heap, ms_flags);
 }
+
+DUK_EXTERNAL duk_bool_t duk_gc_step(duk_hthread *thr, duk_uint_t budget) {
+	duk_heap *heap;
+
+	DUK_ASSERT_API_ENTRY(thr);
+	heap = thr->heap;
+	DUK_ASSERT(heap != NULL);
+
+#if defined(DUK_USE_INCREMENTAL_GC)
+	return duk_heap_mark_and_sweep_step(heap, (duk_size_t) budget);
+#else
+	/* Without incremental GC a step is a full collection. */
+	DUK_UNREF(budget);
+	duk_heap_mark_and_sweep(heap, 0);
+	return 0;
+#endif
+}
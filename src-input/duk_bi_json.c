@@ -28,6 +28,20 @@
 #define DUK__JSON_STRINGIFY_BUFSIZE 128
 #define DUK__JSON_MAX_ESC_LEN       10 /* '\Udeadbeef' */
 
+#if defined(DUK_USE_JSON_DEC_SIMD)
+#if defined(DUK_USE_SSE2) || defined(DUK_USE_NEON)
+#define DUK__JSON_SCAN_BLOCK 16
+#elif defined(DUK_USE_64BIT_OPS)
+#define DUK__JSON_SCAN_BLOCK 8
+#define DUK__JSON_SCAN_ONES  DUK_U64_CONSTANT(0x0101010101010101)
+typedef duk_uint64_t duk__json_scan_word;
+#else
+#define DUK__JSON_SCAN_BLOCK 4
+#define DUK__JSON_SCAN_ONES  0x01010101UL
+typedef duk_uint32_t duk__json_scan_word;
+#endif
+#endif /* DUK_USE_JSON_DEC_SIMD */
+
 DUK_LOCAL_DECL void duk__json_dec_syntax_error(duk_json_dec_ctx *js_ctx);
 DUK_LOCAL_DECL void duk__json_dec_eat_white(duk_json_dec_ctx *js_ctx);
 #if defined(DUK_USE_JX)
@@ -214,11 +228,101 @@ DUK_LOCAL void duk__json_dec_syntax_error(duk_json_dec_ctx *js_ctx) {
 	DUK_WO_NORETURN(return;);
 }
 
+#if defined(DUK_USE_JSON_DEC_SIMD)
+/* Block scanning helpers.  A block is only examined when it lies entirely
+ * within the input, i.e. before the NUL terminator at p_end.  Both helpers
+ * only answer a yes/no question for the whole block; the exact position is
+ * then located by the ordinary byte loop, which keeps the helpers endianness
+ * agnostic and avoids the need for a count-trailing-zeros primitive.
+ */
+
+#if !defined(DUK_USE_SSE2) && !defined(DUK_USE_NEON)
+DUK_LOCAL DUK_ALWAYS_INLINE duk__json_scan_word duk__json_scan_load(const duk_uint8_t *p) {
+	duk__json_scan_word w;
+
+	duk_memcpy((void *) &w, (const void *) p, sizeof(w));
+	return w;
+}
+
+/* Nonzero if any byte of 'w' is zero, exact (no false positives). */
+#define DUK__JSON_SCAN_HASZERO(w) (((w) - DUK__JSON_SCAN_ONES) & ~(w) & (DUK__JSON_SCAN_ONES * 0x80U))
+#endif
+
+/* Nonzero if the block at 'p' contains a byte which terminates a plain
+ * run inside a JSON string: '"', '\\', or a control character (< 0x20).
+ */
+DUK_LOCAL DUK_ALWAYS_INLINE duk_bool_t duk__json_scan_block_has_special(const duk_uint8_t *p) {
+#if defined(DUK_USE_SSE2)
+	__m128i v, t;
+
+	v = _mm_loadu_si128((const __m128i *) (const void *) p);
+	t = _mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8(0x22)), _mm_cmpeq_epi8(v, _mm_set1_epi8(0x5c)));
+	/* Unsigned v <= 0x1f iff min(v, 0x1f) == v. */
+	t = _mm_or_si128(t, _mm_cmpeq_epi8(_mm_min_epu8(v, _mm_set1_epi8(0x1f)), v));
+	return (duk_bool_t) (_mm_movemask_epi8(t) != 0);
+#elif defined(DUK_USE_NEON)
+	uint8x16_t v, t;
+	uint64x2_t w;
+
+	v = vld1q_u8(p);
+	t = vorrq_u8(vceqq_u8(v, vdupq_n_u8(0x22)), vceqq_u8(v, vdupq_n_u8(0x5c)));
+	t = vorrq_u8(t, vcltq_u8(v, vdupq_n_u8(0x20)));
+	w = vreinterpretq_u64_u8(t);
+	return (duk_bool_t) ((vgetq_lane_u64(w, 0) | vgetq_lane_u64(w, 1)) != 0);
+#else
+	duk__json_scan_word w, t;
+
+	w = duk__json_scan_load(p);
+	t = ((w - DUK__JSON_SCAN_ONES * 0x20U) & ~w & (DUK__JSON_SCAN_ONES * 0x80U)); /* any byte < 0x20 */
+	t |= DUK__JSON_SCAN_HASZERO(w ^ (DUK__JSON_SCAN_ONES * 0x22U));
+	t |= DUK__JSON_SCAN_HASZERO(w ^ (DUK__JSON_SCAN_ONES * 0x5cU));
+	return (duk_bool_t) (t != 0);
+#endif
+}
+
+/* Nonzero if the block at 'p' consists entirely of JSON whitespace.  The
+ * portable variant only recognizes runs of spaces (indentation), which is
+ * the case that matters in practice.
+ */
+DUK_LOCAL DUK_ALWAYS_INLINE duk_bool_t duk__json_scan_block_all_white(const duk_uint8_t *p) {
+#if defined(DUK_USE_SSE2)
+	__m128i v, t;
+
+	v = _mm_loadu_si128((const __m128i *) (const void *) p);
+	t = _mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8(0x20)), _mm_cmpeq_epi8(v, _mm_set1_epi8(0x0a)));
+	t = _mm_or_si128(t, _mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8(0x0d)), _mm_cmpeq_epi8(v, _mm_set1_epi8(0x09))));
+	return (duk_bool_t) (_mm_movemask_epi8(t) == 0xffff);
+#elif defined(DUK_USE_NEON)
+	uint8x16_t v, t;
+	uint64x2_t w;
+
+	v = vld1q_u8(p);
+	t = vorrq_u8(vceqq_u8(v, vdupq_n_u8(0x20)), vceqq_u8(v, vdupq_n_u8(0x0a)));
+	t = vorrq_u8(t, vorrq_u8(vceqq_u8(v, vdupq_n_u8(0x0d)), vceqq_u8(v, vdupq_n_u8(0x09))));
+	w = vreinterpretq_u64_u8(t);
+	return (duk_bool_t) ((vgetq_lane_u64(w, 0) & vgetq_lane_u64(w, 1)) == DUK_U64_CONSTANT(0xffffffffffffffff));
+#else
+	return (duk_bool_t) (duk__json_scan_load(p) == DUK__JSON_SCAN_ONES * 0x20U);
+#endif
+}
+#endif /* DUK_USE_JSON_DEC_SIMD */
+
 DUK_LOCAL void duk__json_dec_eat_white(duk_json_dec_ctx *js_ctx) {
 	const duk_uint8_t *p;
 	duk_uint8_t t;
 
 	p = js_ctx->p;
+#if defined(DUK_USE_JSON_DEC_SIMD)
+	/* Compact JSON rarely has whitespace, so only enter the block loop
+	 * once the first byte is known to be whitespace.
+	 */
+	if (*p == 0x20 || *p == 0x0a || *p == 0x0d || *p == 0x09) {
+		p++;
+		while ((duk_size_t) (js_ctx->p_end - p) >= DUK__JSON_SCAN_BLOCK && duk__json_scan_block_all_white(p)) {
+			p += DUK__JSON_SCAN_BLOCK;
+		}
+	}
+#endif
 	for (;;) {
 		DUK_ASSERT(p <= js_ctx->p_end);
 		t = *p;
@@ -446,7 +550,58 @@ DUK_LOCAL void duk__json_dec_string(duk_json_dec_ctx *js_ctx) {
 	DUK_BW_INIT_PUSHBUF(js_ctx->thr, bw, DUK__JSON_DECSTR_BUFSIZE);
 	q = DUK_BW_GET_PTR(js_ctx->thr, bw);
 
+#if defined(DUK_USE_JSON_DEC_SIMD)
+	for (;;) {
+		const duk_uint8_t *p;
+		const duk_uint8_t *p_run;
+		duk_size_t run;
+		duk_uint8_t b;
+
+		/* Locate the end of the plain run using whole blocks first,
+		 * then bytes.  The NUL terminator at p_end (or any other
+		 * control character) always ends the run so no input bound
+		 * checks are needed in the byte loop.
+		 */
+		p_run = js_ctx->p;
+		p = p_run;
+		while ((duk_size_t) (js_ctx->p_end - p) >= DUK__JSON_SCAN_BLOCK && !duk__json_scan_block_has_special(p)) {
+			p += DUK__JSON_SCAN_BLOCK;
+		}
+		for (;;) {
+			b = *p;
 #if defined(DUK_USE_JSON_DECSTRING_FASTPATH)
+			DUK_ASSERT(duk__json_decstr_lookup[0] == 0x00);
+			if (duk__json_decstr_lookup[b] == 0) {
+				break;
+			}
+#else
+			if (b == DUK_ASC_DOUBLEQUOTE || b == DUK_ASC_BACKSLASH || b < 0x20) {
+				break;
+			}
+#endif
+			p++;
+		}
+		DUK_ASSERT(p <= js_ctx->p_end);
+
+		/* Ensure space for the run plus one escape. */
+		run = (duk_size_t) (p - p_run);
+		q = DUK_BW_ENSURE_RAW(js_ctx->thr, bw, run + DUK_UNICODE_MAX_XUTF8_LENGTH, q);
+		duk_memcpy((void *) q, (const void *) p_run, run);
+		q += run;
+
+		js_ctx->p = p + 1;
+		if (b == DUK_ASC_DOUBLEQUOTE) {
+			break;
+		} else if (b == DUK_ASC_BACKSLASH) {
+			if (duk__json_dec_string_escape(js_ctx, &q) != 0) {
+				goto syntax_error;
+			}
+		} else {
+			/* catches EOF (NUL) */
+			goto syntax_error;
+		}
+	}
+#elif defined(DUK_USE_JSON_DECSTRING_FASTPATH)
 	for (;;) {
 		duk_small_uint_t safe;
 		duk_uint8_t b, x;
@@ -499,7 +654,7 @@ DUK_LOCAL void duk__json_dec_string(duk_json_dec_ctx *js_ctx) {
 		}
 	}
 found_quote:
-#else /* DUK_USE_JSON_DECSTRING_FASTPATH */
+#else /* DUK_USE_JSON_DEC_SIMD, DUK_USE_JSON_DECSTRING_FASTPATH */
 	for (;;) {
 		duk_uint8_t x;
 
@@ -520,7 +675,7 @@ found_quote:
 			*q++ = (duk_uint8_t) x;
 		}
 	}
-#endif /* DUK_USE_JSON_DECSTRING_FASTPATH */
+#endif /* DUK_USE_JSON_DEC_SIMD, DUK_USE_JSON_DECSTRING_FASTPATH */
 
 	DUK_BW_SETPTR_AND_COMPACT(js_ctx->thr, bw, q);
 	(void) duk_buffer_to_string(thr, -1); /* Safe if input string is safe. */
@@ -789,6 +944,10 @@ DUK_LOCAL void duk__json_dec_object(duk_json_dec_ctx *js_ctx) {
 	duk__json_dec_objarr_entry(js_ctx);
 
 	duk_push_object(thr);
+#if defined(DUK_USE_HOBJECT_SHAPES)
+	/* Records with the same keys (common in JSON data) share a layout. */
+	duk_hobject_init_shape(thr, duk_known_hobject(thr, -1));
+#endif
 
 	/* Initial '{' has been checked and eaten by caller. */
 
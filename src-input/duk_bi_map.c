@@ -0,0 +1,252 @@
+/*
+ *  Map, Set, WeakMap, and WeakSet built-ins
+ *
+ *  All four share the same natives; the magic value is the collection
+ *  htype minus DUK_HTYPE_MAP.
+ */
+
+#include "duk_internal.h"
+
+#if defined(DUK_USE_COLLECTION_BUILTINS)
+
+DUK_LOCAL const duk_uint8_t duk__map_proto_bidx[4] = { DUK_BIDX_MAP_PROTOTYPE,
+	                                               DUK_BIDX_SET_PROTOTYPE,
+	                                               DUK_BIDX_WEAKMAP_PROTOTYPE,
+	                                               DUK_BIDX_WEAKSET_PROTOTYPE };
+
+/* Weak collections only accept object-like keys.  Lightfuncs and plain
+ * buffers are accepted because they behave like objects elsewhere; a
+ * lightfunc key is never released because it's not heap allocated.
+ */
+DUK_LOCAL duk_bool_t duk__map_is_weak_key(duk_tval *tv) {
+	return (DUK_TVAL_IS_OBJECT(tv) || DUK_TVAL_IS_BUFFER(tv) || DUK_TVAL_IS_LIGHTFUNC(tv));
+}
+
+DUK_LOCAL duk_hmap *duk__map_push_this(duk_hthread *thr) {
+	duk_small_uint_t htype;
+
+	htype = DUK_HTYPE_MAP + (duk_small_uint_t) duk_get_current_magic(thr);
+	DUK_ASSERT(DUK_HTYPE_IS_ANY_HMAP(htype));
+	duk_push_this(thr);
+	return (duk_hmap *) duk_require_hobject_with_htype(thr, -1, htype);
+}
+
+/* Add (key, value) at the value stack top to 'h' and pop them.  For Set
+ * variants only the key is on the stack.
+ */
+DUK_LOCAL void duk__map_put_top(duk_hthread *thr, duk_hmap *h) {
+	duk_uint_t stride;
+	duk_tval *tv_key;
+
+	stride = DUK_HMAP_GET_STRIDE(h);
+	tv_key = DUK_GET_TVAL_NEGIDX(thr, -((duk_idx_t) stride));
+	if (DUK_HMAP_IS_WEAK(h) && !duk__map_is_weak_key(tv_key)) {
+		DUK_ERROR_TYPE_INVALID_ARGS(thr);
+		DUK_WO_NORETURN(return;);
+	}
+	duk_hmap_put(thr, h, tv_key, (stride == 2U ? DUK_GET_TVAL_NEGIDX(thr, -1) : NULL));
+	duk_pop_n(thr, (duk_idx_t) stride);
+}
+
+/* Add an iteration value at the value stack top to 'h' and pop it.  For
+ * Map variants the value must be an [ key, value ] entry object.
+ */
+DUK_LOCAL void duk__map_add_iter_value(duk_hthread *thr, duk_hmap *h) {
+	if (DUK_HMAP_GET_STRIDE(h) == 2U) {
+		if (!duk_is_object(thr, -1)) {
+			DUK_ERROR_TYPE_INVALID_ARGS(thr);
+			DUK_WO_NORETURN(return;);
+		}
+		duk_get_prop_index(thr, -1, 0);
+		duk_get_prop_index(thr, -2, 1);
+		duk__map_put_top(thr, h);
+		duk_pop(thr);
+	} else {
+		duk__map_put_top(thr, h);
+	}
+}
+
+/* Populate a new collection from the constructor argument.  There's no
+ * iterator protocol support yet, so instead of a generic iterable the
+ * source may be another Map or Set (iterated like its default iterator
+ * would) or an array-like value.  The entries are added directly rather
+ * than through an overridable set() or add() method.
+ */
+DUK_LOCAL void duk__map_add_from_source(duk_hthread *thr, duk_hmap *h) {
+	duk_hobject *h_src;
+	duk_uint_t len;
+	duk_uint_t i;
+
+	h_src = duk_get_hobject(thr, 0);
+	if (h_src != NULL && DUK_HOBJECT_IS_HMAP(h_src) && !DUK_HMAP_IS_WEAK((duk_hmap *) h_src)) {
+		duk_hmap *h_srcmap = (duk_hmap *) h_src;
+
+		/* Entry array may be reallocated by side effects of the
+		 * adds below, so look up entries by index on each round.
+		 */
+		for (i = 0; i < h_srcmap->e_next; i++) {
+			duk_tval *tv_key = DUK_HMAP_GET_KEY(h_srcmap, i);
+
+			if (DUK_TVAL_IS_UNUSED(tv_key)) {
+				continue;
+			}
+			duk_push_tval(thr, tv_key);
+			if (DUK_HMAP_GET_STRIDE(h_srcmap) == 2U) {
+				duk_push_tval(thr, DUK_HMAP_GET_VALUE(h_srcmap, i));
+				if (DUK_HMAP_GET_STRIDE(h) == 2U) {
+					duk__map_put_top(thr, h);
+					continue;
+				}
+				duk_push_array(thr);
+				duk_insert(thr, -3);
+				duk_put_prop_index(thr, -3, 1);
+				duk_put_prop_index(thr, -2, 0);
+			}
+			duk__map_add_iter_value(thr, h);
+		}
+		return;
+	}
+
+	len = (duk_uint_t) duk_get_length(thr, 0);
+	for (i = 0; i < len; i++) {
+		duk_get_prop_index(thr, 0, (duk_uarridx_t) i);
+		duk__map_add_iter_value(thr, h);
+	}
+}
+
+DUK_INTERNAL duk_ret_t duk_bi_map_constructor(duk_hthread *thr) {
+	duk_small_uint_t magic;
+	duk_hmap *h;
+
+	duk_require_constructor_call(thr);
+
+	magic = (duk_small_uint_t) duk_get_current_magic(thr);
+	DUK_ASSERT(magic < 4);
+	h = duk_push_hmap_raw(thr,
+	                      DUK_HOBJECT_FLAG_EXTENSIBLE | DUK_HEAPHDR_HTYPE_AS_FLAGS(DUK_HTYPE_MAP + magic),
+	                      (duk_small_int_t) duk__map_proto_bidx[magic]);
+
+	/* [ iterable map ] */
+
+	if (!duk_is_null_or_undefined(thr, 0)) {
+		duk__map_add_from_source(thr, h);
+	}
+	return 1;
+}
+
+DUK_INTERNAL duk_ret_t duk_bi_map_prototype_clear(duk_hthread *thr) {
+	duk_hmap *h;
+
+	h = duk__map_push_this(thr);
+	duk_hmap_clear(thr, h);
+	return 0;
+}
+
+DUK_INTERNAL duk_ret_t duk_bi_map_prototype_delete(duk_hthread *thr) {
+	duk_hmap *h;
+
+	h = duk__map_push_this(thr);
+	duk_push_boolean(thr, duk_hmap_remove(thr, h, DUK_GET_TVAL_POSIDX(thr, 0)));
+	return 1;
+}
+
+DUK_LOCAL duk_ret_t duk__map_foreach_raw(duk_hthread *thr, void *udata) {
+	duk_hmap *h;
+	duk_uint32_t i;
+
+	h = (duk_hmap *) udata;
+
+	/* [ callback thisArg this ] */
+
+	/* Entries added during the loop are visited, deleted entries are
+	 * skipped.  Deleted entries are not compacted away while the loop
+	 * is running, but the entry array may still be reallocated so it
+	 * must be looked up on every round.
+	 */
+	for (i = 0; i < h->e_next; i++) {
+		duk_tval *tv_key = DUK_HMAP_GET_KEY(h, i);
+
+		if (DUK_TVAL_IS_UNUSED(tv_key)) {
+			continue;
+		}
+		duk_dup_0(thr);
+		duk_dup_1(thr);
+		if (DUK_HMAP_GET_STRIDE(h) == 2U) {
+			duk_push_tval(thr, DUK_HMAP_GET_VALUE(h, i));
+		} else {
+			duk_push_tval(thr, tv_key);
+		}
+		duk_push_tval(thr, DUK_HMAP_GET_KEY(h, i));
+		duk_dup_2(thr);
+		duk_call_method(thr, 3);
+		duk_pop(thr);
+	}
+	return 0;
+}
+
+DUK_INTERNAL duk_ret_t duk_bi_map_prototype_foreach(duk_hthread *thr) {
+	duk_hmap *h;
+	duk_int_t rc;
+
+	h = duk__map_push_this(thr);
+	duk_require_callable(thr, 0);
+
+	/* The loop runs in a protected call so that the iteration count
+	 * can be restored if the callback throws.
+	 */
+	h->iter_count++;
+	rc = duk_safe_call(thr, duk__map_foreach_raw, (void *) h, 0 /*nargs*/, 1 /*nrets*/);
+	DUK_ASSERT(h->iter_count > 0);
+	h->iter_count--;
+	if (rc != DUK_EXEC_SUCCESS) {
+		(void) duk_throw(thr);
+	}
+	return 0;
+}
+
+DUK_INTERNAL duk_ret_t duk_bi_map_prototype_get(duk_hthread *thr) {
+	duk_hmap *h;
+	duk_uint32_t idx;
+
+	h = duk__map_push_this(thr);
+	DUK_ASSERT(DUK_HMAP_GET_STRIDE(h) == 2U);
+	idx = duk_hmap_find(h, DUK_GET_TVAL_POSIDX(thr, 0));
+	if (idx == DUK_HMAP_INDEX_NONE) {
+		return 0;
+	}
+	duk_push_tval(thr, DUK_HMAP_GET_VALUE(h, idx));
+	return 1;
+}
+
+DUK_INTERNAL duk_ret_t duk_bi_map_prototype_has(duk_hthread *thr) {
+	duk_hmap *h;
+
+	h = duk__map_push_this(thr);
+	duk_push_boolean(thr, duk_hmap_find(h, DUK_GET_TVAL_POSIDX(thr, 0)) != DUK_HMAP_INDEX_NONE);
+	return 1;
+}
+
+/* Shared by set() and add(): for Set variants nargs is 1 and the value
+ * argument is not used.
+ */
+DUK_INTERNAL duk_ret_t duk_bi_map_prototype_set(duk_hthread *thr) {
+	duk_hmap *h;
+
+	h = duk__map_push_this(thr);
+	duk_dup_0(thr);
+	if (DUK_HMAP_GET_STRIDE(h) == 2U) {
+		duk_dup_1(thr);
+	}
+	duk__map_put_top(thr, h);
+	return 1;
+}
+
+DUK_INTERNAL duk_ret_t duk_bi_map_prototype_size_getter(duk_hthread *thr) {
+	duk_hmap *h;
+
+	h = duk__map_push_this(thr);
+	duk_push_uint(thr, (duk_uint_t) h->count);
+	return 1;
+}
+
+#endif /* DUK_USE_COLLECTION_BUILTINS */
@@ -1,44 +1,640 @@
 /*
  *  Promise built-in
+ *
+ *  Promise jobs are queued to a heap wide job queue which the application
+ *  drains using duk_run_jobs().  Limitations: no subclassing (@@species,
+ *  NewTarget prototype), no unhandled rejection tracking, and because
+ *  there's no iterator protocol support yet, all() and race() accept
+ *  array-like values only.
  */
 
 #include "duk_internal.h"
 
 #if defined(DUK_USE_PROMISE_BUILTIN)
 
+/* Magic values for resolve/reject functions. */
+#define DUK__PROMISE_MAGIC_RESOLVE 0
+#define DUK__PROMISE_MAGIC_REJECT  1
+
+DUK_LOCAL void duk__promise_resolve(duk_hthread *thr, duk_hpromise *p, duk_idx_t idx_value);
+
+DUK_LOCAL duk_hpromise *duk__promise_push_new(duk_hthread *thr) {
+	return duk_push_hpromise_raw(thr,
+	                             DUK_HOBJECT_FLAG_EXTENSIBLE | DUK_HEAPHDR_HTYPE_AS_FLAGS(DUK_HTYPE_PROMISE),
+	                             DUK_BIDX_PROMISE_PROTOTYPE);
+}
+
+DUK_LOCAL duk_hpromise *duk__promise_push_this(duk_hthread *thr) {
+	duk_push_this(thr);
+	return (duk_hpromise *) duk_require_hobject_with_htype(thr, -1, DUK_HTYPE_PROMISE);
+}
+
+DUK_LOCAL duk_hpromise *duk__promise_get_hpromise(duk_hthread *thr, duk_idx_t idx) {
+	return (duk_hpromise *) duk_get_hobject_with_htype(thr, idx, DUK_HTYPE_PROMISE);
+}
+
+/* True if 'idx' contains the built-in then() function, in which case a
+ * then() call can be replaced with an internal reaction record.
+ */
+DUK_LOCAL duk_bool_t duk__promise_is_builtin_then(duk_hthread *thr, duk_idx_t idx) {
+	duk_hobject *h;
+
+	h = duk_get_hobject(thr, idx);
+	return (h != NULL && DUK_HOBJECT_IS_NATFUNC(h) && ((duk_hnatfunc *) h)->func == duk_bi_promise_then);
+}
+
+/*
+ *  Job records
+ */
+
+DUK_LOCAL void duk__promise_job_set_tval(duk_hthread *thr, duk_tval *tv_dst, duk_tval *tv_src) {
+	DUK_ASSERT(DUK_TVAL_IS_UNDEFINED(tv_dst));
+	DUK_UNREF(thr);
+	DUK_TVAL_SET_TVAL(tv_dst, tv_src);
+	DUK_TVAL_INCREF(thr, tv_dst);
+}
+
+/* Allocate a job record for 'target', which must be reachable.  May have
+ * side effects, so allocate before inspecting Promise state.
+ */
+DUK_LOCAL duk_promise_job *duk__promise_job_alloc(duk_hthread *thr, duk_small_uint_t type, duk_hpromise *target) {
+	duk_promise_job *job;
+
+	DUK_ASSERT(target != NULL);
+
+	job = (duk_promise_job *) DUK_ALLOC_CHECKED(thr, sizeof(duk_promise_job));
+	job->next = NULL;
+	job->target = target;
+	DUK_HOBJECT_INCREF(thr, (duk_hobject *) target);
+	DUK_TVAL_SET_UNDEFINED(&job->handler_f);
+	DUK_TVAL_SET_UNDEFINED(&job->handler_r);
+	DUK_TVAL_SET_UNDEFINED(&job->value);
+	job->index = 0;
+	job->type = (duk_uint8_t) type;
+	job->rejected = 0;
+	return job;
+}
+
+DUK_LOCAL void duk__promise_enqueue_job(duk_heap *heap, duk_promise_job *job) {
+	job->next = NULL;
+	if (heap->job_tail != NULL) {
+		DUK_ASSERT(heap->job_head != NULL);
+		heap->job_tail->next = job;
+	} else {
+		DUK_ASSERT(heap->job_head == NULL);
+		heap->job_head = job;
+	}
+	heap->job_tail = job;
+}
+
+/* Register a reaction record on 'p', or queue it right away if 'p' is
+ * already settled.  Side effect free.
+ */
+DUK_LOCAL void duk__promise_add_reaction(duk_hthread *thr, duk_hpromise *p, duk_promise_job *job) {
+	DUK_HPROMISE_ASSERT_VALID(p);
+
+	if (p->state == DUK_HPROMISE_STATE_PENDING) {
+		job->next = p->reactions;
+		p->reactions = job;
+	} else {
+		duk__promise_job_set_tval(thr, &job->value, &p->value);
+		job->rejected = (p->state == DUK_HPROMISE_STATE_REJECTED);
+		duk__promise_enqueue_job(thr->heap, job);
+	}
+}
+
+/*
+ *  Settling
+ */
+
+/* FulfillPromise() / RejectPromise(): pending reactions become jobs in
+ * registration order.  Side effect free; no-op if 'p' is already settled.
+ */
+DUK_LOCAL void duk__promise_settle(duk_hthread *thr, duk_hpromise *p, duk_idx_t idx_value, duk_bool_t rejected) {
+	duk_tval *tv_value;
+	duk_promise_job *job;
+	duk_promise_job *prev;
+	duk_promise_job *next;
+
+	DUK_HPROMISE_ASSERT_VALID(p);
+
+	if (p->state != DUK_HPROMISE_STATE_PENDING) {
+		return;
+	}
+
+	tv_value = duk_require_tval(thr, idx_value);
+	DUK_ASSERT(DUK_TVAL_IS_UNDEFINED(&p->value));
+	duk__promise_job_set_tval(thr, &p->value, tv_value);
+	p->state = (rejected ? DUK_HPROMISE_STATE_REJECTED : DUK_HPROMISE_STATE_FULFILLED);
+
+	/* Reactions are kept newest first, reverse while queueing. */
+	prev = NULL;
+	for (job = p->reactions; job != NULL; job = next) {
+		next = job->next;
+		job->next = prev;
+		prev = job;
+	}
+	p->reactions = NULL;
+
+	for (job = prev; job != NULL; job = next) {
+		next = job->next;
+		duk__promise_job_set_tval(thr, &job->value, tv_value);
+		job->rejected = (duk_uint8_t) rejected;
+		duk__promise_enqueue_job(thr->heap, job);
+	}
+}
+
+DUK_LOCAL duk_ret_t duk__promise_get_then_raw(duk_hthread *thr, void *udata) {
+	DUK_UNREF(udata);
+
+	/* [ ... thenable ] -> [ ... then ] */
+	(void) duk_get_prop_stridx_short(thr, -1, DUK_STRIDX_THEN);
+	return 1;
+}
+
+/* Promise Resolve Functions steps 7-15, for a resolution value at 'idx_value'.
+ * Caller has already dealt with [[AlreadyResolved]].
+ */
+DUK_LOCAL void duk__promise_resolve(duk_hthread *thr, duk_hpromise *p, duk_idx_t idx_value) {
+	duk_promise_job *job;
+
+	idx_value = duk_require_normalize_index(thr, idx_value);
+
+	if (p->state != DUK_HPROMISE_STATE_PENDING) {
+		return;
+	}
+	if (duk_get_hobject(thr, idx_value) == (duk_hobject *) p) {
+		(void) duk_push_error_object(thr, DUK_ERR_TYPE_ERROR, "self resolution");
+		duk__promise_settle(thr, p, -1, 1 /*rejected*/);
+		duk_pop(thr);
+		return;
+	}
+	if (!duk_is_object(thr, idx_value)) {
+		duk__promise_settle(thr, p, idx_value, 0 /*rejected*/);
+		return;
+	}
+
+	/* Get(resolution, "then") is observable and may throw, which rejects
+	 * the Promise.
+	 */
+	duk_dup(thr, idx_value);
+	if (duk_safe_call(thr, duk__promise_get_then_raw, NULL /*udata*/, 1 /*nargs*/, 1 /*nrets*/) != DUK_EXEC_SUCCESS) {
+		duk__promise_settle(thr, p, -1, 1 /*rejected*/);
+		duk_pop(thr);
+		return;
+	}
+	if (!duk_is_callable(thr, -1)) {
+		duk_pop(thr);
+		duk__promise_settle(thr, p, idx_value, 0 /*rejected*/);
+		return;
+	}
+
+	/* [ ... then ] */
+
+	job = duk__promise_job_alloc(thr, DUK_PROMISE_JOB_THENABLE, p);
+	duk__promise_job_set_tval(thr, &job->handler_f, DUK_GET_TVAL_NEGIDX(thr, -1));
+	duk__promise_job_set_tval(thr, &job->value, DUK_GET_TVAL_POSIDX(thr, idx_value));
+	duk__promise_enqueue_job(thr->heap, job);
+	duk_pop(thr);
+}
+
+/* Reject 'p' on behalf of a resolve/reject pair of generation 'gen', unless
+ * the pair has already been used.
+ */
+DUK_LOCAL void duk__promise_reject_if_live(duk_hthread *thr, duk_hpromise *p, duk_uint32_t gen, duk_idx_t idx_reason) {
+	if (p->resolve_gen == gen) {
+		p->resolve_gen++;
+		duk__promise_settle(thr, p, idx_reason, 1 /*rejected*/);
+	}
+}
+
+/*
+ *  Resolve/reject functions, only created when visible to calling code.
+ */
+
+DUK_LOCAL duk_ret_t duk__promise_resolving_function(duk_hthread *thr) {
+	duk_hpromise *p;
+	duk_uint32_t gen;
+
+	duk_push_current_function(thr);
+	(void) duk_xget_owndataprop_stridx_short(thr, -1, DUK_STRIDX_INT_TARGET);
+	(void) duk_xget_owndataprop_stridx_short(thr, -2, DUK_STRIDX_INT_VALUE);
+	p = duk__promise_get_hpromise(thr, -2);
+	gen = (duk_uint32_t) duk_get_uint(thr, -1);
+	DUK_ASSERT(p != NULL);
+
+	if (p->resolve_gen != gen) {
+		/* [[AlreadyResolved]] */
+		return 0;
+	}
+	p->resolve_gen++;
+
+	if (duk_get_current_magic(thr) == DUK__PROMISE_MAGIC_REJECT) {
+		duk__promise_settle(thr, p, 0, 1 /*rejected*/);
+	} else {
+		duk__promise_resolve(thr, p, 0);
+	}
+	return 0;
+}
+
+/* Push a resolve/reject function pair for 'p'. */
+DUK_LOCAL void duk__promise_push_resolving_functions(duk_hthread *thr, duk_hpromise *p) {
+	duk_small_int_t magic;
+
+	for (magic = DUK__PROMISE_MAGIC_RESOLVE; magic <= DUK__PROMISE_MAGIC_REJECT; magic++) {
+		duk_push_c_function_builtin_noconstruct(thr, duk__promise_resolving_function, 1);
+		duk_set_magic(thr, -1, (duk_int_t) magic);
+		duk_push_uint(thr, 1);
+		duk_xdef_prop_stridx_short(thr, -2, DUK_STRIDX_LENGTH, DUK_PROPDESC_FLAGS_C);
+		duk_push_hobject(thr, (duk_hobject *) p);
+		duk_xdef_prop_stridx_short(thr, -2, DUK_STRIDX_INT_TARGET, DUK_PROPDESC_FLAGS_NONE);
+		duk_push_uint(thr, (duk_uint_t) p->resolve_gen);
+		duk_xdef_prop_stridx_short(thr, -2, DUK_STRIDX_INT_VALUE, DUK_PROPDESC_FLAGS_NONE);
+	}
+}
+
+/*
+ *  Job execution
+ */
+
+DUK_LOCAL void duk__promise_run_reaction(duk_hthread *thr, duk_hpromise *target, duk_idx_t idx_base, duk_bool_t rejected) {
+	duk_idx_t idx_handler;
+
+	/* [ ... target handler_f handler_r value ] */
+
+	idx_handler = idx_base + (rejected ? 2 : 1);
+	if (duk_is_undefined(thr, idx_handler)) {
+		/* Identity / Thrower. */
+		if (rejected) {
+			duk__promise_settle(thr, target, idx_base + 3, 1 /*rejected*/);
+		} else {
+			duk__promise_resolve(thr, target, idx_base + 3);
+		}
+		return;
+	}
+
+	duk_dup(thr, idx_handler);
+	duk_push_undefined(thr);
+	duk_dup(thr, idx_base + 3);
+	if (duk_pcall_method(thr, 1 /*nargs*/) == DUK_EXEC_SUCCESS) {
+		duk__promise_resolve(thr, target, -1);
+	} else {
+		duk__promise_settle(thr, target, -1, 1 /*rejected*/);
+	}
+}
+
+DUK_LOCAL void duk__promise_run_all_element(duk_hthread *thr, duk_hpromise *target, duk_uint32_t index, duk_idx_t idx_base, duk_bool_t rejected) {
+	/* [ ... target values undefined value ] */
+
+	if (rejected) {
+		duk__promise_settle(thr, target, idx_base + 3, 1 /*rejected*/);
+		return;
+	}
+	if (target->state != DUK_HPROMISE_STATE_PENDING) {
+		return;
+	}
+	duk_dup(thr, idx_base + 3);
+	duk_put_prop_index(thr, idx_base + 1, (duk_uarridx_t) index);
+	DUK_ASSERT(target->all_remaining > 0);
+	if (--target->all_remaining == 0) {
+		duk__promise_resolve(thr, target, idx_base + 1);
+	}
+}
+
+/* PromiseResolveThenableJob. */
+DUK_LOCAL void duk__promise_run_thenable(duk_hthread *thr, duk_hpromise *target, duk_idx_t idx_base) {
+	duk_hpromise *thenable;
+	duk_uint32_t gen;
+
+	/* [ ... target then undefined thenable ] */
+
+	thenable = duk__promise_get_hpromise(thr, idx_base + 3);
+	if (thenable != NULL && duk__promise_is_builtin_then(thr, idx_base + 1)) {
+		/* The built-in then() would just forward the settled value
+		 * of 'thenable' to 'target', so do that directly.
+		 */
+		duk_promise_job *job;
+
+		job = duk__promise_job_alloc(thr, DUK_PROMISE_JOB_REACTION, target);
+		duk__promise_add_reaction(thr, thenable, job);
+		return;
+	}
+
+	gen = target->resolve_gen;
+	duk__promise_push_resolving_functions(thr, target);
+	duk_dup(thr, idx_base + 1);
+	duk_dup(thr, idx_base + 3);
+	duk_dup(thr, -4);
+	duk_dup(thr, -4);
+	if (duk_pcall_method(thr, 2 /*nargs*/) != DUK_EXEC_SUCCESS) {
+		duk__promise_reject_if_live(thr, target, gen, -1);
+	}
+}
+
+/* Run the job at the head of the heap job queue.  Returns 0 if the queue
+ * was empty.  Errors from handlers settle the target Promise, so only
+ * internal errors (e.g. out of memory) are thrown.
+ */
+DUK_INTERNAL duk_bool_t duk_promise_run_job(duk_hthread *thr) {
+	duk_heap *heap;
+	duk_promise_job *job;
+	duk_hpromise *target;
+	duk_idx_t idx_base;
+	duk_uint32_t index;
+	duk_small_uint_t type;
+	duk_bool_t rejected;
+
+	heap = thr->heap;
+	duk_require_stack(thr, 16);
+
+	job = heap->job_head;
+	if (job == NULL) {
+		return 0;
+	}
+	heap->job_head = job->next;
+	if (heap->job_head == NULL) {
+		heap->job_tail = NULL;
+	}
+
+	/* Move the record's references to the value stack so they remain
+	 * reachable while the job runs, and free the record.  The decrefs
+	 * can't hit zero and are thus side effect free.
+	 */
+	idx_base = duk_get_top(thr);
+	target = job->target;
+	duk_push_hobject(thr, (duk_hobject *) target);
+	duk_push_tval(thr, &job->handler_f);
+	duk_push_tval(thr, &job->handler_r);
+	duk_push_tval(thr, &job->value);
+	index = job->index;
+	type = job->type;
+	rejected = job->rejected;
+	DUK_HOBJECT_DECREF_NORZ(thr, (duk_hobject *) job->target);
+	DUK_TVAL_DECREF_NORZ(thr, &job->handler_f);
+	DUK_TVAL_DECREF_NORZ(thr, &job->handler_r);
+	DUK_TVAL_DECREF_NORZ(thr, &job->value);
+	DUK_FREE_CHECKED(thr, (void *) job);
+
+	/* [ ... target handler_f handler_r value ] */
+
+	switch (type) {
+	case DUK_PROMISE_JOB_REACTION:
+		duk__promise_run_reaction(thr, target, idx_base, rejected);
+		break;
+	case DUK_PROMISE_JOB_ALL_ELEMENT:
+		duk__promise_run_all_element(thr, target, index, idx_base, rejected);
+		break;
+	default:
+		DUK_ASSERT(type == DUK_PROMISE_JOB_THENABLE);
+		duk__promise_run_thenable(thr, target, idx_base);
+		break;
+	}
+
+	duk_set_top(thr, idx_base);
+	return 1;
+}
+
+/*
+ *  Constructor and static methods
+ */
+
 DUK_INTERNAL duk_ret_t duk_bi_promise_constructor(duk_hthread *thr) {
-	DUK_ERROR_TYPE(thr, "unimplemented");
-	DUK_WO_NORETURN(return 0;);
+	duk_hpromise *p;
+
+	duk_require_constructor_call(thr);
+	duk_require_callable(thr, 0);
+
+	p = duk__promise_push_new(thr);
+	duk__promise_push_resolving_functions(thr, p);
+
+	/* [ executor promise resolve reject ] */
+
+	duk_dup_0(thr);
+	duk_dup_2(thr);
+	duk_dup(thr, 3);
+	if (duk_pcall(thr, 2 /*nargs*/) != DUK_EXEC_SUCCESS) {
+		duk__promise_reject_if_live(thr, p, 0, -1);
+	}
+	duk_set_top(thr, 2);
+	return 1;
 }
 
-DUK_INTERNAL duk_ret_t duk_bi_promise_all(duk_hthread *thr) {
-	DUK_ERROR_TYPE(thr, "unimplemented");
-	DUK_WO_NORETURN(return 0;);
+/* PromiseResolve(C, x) for C = 'this' binding and x at value stack top,
+ * replacing x with the result.  Returns the result Promise.
+ */
+DUK_LOCAL duk_hpromise *duk__promise_resolve_top(duk_hthread *thr, duk_idx_t idx_ctor) {
+	duk_hpromise *p;
+
+	p = duk__promise_get_hpromise(thr, -1);
+	if (p != NULL) {
+		(void) duk_get_prop_stridx_short(thr, -1, DUK_STRIDX_CONSTRUCTOR);
+		if (duk_samevalue(thr, -1, idx_ctor)) {
+			duk_pop(thr);
+			return p;
+		}
+		duk_pop(thr);
+	}
+
+	p = duk__promise_push_new(thr);
+	duk__promise_resolve(thr, p, -2);
+	duk_remove_m2(thr);
+	return p;
 }
 
-DUK_INTERNAL duk_ret_t duk_bi_promise_race(duk_hthread *thr) {
-	DUK_ERROR_TYPE(thr, "unimplemented");
-	DUK_WO_NORETURN(return 0;);
+DUK_INTERNAL duk_ret_t duk_bi_promise_resolve(duk_hthread *thr) {
+	duk_push_this(thr);
+	duk_dup_0(thr);
+	(void) duk__promise_resolve_top(thr, 1);
+	return 1;
 }
 
 DUK_INTERNAL duk_ret_t duk_bi_promise_reject(duk_hthread *thr) {
-	DUK_ERROR_TYPE(thr, "unimplemented");
-	DUK_WO_NORETURN(return 0;);
+	duk_hpromise *p;
+
+	p = duk__promise_push_new(thr);
+	duk__promise_settle(thr, p, 0, 1 /*rejected*/);
+	return 1;
 }
 
-DUK_INTERNAL duk_ret_t duk_bi_promise_resolve(duk_hthread *thr) {
-	DUK_ERROR_TYPE(thr, "unimplemented");
-	DUK_WO_NORETURN(return 0;);
+/* Shared all() and race() element processing.  Runs in a protected call so
+ * that errors can reject the result Promise.
+ */
+DUK_LOCAL duk_ret_t duk__promise_all_race_raw(duk_hthread *thr, void *udata) {
+	duk_hpromise *res;
+	duk_bool_t is_all;
+	duk_uint_t len;
+	duk_uint_t i;
+
+	DUK_UNREF(udata);
+
+	/* [ iterable this result values/undefined undefined undefined ] */
+
+	res = duk__promise_get_hpromise(thr, 2);
+	DUK_ASSERT(res != NULL);
+	is_all = duk_is_object(thr, 3); /* values array only exists for all() */
+
+	if (!duk_is_object(thr, 0) && !duk_is_string(thr, 0)) {
+		DUK_ERROR_TYPE_INVALID_ARGS(thr);
+		DUK_WO_NORETURN(return 0;);
+	}
+	len = (duk_uint_t) duk_get_length(thr, 0);
+	for (i = 0; i < len; i++) {
+		duk_hpromise *next;
+		duk_promise_job *job;
+
+		(void) duk_get_prop_index(thr, 0, (duk_uarridx_t) i);
+		next = duk__promise_resolve_top(thr, 1);
+		(void) duk_get_prop_stridx_short(thr, -1, DUK_STRIDX_THEN);
+
+		/* [ iterable this result values/undefined resolve/undefined reject/undefined next then ] */
+
+		if (!duk__promise_is_builtin_then(thr, 7)) {
+			/* Call the custom then() with the resolve/reject functions
+			 * of the result Promise for race(), or those of an
+			 * intermediate Promise for all().  A single pair is shared
+			 * by all race() elements so that it's only used once.
+			 */
+			if (is_all) {
+				next = duk__promise_push_new(thr);
+				duk__promise_push_resolving_functions(thr, next);
+				duk_dup(thr, 7);
+				duk_dup(thr, 6);
+				duk_dup(thr, 9);
+				duk_dup(thr, 10);
+			} else {
+				if (duk_is_undefined(thr, 4)) {
+					duk__promise_push_resolving_functions(thr, res);
+					duk_replace(thr, 5);
+					duk_replace(thr, 4);
+				}
+				duk_dup(thr, 7);
+				duk_dup(thr, 6);
+				duk_dup(thr, 4);
+				duk_dup(thr, 5);
+			}
+			duk_call_method(thr, 2 /*nargs*/);
+			if (!is_all) {
+				duk_set_top(thr, 6);
+				continue;
+			}
+		}
+
+		job = duk__promise_job_alloc(thr, is_all ? DUK_PROMISE_JOB_ALL_ELEMENT : DUK_PROMISE_JOB_REACTION, res);
+		if (is_all) {
+			duk__promise_job_set_tval(thr, &job->handler_f, DUK_GET_TVAL_POSIDX(thr, 3));
+			job->index = (duk_uint32_t) i;
+			res->all_remaining++;
+		}
+		duk__promise_add_reaction(thr, next, job);
+		duk_set_top(thr, 6);
+	}
+
+	if (is_all) {
+		DUK_ASSERT(res->all_remaining > 0);
+		if (--res->all_remaining == 0) {
+			duk__promise_resolve(thr, res, 3);
+		}
+	}
+	return 0;
+}
+
+DUK_LOCAL duk_ret_t duk__promise_all_race(duk_hthread *thr, duk_bool_t is_all) {
+	duk_hpromise *res;
+
+	duk_set_top(thr, 1);
+	duk_push_this(thr);
+	res = duk__promise_push_new(thr);
+	if (is_all) {
+		/* Count starts at 1 so that the result can't resolve while
+		 * the elements are being processed.
+		 */
+		res->all_remaining = 1;
+		duk_push_array(thr);
+	} else {
+		duk_push_undefined(thr);
+	}
+	duk_push_undefined(thr); /* race() shared resolve/reject pair */
+	duk_push_undefined(thr);
+
+	/* [ iterable this result values/undefined undefined undefined ] */
+
+	if (duk_safe_call(thr, duk__promise_all_race_raw, NULL /*udata*/, 0 /*nargs*/, 1 /*nrets*/) != DUK_EXEC_SUCCESS) {
+		duk__promise_settle(thr, res, -1, 1 /*rejected*/);
+	}
+	duk_set_top(thr, 3);
+	return 1;
 }
 
+DUK_INTERNAL duk_ret_t duk_bi_promise_all(duk_hthread *thr) {
+	return duk__promise_all_race(thr, 1 /*is_all*/);
+}
+
+DUK_INTERNAL duk_ret_t duk_bi_promise_race(duk_hthread *thr) {
+	return duk__promise_all_race(thr, 0 /*is_all*/);
+}
+
+/* Promise.try(), https://github.com/tc39/proposal-promise-try. */
+DUK_INTERNAL duk_ret_t duk_bi_promise_try(duk_hthread *thr) {
+	duk_hpromise *p;
+	duk_idx_t nargs;
+
+	nargs = duk_get_top(thr);
+	if (nargs == 0) {
+		duk_push_undefined(thr);
+		nargs++;
+	}
+	p = duk__promise_push_new(thr);
+	duk_insert(thr, 0);
+	duk_push_undefined(thr);
+	duk_insert(thr, 2);
+
+	/* [ promise func undefined args ] */
+
+	if (duk_pcall_method(thr, nargs - 1) == DUK_EXEC_SUCCESS) {
+		duk__promise_resolve(thr, p, 1);
+	} else {
+		duk__promise_settle(thr, p, 1, 1 /*rejected*/);
+	}
+	duk_set_top(thr, 1);
+	return 1;
+}
+
+/*
+ *  Prototype methods
+ */
+
 DUK_INTERNAL duk_ret_t duk_bi_promise_catch(duk_hthread *thr) {
-	DUK_ERROR_TYPE(thr, "unimplemented");
-	DUK_WO_NORETURN(return 0;);
+	/* Invoke(promise, "then", undefined, onRejected), then() may be
+	 * overridden.
+	 */
+	duk_push_this(thr);
+	(void) duk_get_prop_stridx_short(thr, -1, DUK_STRIDX_THEN);
+	duk_swap_top(thr, -2);
+	duk_push_undefined(thr);
+	duk_dup_0(thr);
+	duk_call_method(thr, 2 /*nargs*/);
+	return 1;
 }
 
 DUK_INTERNAL duk_ret_t duk_bi_promise_then(duk_hthread *thr) {
-	DUK_ERROR_TYPE(thr, "unimplemented");
-	DUK_WO_NORETURN(return 0;);
+	duk_hpromise *p;
+	duk_hpromise *res;
+	duk_promise_job *job;
+
+	p = duk__promise_push_this(thr);
+	res = duk__promise_push_new(thr);
+
+	/* [ onFulfilled onRejected this result ] */
+
+	job = duk__promise_job_alloc(thr, DUK_PROMISE_JOB_REACTION, res);
+	if (duk_is_callable(thr, 0)) {
+		duk__promise_job_set_tval(thr, &job->handler_f, DUK_GET_TVAL_POSIDX(thr, 0));
+	}
+	if (duk_is_callable(thr, 1)) {
+		duk__promise_job_set_tval(thr, &job->handler_r, DUK_GET_TVAL_POSIDX(thr, 1));
+	}
+	duk__promise_add_reaction(thr, p, job);
+	return 1;
 }
 
 #endif /* DUK_USE_PROMISE_BUILTIN */
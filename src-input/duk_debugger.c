@@ -148,6 +148,13 @@ DUK_LOCAL duk_uint_t duk__debug_htype_to_fake_class(duk_uint_t htype) {
 		return DUK_FAKE_CLASS_THREAD;
 	case DUK_HTYPE_PROXY:
 		return DUK_FAKE_CLASS_OBJECT;
+	case DUK_HTYPE_MAP:
+	case DUK_HTYPE_SET:
+	case DUK_HTYPE_WEAKMAP:
+	case DUK_HTYPE_WEAKSET:
+		return DUK_FAKE_CLASS_OBJECT;
+	case DUK_HTYPE_PROMISE:
+		return DUK_FAKE_CLASS_OBJECT;
 	case DUK_HTYPE_NONE:
 		return DUK_FAKE_CLASS_NONE;
 	case DUK_HTYPE_ARRAYBUFFER:
@@ -2456,6 +2463,13 @@ DUK_LOCAL void duk__debug_handle_get_heap_obj_info(duk_hthread *thr, duk_heap *h
 	}
 	case DUK_HTYPE_PROXY:
 		break;
+	case DUK_HTYPE_MAP:
+	case DUK_HTYPE_SET:
+	case DUK_HTYPE_WEAKMAP:
+	case DUK_HTYPE_WEAKSET:
+		break;
+	case DUK_HTYPE_PROMISE:
+		break;
 	case DUK_HTYPE_NONE:
 		break;
 	case DUK_HTYPE_ARRAYBUFFER:
@@ -30,6 +30,10 @@ struct duk_hbufobj;
 struct duk_hdecenv;
 struct duk_hobjenv;
 struct duk_hproxy;
+struct duk_hmap;
+struct duk_hpromise;
+struct duk_promise_job;
+struct duk_hshape;
 struct duk_hbuffer;
 struct duk_hbuffer_fixed;
 struct duk_hbuffer_dynamic;
@@ -46,6 +50,8 @@ struct duk_catcher;
 struct duk_ljstate;
 struct duk_strcache_entry;
 struct duk_litcache_entry;
+struct duk_re_cache_entry;
+struct duk_icache_entry;
 struct duk_strtab_entry;
 
 #if defined(DUK_USE_DEBUG)
@@ -90,6 +96,10 @@ typedef struct duk_hbufobj duk_hbufobj;
 typedef struct duk_hdecenv duk_hdecenv;
 typedef struct duk_hobjenv duk_hobjenv;
 typedef struct duk_hproxy duk_hproxy;
+typedef struct duk_hmap duk_hmap;
+typedef struct duk_hpromise duk_hpromise;
+typedef struct duk_promise_job duk_promise_job;
+typedef struct duk_hshape duk_hshape;
 typedef struct duk_hbuffer duk_hbuffer;
 typedef struct duk_hbuffer_fixed duk_hbuffer_fixed;
 typedef struct duk_hbuffer_dynamic duk_hbuffer_dynamic;
@@ -106,6 +116,8 @@ typedef struct duk_catcher duk_catcher;
 typedef struct duk_ljstate duk_ljstate;
 typedef struct duk_strcache_entry duk_strcache_entry;
 typedef struct duk_litcache_entry duk_litcache_entry;
+typedef struct duk_re_cache_entry duk_re_cache_entry;
+typedef struct duk_icache_entry duk_icache_entry;
 typedef struct duk_strtab_entry duk_strtab_entry;
 
 #if defined(DUK_USE_DEBUG)
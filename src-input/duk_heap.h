@@ -83,6 +83,13 @@
  */
 #define DUK_MS_FLAG_NO_OBJECT_COMPACTION (1U << 2)
 
+/* Voluntary collection: the first collection attempt of an allocation slow
+ * path.  Allows a minor (nursery only) collection or an incremental step
+ * instead of a full collection; explicit and emergency collections are
+ * always full.
+ */
+#define DUK_MS_FLAG_VOLUNTARY (1U << 3)
+
 /*
  *  Thread switching
  *
@@ -139,6 +146,34 @@
 #define DUK_HEAP_MARK_AND_SWEEP_TRIGGER_SKIP 256L
 #endif
 
+/* Generational GC: voluntary collections are minor collections triggered
+ * at most NURSERY_TRIGGER counts apart.  A full collection is done instead
+ * once the minor collections since the previous one cover the interval a
+ * full collection would normally use, so that garbage only a full collection
+ * can find (old reference cycles, weak collection entries) is bounded as
+ * without generations.
+ */
+#if defined(DUK_USE_GENERATIONAL_GC)
+#define DUK_HEAP_GENGC_NURSERY_TRIGGER 65536L
+#endif
+
+/* Incremental GC: once a voluntary collection is due, a cycle is started
+ * and then advanced by one step every STEP_INTERVAL trigger counts.  A step
+ * marks or sweeps up to STEP_WORK objects.  INCR_* are the cycle phases.
+ */
+#if defined(DUK_USE_INCREMENTAL_GC)
+#define DUK_HEAP_INCR_STEP_INTERVAL 1024L
+#define DUK_HEAP_INCR_STEP_WORK     4096L
+#define DUK_HEAP_INCR_IDLE          0
+#define DUK_HEAP_INCR_MARK          1
+#define DUK_HEAP_INCR_SWEEP         2
+#endif
+
+/* Number of pointers in a free batch handed to DUK_USE_GC_FREE_BATCH(). */
+#if defined(DUK_USE_GC_FREE_BATCH)
+#define DUK_HEAP_FREE_BATCH_SIZE 1024L
+#endif
+
 /* GC torture. */
 #if defined(DUK_USE_GC_TORTURE)
 #define DUK_GC_TORTURE(heap) \
@@ -337,6 +372,39 @@ struct duk_litcache_entry {
 	duk_hstring *h;
 };
 
+/*
+ *  Compiled RegExp cache
+ */
+
+/* Maps an interned (pattern, flags) string pair to the escaped source and
+ * bytecode produced by duk_regexp_compile().  All references are strong and
+ * the entries are mark-and-sweep roots.  Entries are kept in MRU order, the
+ * last entry is evicted when the cache is full.
+ */
+struct duk_re_cache_entry {
+	duk_hstring *pattern;
+	duk_hstring *flags;
+	duk_hstring *source;
+	duk_hbuffer *bytecode;
+};
+
+/*
+ *  Property inline cache
+ */
+
+#define DUK_HEAP_ICACHE_WAYS 2
+
+/* Entry is keyed by the instruction address (shifted, masked).  Both 'pc'
+ * and 'key' are weak, identity-only references: a hit is always validated
+ * against the current object property table so no GC handling is needed.
+ */
+struct duk_icache_entry {
+	const duk_instr_t *pc;
+	duk_hstring *key;
+	duk_uint32_t slot[DUK_HEAP_ICACHE_WAYS];
+	duk_uint8_t depth[DUK_HEAP_ICACHE_WAYS];
+};
+
 /*
  *  Main heap structure
  */
@@ -419,6 +487,58 @@ struct duk_heap {
 	 */
 	duk_uint_t ms_recursion_depth;
 
+#if defined(DUK_USE_GENERATIONAL_GC)
+	/* Generational GC state.  'ms_minor' is set while a minor collection
+	 * is running and 'ms_nursery_end' is then the first old object in
+	 * heap_allocated (NULL otherwise).  The rest track the heap size
+	 * and the minor collections done since the last full collection.
+	 */
+	duk_small_uint_t ms_minor;
+	duk_heaphdr *ms_nursery_end;
+	duk_size_t ms_full_keep;
+	duk_size_t ms_promoted;
+	duk_uint_t ms_minor_count;
+#endif
+
+#if defined(DUK_USE_INCREMENTAL_GC)
+	/* Incremental GC state.  'ms_gray' is a stack of gray objects (marked
+	 * REACHABLE and TEMPROOT, children not yet marked).  Gray objects
+	 * freed by refcounting while marking are queued to 'ms_incr_deferred'
+	 * and freed once marking is done so that stack entries stay valid.
+	 * 'ms_incr_cursor' is the next object to sweep, 'ms_incr_flags' the
+	 * DUK_MS_FLAG_xxx flags for sweeping, and 'ms_incr_keep' the number of
+	 * objects kept so far.  'ms_incr_trial' is set while marking restores
+	 * refcounts removed by trial deletion.
+	 */
+	duk_small_uint_t ms_incr_phase;
+	duk_small_uint_t ms_incr_trial;
+	duk_small_uint_t ms_incr_flags;
+	duk_heaphdr **ms_gray;
+	duk_size_t ms_gray_top;
+	duk_size_t ms_gray_size;
+	duk_heaphdr *ms_incr_deferred;
+	duk_heaphdr *ms_incr_cursor;
+	duk_size_t ms_incr_keep;
+#endif
+
+#if defined(DUK_USE_GC_FREE_BATCH)
+	/* Pending free batch while sweeping, NULL otherwise.  Frees made
+	 * while non-NULL are collected here and the full batch is handed
+	 * to the application instead of calling free_func directly.
+	 */
+	void **free_batch;
+	duk_size_t free_batch_count;
+#endif
+
+#if defined(DUK_USE_COLLECTION_BUILTINS)
+	/* Reachable WeakMap/WeakSet instances found during marking, linked
+	 * through duk_hmap 'ms_next'.  The last collection on the list points
+	 * to itself so that a non-NULL 'ms_next' means "already listed".
+	 * NULL outside of mark-and-sweep and incremental marking.
+	 */
+	duk_hmap *ms_weak_list;
+#endif
+
 	/* Mark-and-sweep flags automatically active (used for critical sections). */
 	duk_small_uint_t ms_base_flags;
 
@@ -494,6 +614,14 @@ struct duk_heap {
 	/* Heap level "stash" object (e.g., various reachability roots). */
 	duk_hobject *heap_object;
 
+#if defined(DUK_USE_PROMISE_BUILTIN)
+	/* Promise job queue, FIFO.  Jobs hold counted references and are
+	 * reachability roots.  Drained by the application via duk_run_jobs().
+	 */
+	duk_promise_job *job_head;
+	duk_promise_job *job_tail;
+#endif
+
 	/* duk_handle_call / duk_handle_safe_call recursion depth limiting */
 	duk_int_t call_recursion_depth;
 	duk_int_t call_recursion_limit;
@@ -563,6 +691,14 @@ struct duk_heap {
 	duk_bool_t dbg_have_next_byte;
 	duk_uint8_t dbg_next_byte;
 #endif /* DUK_USE_DEBUGGER_SUPPORT */
+
+	/* Sampling profiler state. */
+#if defined(DUK_USE_PROFILER)
+	duk_hobject *prof_stacks; /* collapsed stack string -> sample count, gc reachable */
+	duk_uint32_t prof_interval; /* sampling interval in executed instructions, 0 = not sampling */
+	duk_uint32_t prof_opcodes[256]; /* samples per opcode about to be executed */
+#endif
+
 #if defined(DUK_USE_ASSERTIONS)
 	duk_bool_t dbg_calling_transport; /* transport call in progress, calling into Duktape forbidden */
 #endif
@@ -593,6 +729,22 @@ struct duk_heap {
 	duk_litcache_entry litcache[DUK_USE_LITCACHE_SIZE];
 #endif
 
+#if defined(DUK_USE_REGEXP_CACHE_SIZE)
+	/* Compiled RegExp cache: [0,re_cache_count[ gc reachable, MRU first. */
+	duk_re_cache_entry re_cache[DUK_USE_REGEXP_CACHE_SIZE];
+	duk_small_uint_t re_cache_count;
+#endif
+
+#if defined(DUK_USE_INLINE_CACHE_SIZE)
+	/* Property inline cache for executor GETPROP/PUTPROP instructions. */
+	duk_icache_entry icache[DUK_USE_INLINE_CACHE_SIZE];
+#endif
+
+#if defined(DUK_USE_HOBJECT_SHAPES)
+	/* Root of the shape transition tree (empty layout), never freed. */
+	duk_hshape shape_root;
+#endif
+
 	/* Built-in strings. */
 #if defined(DUK_USE_ROM_STRINGS)
 	/* No field needed when strings are in ROM. */
@@ -608,6 +760,10 @@ struct duk_heap {
 #if defined(DUK_USE_DEBUG)
 	duk_int_t stats_exec_opcodes;
 	duk_int_t stats_exec_opcode[256];
+#if defined(DUK_USE_DEBUG_OPCODE_PAIRS)
+	duk_int_t stats_exec_opcode_pair[256][256]; /* [prev][curr] */
+	duk_small_uint_t stats_exec_prev_opcode;
+#endif
 	duk_int_t stats_exec_interrupt;
 	duk_int_t stats_exec_throw;
 	duk_int_t stats_call_all;
@@ -641,6 +797,10 @@ struct duk_heap {
 	duk_int_t stats_putvalue_idxkey_count;
 	duk_int_t stats_set_strkey_count;
 	duk_int_t stats_set_idxkey_count;
+	duk_int_t stats_icache_get_hit;
+	duk_int_t stats_icache_get_miss;
+	duk_int_t stats_icache_put_hit;
+	duk_int_t stats_icache_put_miss;
 
 	duk_int_t stats_getownpropdesc_count;
 	duk_int_t stats_getownpropdesc_hit;
@@ -742,6 +902,10 @@ DUK_INTERNAL_DECL void *duk_heap_mem_alloc_checked_zeroed(duk_hthread *thr, duk_
 DUK_INTERNAL_DECL void *duk_heap_mem_realloc(duk_heap *heap, void *ptr, duk_size_t newsize);
 DUK_INTERNAL_DECL void *duk_heap_mem_realloc_indirect(duk_heap *heap, duk_mem_getptr cb, void *ud, duk_size_t newsize);
 DUK_INTERNAL_DECL void duk_heap_mem_free(duk_heap *heap, void *ptr);
+#if defined(DUK_USE_GC_FREE_BATCH)
+DUK_INTERNAL_DECL void duk_heap_free_batch_begin(duk_heap *heap);
+DUK_INTERNAL_DECL void duk_heap_free_batch_end(duk_heap *heap);
+#endif
 
 DUK_INTERNAL_DECL void duk_heap_free_freelists(duk_heap *heap);
 
@@ -751,6 +915,10 @@ DUK_INTERNAL_DECL void duk_heap_process_finalize_list(duk_heap *heap);
 #endif /* DUK_USE_FINALIZER_SUPPORT */
 
 DUK_INTERNAL_DECL void duk_heap_mark_and_sweep(duk_heap *heap, duk_small_uint_t flags);
+#if defined(DUK_USE_INCREMENTAL_GC)
+DUK_INTERNAL_DECL duk_bool_t duk_heap_mark_and_sweep_step(duk_heap *heap, duk_size_t budget);
+DUK_INTERNAL_DECL duk_bool_t duk_heap_mark_and_sweep_defer_free(duk_heap *heap, duk_heaphdr *hdr);
+#endif
 
 DUK_INTERNAL_DECL duk_uint32_t duk_heap_hashstring(duk_heap *heap, const duk_uint8_t *str, duk_size_t len);
 
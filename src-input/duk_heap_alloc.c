@@ -23,6 +23,19 @@ DUK_INTERNAL duk_heap *duk_debug_global_heap_singleton = NULL;
  *  been already dealt with.
  */
 
+#if defined(DUK_USE_PROMISE_BUILTIN)
+/* Free a list of Promise job records.  Any references they hold have been
+ * dealt with by the caller.
+ */
+DUK_LOCAL void duk__free_promise_jobs(duk_heap *heap, duk_promise_job *job) {
+	while (job != NULL) {
+		duk_promise_job *next = job->next;
+		DUK_FREE(heap, (void *) job);
+		job = next;
+	}
+}
+#endif
+
 DUK_INTERNAL void duk_free_hobject(duk_heap *heap, duk_hobject *h) {
 	DUK_ASSERT(heap != NULL);
 	DUK_ASSERT(h != NULL);
@@ -30,6 +43,11 @@ DUK_INTERNAL void duk_free_hobject(duk_heap *heap, duk_hobject *h) {
 	DUK_FREE(heap, duk_hobject_get_strprops(heap, h));
 #if defined(DUK_USE_HOBJECT_HASH_PART)
 	DUK_FREE(heap, duk_hobject_get_strhash(heap, h));
+#endif
+#if defined(DUK_USE_HOBJECT_SHAPES)
+	if (DUK_HOBJECT_HAS_SHAPED(h)) {
+		duk_hshape_decref(heap, h->shape);
+	}
 #endif
 	DUK_FREE(heap, duk_hobject_get_idxprops(heap, h));
 	DUK_FREE(heap, h->idx_hash);
@@ -82,6 +100,16 @@ DUK_INTERNAL void duk_free_hobject(duk_heap *heap, duk_hobject *h) {
 		duk_hboundfunc *f = (duk_hboundfunc *) (void *) h;
 
 		DUK_FREE(heap, f->args);
+#if defined(DUK_USE_COLLECTION_BUILTINS)
+	} else if (DUK_HOBJECT_IS_HMAP(h)) {
+		duk_hmap *m = (duk_hmap *) h;
+
+		DUK_FREE(heap, m->entries);
+#endif
+#if defined(DUK_USE_PROMISE_BUILTIN)
+	} else if (DUK_HOBJECT_IS_PROMISE(h)) {
+		duk__free_promise_jobs(heap, ((duk_hpromise *) h)->reactions);
+#endif
 	}
 
 	DUK_FREE(heap, (void *) h);
@@ -422,6 +450,14 @@ DUK_INTERNAL void duk_heap_free(duk_heap *heap) {
 	DUK_D(DUK_DPRINT("freeing temporary freelists"));
 	duk_heap_free_freelists(heap);
 
+#if defined(DUK_USE_PROMISE_BUILTIN)
+	/* Pending Promise jobs are never run. */
+	DUK_D(DUK_DPRINT("freeing promise job queue of heap: %p", (void *) heap));
+	duk__free_promise_jobs(heap, heap->job_head);
+	heap->job_head = NULL;
+	heap->job_tail = NULL;
+#endif
+
 	DUK_D(DUK_DPRINT("freeing heap_allocated of heap: %p", (void *) heap));
 	duk__free_allocated(heap);
 
@@ -434,6 +470,18 @@ DUK_INTERNAL void duk_heap_free(duk_heap *heap) {
 	duk__free_finalize_list(heap);
 #endif
 
+#if defined(DUK_USE_INCREMENTAL_GC)
+	/* Forced collections above completed any incremental cycle. */
+	DUK_ASSERT(heap->ms_incr_phase == DUK_HEAP_INCR_IDLE);
+	DUK_ASSERT(heap->ms_incr_deferred == NULL);
+	if (heap->ms_gray != NULL) {
+		DUK_FREE_RAW(heap, heap->ms_gray);
+	}
+#endif
+#if defined(DUK_USE_GC_FREE_BATCH)
+	DUK_ASSERT(heap->free_batch == NULL);
+#endif
+
 	DUK_D(DUK_DPRINT("freeing string table of heap: %p", (void *) heap));
 	duk__free_stringtable(heap);
 
@@ -725,6 +773,13 @@ DUK_LOCAL void duk__dump_type_sizes(void) {
 	DUK__DUMPSZ(duk_catcher);
 	DUK__DUMPSZ(duk_strcache_entry);
 	DUK__DUMPSZ(duk_litcache_entry);
+#if defined(DUK_USE_REGEXP_CACHE_SIZE)
+	DUK__DUMPSZ(duk_re_cache_entry);
+#endif
+	DUK__DUMPSZ(duk_icache_entry);
+#if defined(DUK_USE_HOBJECT_SHAPES)
+	DUK__DUMPSZ(duk_hshape);
+#endif
 	DUK__DUMPSZ(duk_ljstate);
 	DUK__DUMPSZ(duk_fixedbuffer);
 	DUK__DUMPSZ(duk_bitdecoder_ctx);
@@ -973,6 +1028,24 @@ duk_heap *duk_heap_alloc(duk_alloc_function alloc_func,
 	res->heap_thread = NULL;
 	res->curr_thread = NULL;
 	res->heap_object = NULL;
+#if defined(DUK_USE_COLLECTION_BUILTINS)
+	res->ms_weak_list = NULL;
+#endif
+#if defined(DUK_USE_GENERATIONAL_GC)
+	res->ms_nursery_end = NULL;
+#endif
+#if defined(DUK_USE_INCREMENTAL_GC)
+	res->ms_gray = NULL;
+	res->ms_incr_deferred = NULL;
+	res->ms_incr_cursor = NULL;
+#endif
+#if defined(DUK_USE_GC_FREE_BATCH)
+	res->free_batch = NULL;
+#endif
+#if defined(DUK_USE_PROMISE_BUILTIN)
+	res->job_head = NULL;
+	res->job_tail = NULL;
+#endif
 #if defined(DUK_USE_STRTAB_PTRCOMP)
 	res->strtable16 = NULL;
 #else
@@ -1002,6 +1075,9 @@ duk_heap *duk_heap_alloc(duk_alloc_function alloc_func,
 	res->dbg_udata = NULL;
 	res->dbg_pause_act = NULL;
 #endif
+#if defined(DUK_USE_PROFILER)
+	res->prof_stacks = NULL;
+#endif
 #endif /* DUK_USE_EXPLICIT_NULL_INIT */
 
 	res->alloc_func = alloc_func;
@@ -1126,6 +1202,55 @@ duk_heap *duk_heap_alloc(duk_alloc_function alloc_func,
 #endif
 #endif /* DUK_USE_LITCACHE_SIZE */
 
+	/*
+	 *  Init compiled RegExp cache
+	 */
+#if defined(DUK_USE_REGEXP_CACHE_SIZE)
+	DUK_ASSERT(DUK_USE_REGEXP_CACHE_SIZE > 0);
+	res->re_cache_count = 0;
+#if defined(DUK_USE_EXPLICIT_NULL_INIT)
+	{
+		duk_uint_t i;
+		for (i = 0; i < DUK_USE_REGEXP_CACHE_SIZE; i++) {
+			res->re_cache[i].pattern = NULL;
+			res->re_cache[i].flags = NULL;
+			res->re_cache[i].source = NULL;
+			res->re_cache[i].bytecode = NULL;
+		}
+	}
+#endif
+#endif /* DUK_USE_REGEXP_CACHE_SIZE */
+
+	/*
+	 *  Init property inline cache
+	 */
+#if defined(DUK_USE_INLINE_CACHE_SIZE)
+	DUK_ASSERT(DUK_USE_INLINE_CACHE_SIZE > 0);
+	DUK_ASSERT(DUK_IS_POWER_OF_TWO((duk_uint_t) DUK_USE_INLINE_CACHE_SIZE));
+#if defined(DUK_USE_EXPLICIT_NULL_INIT)
+	{
+		duk_uint_t i;
+		for (i = 0; i < DUK_USE_INLINE_CACHE_SIZE; i++) {
+			res->icache[i].pc = NULL;
+			res->icache[i].key = NULL;
+		}
+	}
+#endif
+#endif /* DUK_USE_INLINE_CACHE_SIZE */
+
+	/*
+	 *  Init shape transition tree root
+	 */
+#if defined(DUK_USE_HOBJECT_SHAPES)
+	res->shape_root.refcount = 1; /* never reaches zero */
+	res->shape_root.nkeys = 0;
+#if defined(DUK_USE_EXPLICIT_NULL_INIT)
+	res->shape_root.parent = NULL;
+	res->shape_root.child = NULL;
+	res->shape_root.sibling = NULL;
+#endif
+#endif /* DUK_USE_HOBJECT_SHAPES */
+
 	/* XXX: error handling is incomplete.  It would be cleanest if
 	 * there was a setjmp catchpoint, so that all init code could
 	 * freely throw errors.  If that were the case, the return code
@@ -176,8 +176,14 @@ DUK_INTERNAL void duk_heap_process_finalize_list(duk_heap *heap) {
 		DUK_DD(DUK_DDPRINT("processing finalize_list entry: %p -> %!iO", (void *) curr, curr));
 
 		DUK_ASSERT(DUK_HEAPHDR_IS_ANY_OBJECT(curr)); /* Only objects have finalizers. */
+#if defined(DUK_USE_INCREMENTAL_GC)
+		/* Incremental marking may mark objects on finalize_list. */
+		DUK_ASSERT(heap->ms_incr_phase == DUK_HEAP_INCR_MARK ||
+		           (!DUK_HEAPHDR_HAS_REACHABLE(curr) && !DUK_HEAPHDR_HAS_TEMPROOT(curr)));
+#else
 		DUK_ASSERT(!DUK_HEAPHDR_HAS_REACHABLE(curr));
 		DUK_ASSERT(!DUK_HEAPHDR_HAS_TEMPROOT(curr));
+#endif
 		DUK_ASSERT(DUK_HEAPHDR_HAS_FINALIZABLE(
 		    curr)); /* All objects on finalize_list will have this flag (except object being finalized right now). */
 		DUK_ASSERT(!DUK_HEAPHDR_HAS_FINALIZED(curr)); /* Queueing code ensures. */
@@ -286,7 +292,14 @@ DUK_INTERNAL void duk_heap_process_finalize_list(duk_heap *heap) {
 			DUK_ASSERT(DUK_HEAPHDR_IS_ANY_OBJECT(curr)); /* currently, always the case */
 			DUK_DD(DUK_DDPRINT("refcount finalize after finalizer call: %!O", curr));
 			duk_hobject_refcount_finalize_norz(heap, (duk_hobject *) curr);
-			duk_free_hobject(heap, (duk_hobject *) curr);
+#if defined(DUK_USE_INCREMENTAL_GC)
+			if (heap->ms_incr_phase == DUK_HEAP_INCR_MARK && duk_heap_mark_and_sweep_defer_free(heap, curr)) {
+				/* Freed when incremental marking is done. */
+			} else
+#endif
+			{
+				duk_free_hobject(heap, (duk_hobject *) curr);
+			}
 			DUK_DD(DUK_DDPRINT("freed hobject after finalization: %p", (void *) curr));
 		}
 #else /* DUK_USE_REFERENCE_COUNTING */
@@ -8,6 +8,23 @@ DUK_LOCAL_DECL void duk__mark_heaphdr(duk_heap *heap, duk_heaphdr *h);
 DUK_LOCAL_DECL void duk__mark_heaphdr_nonnull(duk_heap *heap, duk_heaphdr *h);
 DUK_LOCAL_DECL void duk__mark_tval(duk_heap *heap, duk_tval *tv);
 DUK_LOCAL_DECL void duk__mark_tvals(duk_heap *heap, duk_tval *tv, duk_idx_t count);
+#if defined(DUK_USE_PROMISE_BUILTIN)
+DUK_LOCAL_DECL void duk__mark_promise_jobs(duk_heap *heap, duk_promise_job *job);
+#endif
+#if defined(DUK_USE_INCREMENTAL_GC)
+DUK_LOCAL_DECL void duk__incr_push_gray(duk_heap *heap, duk_heaphdr *h);
+#endif
+
+/* Trial marking restores refcounts removed by trial deletion, see minor
+ * collections and the incremental GC finish step.
+ */
+#if defined(DUK_USE_GENERATIONAL_GC)
+#define DUK__MS_IS_TRIAL(heap) ((heap)->ms_minor != 0)
+#elif defined(DUK_USE_INCREMENTAL_GC)
+#define DUK__MS_IS_TRIAL(heap) ((heap)->ms_incr_trial != 0)
+#else
+#define DUK__MS_IS_TRIAL(heap) 0
+#endif
 
 /*
  *  Marking functions for heap types: mark children recursively.
@@ -161,6 +178,30 @@ DUK_LOCAL void duk__mark_hobject(duk_heap *heap, duk_hobject *h) {
 		duk__mark_heaphdr_nonnull(heap, (duk_heaphdr *) p->target);
 		duk__mark_heaphdr_nonnull(heap, (duk_heaphdr *) p->handler);
 #endif /* DUK_USE_ES6_PROXY */
+#if defined(DUK_USE_COLLECTION_BUILTINS)
+	} else if (DUK_HOBJECT_IS_HMAP(h)) {
+		duk_hmap *m = (duk_hmap *) h;
+		DUK_HMAP_ASSERT_VALID(m);
+		if (DUK_HMAP_IS_WEAK(m) && !DUK__MS_IS_TRIAL(heap)) {
+			/* Entries are ephemerons, handled once marking from
+			 * the roots is complete.  Trial marking treats them
+			 * as strong references.
+			 */
+			if (m->ms_next == NULL) {
+				m->ms_next = (heap->ms_weak_list != NULL ? heap->ms_weak_list : m);
+				heap->ms_weak_list = m;
+			}
+		} else {
+			duk__mark_tvals(heap, m->entries, (duk_idx_t) (m->e_next * DUK_HMAP_GET_STRIDE(m)));
+		}
+#endif /* DUK_USE_COLLECTION_BUILTINS */
+#if defined(DUK_USE_PROMISE_BUILTIN)
+	} else if (DUK_HOBJECT_IS_PROMISE(h)) {
+		duk_hpromise *p = (duk_hpromise *) h;
+		DUK_HPROMISE_ASSERT_VALID(p);
+		duk__mark_tval(heap, &p->value);
+		duk__mark_promise_jobs(heap, p->reactions);
+#endif /* DUK_USE_PROMISE_BUILTIN */
 	} else if (DUK_HOBJECT_IS_THREAD(h)) {
 		duk_hthread *t = (duk_hthread *) h;
 		duk_activation *act;
@@ -212,11 +253,27 @@ DUK_LOCAL void duk__mark_heaphdr(duk_heap *heap, duk_heaphdr *h) {
 	DUK_HEAPHDR_ASSERT_VALID(h);
 	DUK_ASSERT(!DUK_HEAPHDR_HAS_READONLY(h) || DUK_HEAPHDR_HAS_REACHABLE(h));
 
+#if defined(DUK_USE_GENERATIONAL_GC) || defined(DUK_USE_INCREMENTAL_GC)
+	if (DUK__MS_IS_TRIAL(heap)) {
+		/* Trial marking: restore the edge removed by trial deletion.
+		 * Old (or already marked) objects are REACHABLE so only
+		 * unmarked objects are traversed; strings are never marked.
+		 */
+		if (DUK_HEAPHDR_NEEDS_REFCOUNT_UPDATE(h)) {
+			DUK_HEAPHDR_PREINC_REFCOUNT(h);
+		}
+		if (DUK_HEAPHDR_IS_ANY_STRING(h)) {
+			return;
+		}
+	} else
+#endif
+	{
 #if defined(DUK_USE_ASSERTIONS) && defined(DUK_USE_REFERENCE_COUNTING)
-	if (!DUK_HEAPHDR_HAS_READONLY(h)) {
-		h->h_assert_refcount++; /* Comparison refcount: bump even if already reachable. */
-	}
+		if (!DUK_HEAPHDR_HAS_READONLY(h)) {
+			h->h_assert_refcount++; /* Comparison refcount: bump even if already reachable. */
+		}
 #endif
+	}
 	if (DUK_HEAPHDR_HAS_REACHABLE(h)) {
 		DUK_DDD(DUK_DDDPRINT("already marked reachable, skip"));
 		return;
@@ -231,6 +288,17 @@ DUK_LOCAL void duk__mark_heaphdr(duk_heap *heap, duk_heaphdr *h) {
 	DUK_HEAPHDR_SET_REACHABLE(h);
 
 	if (heap->ms_recursion_depth >= DUK_USE_MARK_AND_SWEEP_RECLIMIT) {
+#if defined(DUK_USE_INCREMENTAL_GC)
+		if (heap->ms_incr_phase == DUK_HEAP_INCR_MARK && !DUK__MS_IS_TRIAL(heap)) {
+			/* Incremental marking: gray objects, strings and
+			 * buffers have no references to mark.
+			 */
+			if (DUK_HEAPHDR_IS_ANY_OBJECT(h)) {
+				duk__incr_push_gray(heap, h);
+			}
+			return;
+		}
+#endif
 		DUK_D(DUK_DPRINT("mark-and-sweep recursion limit reached, marking as temproot: %p", (void *) h));
 		DUK_HEAP_SET_MARKANDSWEEP_RECLIMIT_REACHED(heap);
 		DUK_HEAPHDR_SET_TEMPROOT(h);
@@ -289,6 +357,19 @@ DUK_LOCAL void duk__mark_tvals(duk_heap *heap, duk_tval *tv, duk_idx_t count) {
 	}
 }
 
+#if defined(DUK_USE_PROMISE_BUILTIN)
+/* Mark a list of Promise job records (pending reactions or queued jobs). */
+DUK_LOCAL void duk__mark_promise_jobs(duk_heap *heap, duk_promise_job *job) {
+	while (job != NULL) {
+		duk__mark_heaphdr_nonnull(heap, (duk_heaphdr *) job->target);
+		duk__mark_tval(heap, &job->handler_f);
+		duk__mark_tval(heap, &job->handler_r);
+		duk__mark_tval(heap, &job->value);
+		job = job->next;
+	}
+}
+#endif
+
 /* Mark any duk_heaphdr type, caller guarantees a non-NULL pointer. */
 DUK_LOCAL void duk__mark_heaphdr_nonnull(duk_heap *heap, duk_heaphdr *h) {
 	/* For now, just call the generic handler.  Change when call sites
@@ -317,11 +398,29 @@ DUK_LOCAL void duk__mark_roots_heap(duk_heap *heap) {
 	duk__mark_tval(heap, &heap->lj.value1);
 	duk__mark_tval(heap, &heap->lj.value2);
 
+#if defined(DUK_USE_PROMISE_BUILTIN)
+	duk__mark_promise_jobs(heap, heap->job_head);
+#endif
+
 #if defined(DUK_USE_DEBUGGER_SUPPORT)
 	for (i = 0; i < heap->dbg_breakpoint_count; i++) {
 		duk__mark_heaphdr(heap, (duk_heaphdr *) heap->dbg_breakpoints[i].filename);
 	}
 #endif
+
+#if defined(DUK_USE_PROFILER)
+	duk__mark_heaphdr(heap, (duk_heaphdr *) heap->prof_stacks);
+#endif
+
+#if defined(DUK_USE_REGEXP_CACHE_SIZE)
+	for (i = 0; i < heap->re_cache_count; i++) {
+		duk_re_cache_entry *e = heap->re_cache + i;
+		duk__mark_heaphdr_nonnull(heap, (duk_heaphdr *) e->pattern);
+		duk__mark_heaphdr_nonnull(heap, (duk_heaphdr *) e->flags);
+		duk__mark_heaphdr_nonnull(heap, (duk_heaphdr *) e->source);
+		duk__mark_heaphdr_nonnull(heap, (duk_heaphdr *) e->bytecode);
+	}
+#endif
 }
 
 /*
@@ -385,6 +484,11 @@ DUK_LOCAL void duk__mark_finalizable(duk_heap *heap) {
 	while (hdr != NULL) {
 		if (DUK_HEAPHDR_HAS_FINALIZABLE(hdr)) {
 			duk__mark_heaphdr_nonnull(heap, hdr);
+#if defined(DUK_USE_INCREMENTAL_GC)
+			if (DUK__MS_IS_TRIAL(heap)) {
+				DUK_HEAPHDR_PREDEC_REFCOUNT(hdr); /* A root isn't an edge. */
+			}
+#endif
 		}
 
 		hdr = DUK_HEAPHDR_GET_NEXT(heap, hdr);
@@ -461,6 +565,11 @@ DUK_LOCAL void duk__handle_temproot(duk_heap *heap, duk_heaphdr *hdr) {
 	hdr->h_assert_refcount--; /* Same node visited twice. */
 #endif
 	duk__mark_heaphdr_nonnull(heap, hdr);
+#if defined(DUK_USE_GENERATIONAL_GC) || defined(DUK_USE_INCREMENTAL_GC)
+	if (DUK__MS_IS_TRIAL(heap)) {
+		DUK_HEAPHDR_PREDEC_REFCOUNT(hdr); /* Same node visited twice. */
+	}
+#endif
 
 #if defined(DUK_USE_DEBUG)
 	(*count)++;
@@ -484,7 +593,12 @@ DUK_LOCAL void duk__mark_temproots_by_heap_scan(duk_heap *heap) {
 		DUK_HEAP_CLEAR_MARKANDSWEEP_RECLIMIT_REACHED(heap);
 
 		hdr = heap->heap_allocated;
+#if defined(DUK_USE_GENERATIONAL_GC)
+		/* Minor collections only have temproots in the nursery. */
+		while (hdr != heap->ms_nursery_end) {
+#else
 		while (hdr) {
+#endif
 #if defined(DUK_USE_DEBUG)
 			duk__handle_temproot(heap, hdr, &count);
 #else
@@ -511,6 +625,117 @@ DUK_LOCAL void duk__mark_temproots_by_heap_scan(duk_heap *heap) {
 	}
 }
 
+/*
+ *  Weak collection (WeakMap, WeakSet) handling.
+ *
+ *  Marking skips the entries of weak collections and only lists the
+ *  collections themselves.  Once marking from roots is otherwise complete,
+ *  a WeakMap value is marked if its key is reachable; this may make further
+ *  keys reachable so the process is repeated until nothing changes.  Keys
+ *  which are not heap allocated (e.g. lightfuncs) are always reachable.
+ *
+ *  Finally, entries whose keys are still unreachable are removed so that
+ *  the keys can be swept normally.
+ */
+
+#if defined(DUK_USE_COLLECTION_BUILTINS)
+DUK_LOCAL duk_bool_t duk__weak_key_is_reachable(duk_tval *tv_key) {
+	return (!DUK_TVAL_IS_HEAP_ALLOCATED(tv_key) || DUK_HEAPHDR_HAS_REACHABLE(DUK_TVAL_GET_HEAPHDR(tv_key)));
+}
+
+DUK_LOCAL void duk__mark_weak_collections(duk_heap *heap) {
+	duk_bool_t changed;
+
+	DUK_DD(DUK_DDPRINT("duk__mark_weak_collections: %p", (void *) heap));
+
+	do {
+		duk_hmap *m;
+
+		changed = 0;
+		for (m = heap->ms_weak_list; m != NULL; m = (m->ms_next != m ? m->ms_next : NULL)) {
+			duk_uint32_t i;
+
+			if (DUK_HMAP_GET_STRIDE(m) != 2U) {
+				continue;
+			}
+			for (i = 0; i < m->e_next; i++) {
+				duk_tval *tv_key = DUK_HMAP_GET_KEY(m, i);
+				duk_tval *tv_val = DUK_HMAP_GET_VALUE(m, i);
+				duk_heaphdr *h_val;
+
+				if (DUK_TVAL_IS_UNUSED(tv_key) || !DUK_TVAL_IS_HEAP_ALLOCATED(tv_val) ||
+				    !duk__weak_key_is_reachable(tv_key)) {
+					continue;
+				}
+				h_val = DUK_TVAL_GET_HEAPHDR(tv_val);
+				if (DUK_HEAPHDR_HAS_REACHABLE(h_val)) {
+					continue;
+				}
+				duk__mark_heaphdr_nonnull(heap, h_val);
+#if defined(DUK_USE_ASSERTIONS) && defined(DUK_USE_REFERENCE_COUNTING)
+				/* Counted in duk__purge_weak_collections(). */
+				h_val->h_assert_refcount--;
+#endif
+				changed = 1;
+			}
+		}
+
+		/* Marking may have hit the recursion limit, and may have added
+		 * collections to the head of the list.
+		 */
+		duk__mark_temproots_by_heap_scan(heap);
+	} while (changed);
+}
+
+DUK_LOCAL void duk__purge_weak_collections(duk_heap *heap) {
+	duk_hmap *m;
+	duk_hmap *next;
+
+	DUK_DD(DUK_DDPRINT("duk__purge_weak_collections: %p", (void *) heap));
+
+	for (m = heap->ms_weak_list; m != NULL; m = next) {
+		duk_uint32_t stride;
+		duk_uint32_t i;
+
+		stride = DUK_HMAP_GET_STRIDE(m);
+		for (i = 0; i < m->e_next; i++) {
+			duk_tval *tv_key = DUK_HMAP_GET_KEY(m, i);
+
+			if (DUK_TVAL_IS_UNUSED(tv_key)) {
+				continue;
+			}
+			if (!duk__weak_key_is_reachable(tv_key)) {
+				DUK_DDD(DUK_DDDPRINT("remove weak collection entry with unreachable key: %!T", tv_key));
+				duk_hmap_remove_index_norz(heap, m, i);
+				continue;
+			}
+#if defined(DUK_USE_ASSERTIONS) && defined(DUK_USE_REFERENCE_COUNTING)
+			/* Retained entries are counted references which
+			 * marking didn't see.
+			 */
+			{
+				duk_uint32_t j;
+
+				for (j = 0; j < stride; j++) {
+					duk_tval *tv = tv_key + j;
+
+					if (DUK_TVAL_IS_HEAP_ALLOCATED(tv) && !DUK_HEAPHDR_HAS_READONLY(DUK_TVAL_GET_HEAPHDR(tv))) {
+						DUK_TVAL_GET_HEAPHDR(tv)->h_assert_refcount++;
+					}
+				}
+			}
+#else
+			DUK_UNREF(stride);
+#endif
+		}
+
+		next = (m->ms_next != m ? m->ms_next : NULL);
+		m->ms_next = NULL;
+	}
+	heap->ms_weak_list = NULL;
+}
+#endif /* DUK_USE_COLLECTION_BUILTINS */
+
 /*
  *  Finalize refcounts for heap elements just about to be freed.
  *  This must be done for all objects before freeing to avoid any
@@ -619,7 +844,17 @@ DUK_LOCAL void duk__sweep_stringtable(duk_heap *heap, duk_size_t *out_count_keep
 			duk_hstring *next;
 			next = h->hdr.h_next;
 
+#if defined(DUK_USE_INCREMENTAL_GC)
+			/* Incremental marking may miss strings referenced
+			 * after their referrer was marked, but refcounts are
+			 * exact for live references after trial deletion.
+			 * Unreachable strings never have a higher refcount.
+			 */
+			if (DUK_HEAPHDR_HAS_REACHABLE((duk_heaphdr *) h) ||
+			    DUK_HEAPHDR_GET_REFCOUNT((duk_heaphdr *) h) > (DUK_HSTRING_HAS_PINNED_LITERAL(h) ? 1U : 0U)) {
+#else
 			if (DUK_HEAPHDR_HAS_REACHABLE((duk_heaphdr *) h)) {
+#endif
 				DUK_HEAPHDR_CLEAR_REACHABLE((duk_heaphdr *) h);
 				count_keep++;
 				prev = h;
@@ -784,10 +1019,16 @@ DUK_LOCAL void duk__sweep_heap(duk_heap *heap, duk_small_uint_t flags, duk_size_
 				duk_valstack_shrink_check_nothrow(thr_curr, flags & DUK_MS_FLAG_EMERGENCY /*snug*/);
 			}
 
+#if defined(DUK_USE_GENERATIONAL_GC)
+			/* Keep REACHABLE as a sticky old generation marker; it's
+			 * cleared for objects on finalize_list separately.
+			 */
+#else
 			DUK_HEAPHDR_CLEAR_REACHABLE(curr);
+			DUK_ASSERT(!DUK_HEAPHDR_HAS_REACHABLE(curr));
+#endif
 			/* Keep FINALIZED if set, used if rescue decisions are postponed. */
 			/* Keep FINALIZABLE for objects on finalize_list. */
-			DUK_ASSERT(!DUK_HEAPHDR_HAS_REACHABLE(curr));
 		} else {
 			/*
 			 *  Unreachable object:
@@ -1025,13 +1266,36 @@ DUK_LOCAL void duk__assert_walk_strtable(duk_heap *heap, duk__gc_hstring_assert
 
 DUK_LOCAL void duk__assert_heaphdr_flags_cb(duk_heap *heap, duk_heaphdr *h) {
 	DUK_UNREF(heap);
+#if !defined(DUK_USE_GENERATIONAL_GC)
 	DUK_ASSERT(!DUK_HEAPHDR_HAS_REACHABLE(h));
+#endif
 	DUK_ASSERT(!DUK_HEAPHDR_HAS_TEMPROOT(h));
 	DUK_ASSERT(!DUK_HEAPHDR_HAS_FINALIZABLE(h));
 	/* may have FINALIZED */
 }
+#if defined(DUK_USE_GENERATIONAL_GC)
+DUK_LOCAL void duk__assert_generations(duk_heap *heap) {
+	duk_heaphdr *curr;
+	duk_bool_t seen_old = 0;
+
+	/* Young (unmarked) objects must form a prefix of heap_allocated. */
+	for (curr = heap->heap_allocated; curr != NULL; curr = DUK_HEAPHDR_GET_NEXT(heap, curr)) {
+		if (DUK_HEAPHDR_HAS_REACHABLE(curr)) {
+			seen_old = 1;
+		} else {
+			DUK_ASSERT(!seen_old);
+		}
+	}
+	DUK_UNREF(seen_old);
+}
+#endif
 DUK_LOCAL void duk__assert_heaphdr_flags(duk_heap *heap) {
 	duk__assert_walk_list(heap, heap->heap_allocated, duk__assert_heaphdr_flags_cb);
+#if defined(DUK_USE_GENERATIONAL_GC)
+	duk__assert_generations(heap);
+	DUK_ASSERT(heap->ms_minor == 0);
+	DUK_ASSERT(heap->ms_nursery_end == NULL);
+#endif
 #if defined(DUK_USE_REFERENCE_COUNTING)
 	DUK_ASSERT(heap->refzero_list == NULL); /* Always handled to completion inline in DECREF. */
 #endif
@@ -1177,6 +1441,8 @@ DUK_LOCAL void duk__assert_litcache_nulls(duk_heap *heap) {
  */
 
 #if defined(DUK_USE_DEBUG)
+#define DUK__OPCODE_PAIR_TOP 16
+
 DUK_LOCAL void duk__dump_stats(duk_heap *heap) {
 	duk_uint_t i, j;
 
@@ -1223,6 +1489,40 @@ DUK_LOCAL void duk__dump_stats(duk_heap *heap) {
 		                 opc[i + 30],
 		                 opc[i + 31]));
 	}
+#if defined(DUK_USE_DEBUG_OPCODE_PAIRS)
+	{
+		/* Most frequent consecutive opcode pairs, candidates for
+		 * superinstructions.  Keep a small sorted top list.
+		 */
+		duk_uint_t top[DUK__OPCODE_PAIR_TOP];
+		duk_uint_t k, n = 0;
+
+		for (i = 0; i < 256 * 256; i++) {
+			duk_int_t cnt = heap->stats_exec_opcode_pair[i >> 8][i & 0xffU];
+			if (cnt <= 0) {
+				continue;
+			}
+			if (n == DUK__OPCODE_PAIR_TOP) {
+				if (cnt <= heap->stats_exec_opcode_pair[top[n - 1] >> 8][top[n - 1] & 0xffU]) {
+					continue;
+				}
+				n--;
+			}
+			for (k = n; k > 0 && heap->stats_exec_opcode_pair[top[k - 1] >> 8][top[k - 1] & 0xffU] < cnt; k--) {
+				top[k] = top[k - 1];
+			}
+			top[k] = i;
+			n++;
+		}
+		for (k = 0; k < n; k++) {
+			j = top[k];
+			DUK_D(DUK_DPRINT("  opcode pair %!X + %!X: %ld",
+			                 (long) (j >> 8),
+			                 (long) (j & 0xffU),
+			                 (long) heap->stats_exec_opcode_pair[j >> 8][j & 0xffU]));
+		}
+	}
+#endif
 	DUK_D(DUK_DPRINT("stats call: all=%ld, tailcall=%ld, ecmatoecma=%ld",
 	                 (long) heap->stats_call_all,
 	                 (long) heap->stats_call_tailcall,
@@ -1266,6 +1566,11 @@ DUK_LOCAL void duk__dump_stats(duk_heap *heap) {
 	DUK_D(DUK_DPRINT("stats set: strkey_count=%ld, idxkey_count=%ld",
 	                 (long) heap->stats_set_strkey_count,
 	                 (long) heap->stats_set_idxkey_count));
+	DUK_D(DUK_DPRINT("stats icache: get_hit=%ld, get_miss=%ld, put_hit=%ld, put_miss=%ld",
+	                 (long) heap->stats_icache_get_hit,
+	                 (long) heap->stats_icache_get_miss,
+	                 (long) heap->stats_icache_put_hit,
+	                 (long) heap->stats_icache_put_miss));
 
 	DUK_D(DUK_DPRINT("stats getownpropdesc: count=%ld, hit=%ld, miss=%ld",
 	                 (long) heap->stats_getownpropdesc_count,
@@ -1305,6 +1610,744 @@ DUK_LOCAL void duk__dump_stats(duk_heap *heap) {
 }
 #endif /* DUK_USE_DEBUG */
 
+/*
+ *  Minor (nursery) collection.
+ *
+ *  With DUK_USE_GENERATIONAL_GC objects surviving a collection keep their
+ *  REACHABLE flag, which then serves as an "old generation" marker.  New
+ *  objects (and objects requeued from finalize_list) are unmarked and,
+ *  because heap_allocated insertions always happen at the list head, they
+ *  form a prefix of heap_allocated: the nursery.
+ *
+ *  Instead of write barriers and a remembered set, reference counts are
+ *  used to find nursery objects referenced from outside the nursery (trial
+ *  deletion): refcount finalizing every nursery object removes references
+ *  originating from the nursery, so a non-zero refcount remains only for
+ *  objects referenced by old objects or heap roots.  Marking starts from
+ *  these, traverses only unmarked objects, and restores the refcount of
+ *  every edge it visits.  Unmarked nursery objects are then unreachable
+ *  (in practice reference cycles, as other garbage is freed by refcounting)
+ *  and are freed; survivors are promoted by leaving REACHABLE set.
+ *
+ *  Compared to a full collection, weak collection entries are treated as
+ *  strong, objects with a finalizer are kept for a full collection to
+ *  finalize, and old objects only referenced by freed nursery objects are
+ *  left with a zero refcount until the next full collection frees them.
+ */
+
+#if defined(DUK_USE_GENERATIONAL_GC)
+DUK_LOCAL duk_bool_t duk__ms_minor_allowed(duk_heap *heap, duk_small_uint_t flags) {
+	duk_size_t full_interval;
+
+	if ((flags & (DUK_MS_FLAG_VOLUNTARY | DUK_MS_FLAG_EMERGENCY)) != DUK_MS_FLAG_VOLUNTARY) {
+		return 0;
+	}
+#if defined(DUK_USE_FINALIZER_SUPPORT)
+	/* Objects on finalize_list (including one being finalized right now)
+	 * are unmarked but not in the nursery, so leave them to a full
+	 * collection.
+	 */
+	if (heap->finalize_list != NULL) {
+		return 0;
+	}
+#endif
+	/* Minor collections happen at most DUK_HEAP_GENGC_NURSERY_TRIGGER
+	 * apart; do a full collection once they add up to the normal
+	 * voluntary GC interval.
+	 */
+	full_interval = (heap->ms_full_keep / 256) * DUK_HEAP_MARK_AND_SWEEP_TRIGGER_MULT + DUK_HEAP_MARK_AND_SWEEP_TRIGGER_ADD;
+	if ((duk_size_t) heap->ms_minor_count * DUK_HEAP_GENGC_NURSERY_TRIGGER >= full_interval) {
+		return 0;
+	}
+	return 1;
+}
+
+DUK_LOCAL void duk__mark_and_sweep_minor(duk_heap *heap) {
+	duk_heaphdr *curr;
+	duk_heaphdr *next;
+	duk_heaphdr *prev;
+	duk_heaphdr *old_head;
+	duk_size_t count_young = 0;
+	duk_size_t count_keep = 0;
+	duk_bool_t entry_creating_error;
+#if defined(DUK_USE_VOLUNTARY_GC)
+	duk_size_t tmp;
+#endif
+
+#if defined(DUK_USE_ASSERTIONS)
+	DUK_ASSERT(heap->ms_prevent_count == 0);
+	DUK_ASSERT(heap->ms_running == 0);
+	DUK_ASSERT(!DUK_HEAP_HAS_MARKANDSWEEP_RECLIMIT_REACHED(heap));
+	DUK_ASSERT(heap->ms_recursion_depth == 0);
+	duk__assert_heaphdr_flags(heap);
+	duk__assert_validity(heap);
+	duk__assert_valid_refcounts(heap);
+#endif
+
+	heap->ms_prevent_count = 1;
+	heap->ms_running = 1;
+	heap->ms_minor = 1;
+	entry_creating_error = heap->creating_error;
+	heap->creating_error = 0;
+
+	duk_heap_free_freelists(heap);
+
+	/* Trial deletion; refzero is suppressed while ms_running is set. */
+	curr = heap->heap_allocated;
+	while (curr != NULL && !DUK_HEAPHDR_HAS_REACHABLE(curr)) {
+		duk_heaphdr_refcount_finalize_norz(heap, curr);
+		count_young++;
+		curr = DUK_HEAPHDR_GET_NEXT(heap, curr);
+	}
+	old_head = curr;
+	heap->ms_nursery_end = old_head;
+
+	/* Mark from nursery objects referenced from outside the nursery.
+	 * A root isn't an edge, so undo the refcount bump done by marking.
+	 */
+	for (curr = heap->heap_allocated; curr != old_head; curr = DUK_HEAPHDR_GET_NEXT(heap, curr)) {
+		if (DUK_HEAPHDR_HAS_REACHABLE(curr)) {
+			continue;
+		}
+		if (DUK_HEAPHDR_GET_REFCOUNT(curr) > 0
+#if defined(DUK_USE_FINALIZER_SUPPORT)
+		    || (DUK_HEAPHDR_IS_ANY_OBJECT(curr) && duk_hobject_has_finalizer_fast_raw(heap, (duk_hobject *) curr))
+#endif
+		) {
+			duk__mark_heaphdr_nonnull(heap, curr);
+			DUK_HEAPHDR_PREDEC_REFCOUNT(curr);
+		}
+	}
+	duk__mark_temproots_by_heap_scan(heap);
+
+	/* Sweep the nursery.  Unmarked objects have a zero refcount and are
+	 * only referenced by other unmarked objects, so they can be freed
+	 * without refcount finalization.
+	 */
+#if defined(DUK_USE_GC_FREE_BATCH)
+	duk_heap_free_batch_begin(heap);
+#endif
+	prev = NULL;
+	curr = heap->heap_allocated;
+	while (curr != old_head) {
+		DUK_ASSERT(!DUK_HEAPHDR_IS_ANY_STRING(curr));
+		DUK_ASSERT(!DUK_HEAPHDR_HAS_TEMPROOT(curr));
+		DUK_ASSERT(!DUK_HEAPHDR_HAS_FINALIZABLE(curr));
+
+		next = DUK_HEAPHDR_GET_NEXT(heap, curr);
+
+		if (DUK_HEAPHDR_HAS_REACHABLE(curr)) {
+			DUK_DD(DUK_DDPRINT("minor sweep; reachable --> promote: %p", (void *) curr));
+			if (prev != NULL) {
+				DUK_HEAPHDR_SET_NEXT(heap, prev, curr);
+			} else {
+				heap->heap_allocated = curr;
+			}
+			DUK_HEAPHDR_SET_PREV(heap, curr, prev);
+			prev = curr;
+			count_keep++;
+		} else {
+			DUK_DD(DUK_DDPRINT("minor sweep; not reachable --> free: %p", (void *) curr));
+			DUK_ASSERT(DUK_HEAPHDR_GET_REFCOUNT(curr) == 0);
+			duk_heap_free_heaphdr_raw(heap, curr);
+		}
+
+		curr = next;
+	}
+	if (prev != NULL) {
+		DUK_HEAPHDR_SET_NEXT(heap, prev, old_head);
+	} else {
+		heap->heap_allocated = old_head;
+	}
+#if defined(DUK_USE_GC_FREE_BATCH)
+	duk_heap_free_batch_end(heap);
+#endif
+	if (old_head != NULL) {
+		DUK_HEAPHDR_SET_PREV(heap, old_head, prev);
+	}
+	DUK_HEAPHDR_ASSERT_LINKS(heap, prev);
+	DUK_HEAPHDR_ASSERT_LINKS(heap, old_head);
+
+	heap->ms_promoted += count_keep;
+	heap->ms_minor_count++;
+
+	DUK_ASSERT(heap->ms_prevent_count == 1);
+	DUK_ASSERT(heap->ms_running == 1);
+	heap->ms_nursery_end = NULL;
+	heap->ms_minor = 0;
+	heap->ms_prevent_count = 0;
+	heap->ms_running = 0;
+	heap->creating_error = entry_creating_error;
+
+#if defined(DUK_USE_ASSERTIONS)
+	DUK_ASSERT(!DUK_HEAP_HAS_MARKANDSWEEP_RECLIMIT_REACHED(heap));
+	DUK_ASSERT(heap->ms_recursion_depth == 0);
+	DUK_ASSERT(heap->refzero_list == NULL);
+	duk__assert_heaphdr_flags(heap);
+	duk__assert_validity(heap);
+	duk__assert_valid_refcounts(heap);
+#endif
+
+#if defined(DUK_USE_VOLUNTARY_GC)
+	tmp = (heap->ms_full_keep + heap->ms_promoted) / 256;
+	heap->ms_trigger_counter = (duk_int_t) ((tmp * DUK_HEAP_MARK_AND_SWEEP_TRIGGER_MULT) + DUK_HEAP_MARK_AND_SWEEP_TRIGGER_ADD);
+	if (heap->ms_trigger_counter > DUK_HEAP_GENGC_NURSERY_TRIGGER) {
+		heap->ms_trigger_counter = DUK_HEAP_GENGC_NURSERY_TRIGGER;
+	}
+#endif
+	DUK_D(DUK_DPRINT("garbage collect (minor) finished: %ld young objects, %ld promoted, %ld freed",
+	                 (long) count_young,
+	                 (long) count_keep,
+	                 (long) (count_young - count_keep)));
+}
+
+/* Clear sticky REACHABLE flags before a full collection. */
+DUK_LOCAL void duk__clear_old_marks(duk_heap *heap) {
+	duk_heaphdr *curr;
+
+	for (curr = heap->heap_allocated; curr != NULL; curr = DUK_HEAPHDR_GET_NEXT(heap, curr)) {
+		DUK_HEAPHDR_CLEAR_REACHABLE(curr);
+	}
+}
+#endif /* DUK_USE_GENERATIONAL_GC */
+
+/*
+ *  Incremental collection.
+ *
+ *  With DUK_USE_INCREMENTAL_GC voluntary collections run as a cycle of
+ *  bounded steps interleaved with normal execution.  Marking uses an
+ *  explicit gray stack: a step pops gray objects and marks their children,
+ *  graying any newly marked objects.  Objects created while marking are
+ *  allocated black (marked but not traversed).
+ *
+ *  The mutator may store a reference to an unmarked object into an object
+ *  already marked, which would normally require a write barrier.  Instead,
+ *  an atomic finish step uses trial deletion like minor collections do:
+ *  all unmarked objects are refcount finalized, so a non-zero refcount
+ *  remains only for unmarked objects referenced by marked objects or heap
+ *  roots.  Marking continues from these, restoring a refcount for every
+ *  edge traversed.  Weak collection entries with an unmarked key have
+ *  their references removed too and are handled as ephemerons.  Marked
+ *  objects which became garbage while marking are kept until the next
+ *  cycle.
+ *
+ *  Objects are then swept in steps.  Objects inserted into heap_allocated
+ *  while sweeping go to the list head, behind the sweep cursor.  Unmarked
+ *  objects have already been refcount finalized and nothing references
+ *  them, so they can be freed at any point.
+ *
+ *  Objects being marked (gray) may be freed by refcounting while marking
+ *  is in progress.  Their freeing is deferred until the finish step so
+ *  that gray stack entries remain valid.
+ *
+ *  Explicit, emergency and heap destruction collections first complete
+ *  an incremental cycle in progress, and are then done atomically.
+ */
+
+#if defined(DUK_USE_INCREMENTAL_GC)
+DUK_LOCAL void duk__incr_push_gray(duk_heap *heap, duk_heaphdr *h) {
+	DUK_ASSERT(DUK_HEAPHDR_IS_ANY_OBJECT(h));
+	DUK_ASSERT(DUK_HEAPHDR_HAS_REACHABLE(h));
+
+	DUK_HEAPHDR_SET_TEMPROOT(h);
+
+	if (DUK_UNLIKELY(heap->ms_gray_top >= heap->ms_gray_size)) {
+		duk_size_t new_size;
+		duk_heaphdr **new_gray;
+
+		/* No GC interaction here, we're inside mark-and-sweep.  If
+		 * the stack can't grow, the object is left as a temproot and
+		 * found by a heap scan in the finish step.
+		 */
+		new_size = (heap->ms_gray_size > 0 ? heap->ms_gray_size * 2 : 256);
+		new_gray = NULL;
+		if (new_size > heap->ms_gray_size && new_size <= DUK_SIZE_MAX / sizeof(duk_heaphdr *)) {
+			new_gray = (duk_heaphdr **) DUK_REALLOC_RAW(heap, heap->ms_gray, new_size * sizeof(duk_heaphdr *));
+		}
+		if (new_gray == NULL) {
+			DUK_D(DUK_DPRINT("failed to grow gray stack, marking as temproot: %p", (void *) h));
+			DUK_HEAP_SET_MARKANDSWEEP_RECLIMIT_REACHED(heap);
+			return;
+		}
+		heap->ms_gray = new_gray;
+		heap->ms_gray_size = new_size;
+	}
+
+	heap->ms_gray[heap->ms_gray_top++] = h;
+}
+
+/* Pop and mark gray objects, at most 'budget' objects.  With 'depth' at the
+ * recursion limit, children are grayed; with a lower depth they're marked
+ * recursively.  Returns number of objects processed.
+ */
+DUK_LOCAL duk_size_t duk__incr_mark_gray(duk_heap *heap, duk_size_t budget, duk_uint_t depth) {
+	duk_size_t count = 0;
+
+	while (count < budget && heap->ms_gray_top > 0) {
+		duk_heaphdr *h;
+
+		h = heap->ms_gray[--heap->ms_gray_top];
+		if (!DUK_HEAPHDR_HAS_TEMPROOT(h)) {
+			/* Freeing deferred, or handled by a temproot scan. */
+			continue;
+		}
+		DUK_HEAPHDR_CLEAR_TEMPROOT(h);
+		DUK_ASSERT(DUK_HEAPHDR_HAS_REACHABLE(h));
+
+		heap->ms_recursion_depth = depth;
+		duk__mark_hobject(heap, (duk_hobject *) h);
+		count++;
+	}
+	heap->ms_recursion_depth = 0;
+
+	return count;
+}
+
+/* Called when a gray object is being freed by refcounting while marking.
+ * Returns 1 if freeing was deferred.
+ */
+DUK_INTERNAL duk_bool_t duk_heap_mark_and_sweep_defer_free(duk_heap *heap, duk_heaphdr *hdr) {
+	DUK_ASSERT(heap->ms_incr_phase == DUK_HEAP_INCR_MARK);
+	DUK_ASSERT(DUK_HEAPHDR_IS_ANY_OBJECT(hdr));
+
+#if defined(DUK_USE_COLLECTION_BUILTINS)
+	if (DUK_HOBJECT_IS_HMAP((duk_hobject *) hdr) && ((duk_hmap *) hdr)->ms_next != NULL) {
+		duk_hmap *m = (duk_hmap *) hdr;
+		duk_hmap *prev = NULL;
+		duk_hmap *curr;
+		duk_hmap *next;
+
+		/* Unlink from ms_weak_list, which is rarely long. */
+		for (curr = heap->ms_weak_list; curr != m; curr = curr->ms_next) {
+			DUK_ASSERT(curr != NULL && curr->ms_next != curr);
+			prev = curr;
+		}
+		next = (m->ms_next != m ? m->ms_next : NULL);
+		if (prev == NULL) {
+			heap->ms_weak_list = next;
+		} else {
+			prev->ms_next = (next != NULL ? next : prev);
+		}
+		m->ms_next = NULL;
+	}
+#endif
+
+	if (!DUK_HEAPHDR_HAS_TEMPROOT(hdr)) {
+		return 0;
+	}
+	DUK_DD(DUK_DDPRINT("defer freeing of gray object: %p", (void *) hdr));
+	DUK_HEAPHDR_CLEAR_TEMPROOT(hdr);
+	DUK_HEAPHDR_SET_NEXT(heap, hdr, heap->ms_incr_deferred);
+	heap->ms_incr_deferred = hdr;
+	return 1;
+}
+
+DUK_LOCAL void duk__incr_begin(duk_heap *heap) {
+	DUK_ASSERT(heap->ms_incr_phase == DUK_HEAP_INCR_IDLE);
+	DUK_ASSERT(heap->ms_gray_top == 0);
+	DUK_ASSERT(heap->ms_incr_deferred == NULL);
+	DUK_ASSERT(!DUK_HEAP_HAS_MARKANDSWEEP_RECLIMIT_REACHED(heap));
+#if defined(DUK_USE_COLLECTION_BUILTINS)
+	DUK_ASSERT(heap->ms_weak_list == NULL);
+#endif
+#if defined(DUK_USE_ASSERTIONS)
+	duk__assert_heaphdr_flags(heap);
+	duk__assert_validity(heap);
+#endif
+
+	DUK_D(DUK_DPRINT("incremental gc cycle starting"));
+
+	duk_heap_free_freelists(heap);
+
+	/* Gray the roots. */
+	heap->ms_incr_phase = DUK_HEAP_INCR_MARK;
+	heap->ms_recursion_depth = DUK_USE_MARK_AND_SWEEP_RECLIMIT;
+	duk__mark_roots_heap(heap);
+	heap->ms_recursion_depth = 0;
+}
+
+/* Trial deletion: refcount finalize unmarked objects.  Finalized objects
+ * are unmarked so that their rescue decision is based on references which
+ * exist now; they may have been marked before their finalizer ran.
+ */
+DUK_LOCAL void duk__incr_trial_delete(duk_heap *heap) {
+	duk_heaphdr *curr;
+
+	for (curr = heap->heap_allocated; curr != NULL; curr = DUK_HEAPHDR_GET_NEXT(heap, curr)) {
+		DUK_ASSERT(!DUK_HEAPHDR_HAS_TEMPROOT(curr));
+		if (DUK_HEAPHDR_HAS_FINALIZED(curr)) {
+			DUK_HEAPHDR_CLEAR_REACHABLE(curr);
+		}
+		if (!DUK_HEAPHDR_HAS_REACHABLE(curr)) {
+			duk_heaphdr_refcount_finalize_norz(heap, curr);
+		}
+	}
+}
+
+/* Mark from unmarked objects still referenced from marked objects or roots.
+ * A root isn't an edge, so undo the refcount bump done by marking.
+ */
+DUK_LOCAL void duk__incr_mark_referenced(duk_heap *heap) {
+	duk_heaphdr *curr;
+
+	for (curr = heap->heap_allocated; curr != NULL; curr = DUK_HEAPHDR_GET_NEXT(heap, curr)) {
+		if (!DUK_HEAPHDR_HAS_REACHABLE(curr) && DUK_HEAPHDR_GET_REFCOUNT(curr) > 0) {
+			duk__mark_heaphdr_nonnull(heap, curr);
+			DUK_HEAPHDR_PREDEC_REFCOUNT(curr);
+		}
+	}
+	duk__mark_temproots_by_heap_scan(heap);
+}
+
+#if defined(DUK_USE_COLLECTION_BUILTINS)
+/* Remove references held by weak collection entries with an unmarked key.
+ * Such keys are replaced by a pointer to tag the entry until the entry is
+ * either restored or removed.
+ */
+DUK_LOCAL void duk__incr_weak_unref(duk_heap *heap) {
+	duk_hmap *m;
+
+	for (m = heap->ms_weak_list; m != NULL; m = (m->ms_next != m ? m->ms_next : NULL)) {
+		duk_uint32_t i;
+
+		if (!DUK_HEAPHDR_HAS_REACHABLE((duk_heaphdr *) m)) {
+			/* Unmarked by trial deletion, entries already handled. */
+			continue;
+		}
+		for (i = 0; i < m->e_next; i++) {
+			duk_tval *tv_key = DUK_HMAP_GET_KEY(m, i);
+			duk_heaphdr *h_key;
+
+			if (!DUK_TVAL_IS_OBJECT(tv_key)) {
+				continue;
+			}
+			h_key = DUK_TVAL_GET_HEAPHDR(tv_key);
+			if (DUK_HEAPHDR_HAS_REACHABLE(h_key)) {
+				continue;
+			}
+			DUK_HEAPHDR_PREDEC_REFCOUNT(h_key);
+			if (DUK_HMAP_GET_STRIDE(m) == 2U) {
+				duk_tval *tv_val = DUK_HMAP_GET_VALUE(m, i);
+				if (DUK_TVAL_NEEDS_REFCOUNT_UPDATE(tv_val)) {
+					DUK_HEAPHDR_PREDEC_REFCOUNT(DUK_TVAL_GET_HEAPHDR(tv_val));
+				}
+			}
+			DUK_TVAL_SET_POINTER(tv_key, (void *) h_key);
+		}
+	}
+}
+
+/* Restore entries whose key has been marked since, marking their values.
+ * Returns 1 if any entries were restored.
+ */
+DUK_LOCAL duk_bool_t duk__incr_weak_restore(duk_heap *heap) {
+	duk_hmap *m;
+	duk_bool_t changed = 0;
+
+	for (m = heap->ms_weak_list; m != NULL; m = (m->ms_next != m ? m->ms_next : NULL)) {
+		duk_uint32_t i;
+
+		for (i = 0; i < m->e_next; i++) {
+			duk_tval *tv_key = DUK_HMAP_GET_KEY(m, i);
+			duk_heaphdr *h_key;
+
+			if (!DUK_TVAL_IS_POINTER(tv_key)) {
+				continue;
+			}
+			h_key = (duk_heaphdr *) DUK_TVAL_GET_POINTER(tv_key);
+			if (!DUK_HEAPHDR_HAS_REACHABLE(h_key)) {
+				continue;
+			}
+			DUK_TVAL_SET_OBJECT(tv_key, (duk_hobject *) h_key);
+			DUK_HEAPHDR_PREINC_REFCOUNT(h_key);
+			if (DUK_HMAP_GET_STRIDE(m) == 2U) {
+				duk__mark_tval(heap, DUK_HMAP_GET_VALUE(m, i)); /* Restores refcount. */
+			}
+			changed = 1;
+		}
+	}
+	return changed;
+}
+
+DUK_LOCAL void duk__incr_mark_weak_collections(duk_heap *heap) {
+	duk_bool_t changed;
+
+	do {
+		changed = duk__incr_weak_restore(heap);
+		duk__mark_temproots_by_heap_scan(heap);
+	} while (changed);
+}
+
+/* Remove entries whose key remains unmarked. */
+DUK_LOCAL void duk__incr_purge_weak_collections(duk_heap *heap) {
+	duk_hmap *m;
+	duk_hmap *next;
+
+	for (m = heap->ms_weak_list; m != NULL; m = next) {
+		duk_uint32_t i;
+
+		for (i = 0; i < m->e_next; i++) {
+			duk_tval *tv_key = DUK_HMAP_GET_KEY(m, i);
+			duk_heaphdr *h_key;
+
+			if (!DUK_TVAL_IS_POINTER(tv_key)) {
+				continue;
+			}
+			h_key = (duk_heaphdr *) DUK_TVAL_GET_POINTER(tv_key);
+			DUK_ASSERT(!DUK_HEAPHDR_HAS_REACHABLE(h_key));
+			DUK_TVAL_SET_OBJECT(tv_key, (duk_hobject *) h_key);
+			DUK_HEAPHDR_PREINC_REFCOUNT(h_key);
+			if (DUK_HMAP_GET_STRIDE(m) == 2U) {
+				duk_tval *tv_val = DUK_HMAP_GET_VALUE(m, i);
+				if (DUK_TVAL_NEEDS_REFCOUNT_UPDATE(tv_val)) {
+					DUK_HEAPHDR_PREINC_REFCOUNT(DUK_TVAL_GET_HEAPHDR(tv_val));
+				}
+			}
+			DUK_DDD(DUK_DDDPRINT("remove weak collection entry with unreachable key: %!T", tv_key));
+			duk_hmap_remove_index_norz(heap, m, i);
+		}
+
+		next = (m->ms_next != m ? m->ms_next : NULL);
+		m->ms_next = NULL;
+	}
+	heap->ms_weak_list = NULL;
+}
+#endif /* DUK_USE_COLLECTION_BUILTINS */
+
+/* Atomic end of the marking phase. */
+DUK_LOCAL void duk__incr_finish(duk_heap *heap) {
+	duk_heaphdr *curr;
+	duk_heaphdr *next;
+	duk_size_t count_keep_str;
+
+	DUK_ASSERT(heap->ms_incr_phase == DUK_HEAP_INCR_MARK);
+	DUK_ASSERT(heap->ms_running == 1);
+
+	/* Complete marking from roots, including finalize_list.  The gray
+	 * stack is now drained with recursive marking.
+	 */
+	duk__mark_roots_heap(heap);
+#if defined(DUK_USE_FINALIZER_SUPPORT)
+	duk__mark_finalize_list(heap);
+#endif
+	do {
+		(void) duk__incr_mark_gray(heap, DUK_SIZE_MAX, 1);
+		duk__mark_temproots_by_heap_scan(heap);
+	} while (heap->ms_gray_top > 0);
+
+	/* Find unmarked objects which are still referenced, and ephemerons. */
+	heap->ms_incr_trial = 1;
+	duk__incr_trial_delete(heap);
+#if defined(DUK_USE_COLLECTION_BUILTINS)
+	duk__incr_weak_unref(heap);
+#endif
+	duk__incr_mark_referenced(heap);
+#if defined(DUK_USE_COLLECTION_BUILTINS)
+	duk__incr_mark_weak_collections(heap);
+#endif
+#if defined(DUK_USE_FINALIZER_SUPPORT)
+	duk__mark_finalizable(heap);
+	duk__mark_temproots_by_heap_scan(heap);
+#endif
+#if defined(DUK_USE_COLLECTION_BUILTINS)
+	duk__incr_mark_weak_collections(heap);
+	duk__incr_purge_weak_collections(heap);
+#endif
+	heap->ms_incr_trial = 0;
+	DUK_ASSERT(!DUK_HEAP_HAS_MARKANDSWEEP_RECLIMIT_REACHED(heap));
+	DUK_ASSERT(heap->ms_gray_top == 0);
+
+	/* Strings are swept right away: they're not in heap_allocated and
+	 * their refcounts are only exact right now.
+	 */
+#if defined(DUK_USE_LITCACHE_SIZE)
+	duk__wipe_litcache(heap);
+#endif
+#if defined(DUK_USE_FINALIZER_SUPPORT)
+	duk__clear_finalize_list_flags(heap);
+#endif
+	duk__sweep_stringtable(heap, &count_keep_str);
+
+	/* Gray objects freed while marking have been refcount finalized
+	 * already.
+	 */
+	for (curr = heap->ms_incr_deferred; curr != NULL; curr = next) {
+		next = DUK_HEAPHDR_GET_NEXT(heap, curr);
+		duk_heap_free_heaphdr_raw(heap, curr);
+	}
+	heap->ms_incr_deferred = NULL;
+
+	heap->ms_incr_flags = 0;
+#if defined(DUK_USE_FINALIZER_SUPPORT)
+	if (heap->finalize_list != NULL) {
+		heap->ms_incr_flags |= DUK_MS_FLAG_POSTPONE_RESCUE;
+	}
+#endif
+	heap->ms_incr_keep = count_keep_str;
+	heap->ms_incr_cursor = heap->heap_allocated;
+	heap->ms_incr_phase = DUK_HEAP_INCR_SWEEP;
+
+	DUK_D(DUK_DPRINT("incremental gc marking finished, %ld strings kept", (long) count_keep_str));
+}
+
+/* Sweep at most 'budget' objects. */
+DUK_LOCAL void duk__incr_sweep(duk_heap *heap, duk_size_t budget) {
+	duk_heaphdr *curr;
+	duk_heaphdr *prev;
+	duk_heaphdr *next;
+	duk_size_t count = 0;
+
+	DUK_ASSERT(heap->ms_incr_phase == DUK_HEAP_INCR_SWEEP);
+
+	while (count < budget && (curr = heap->ms_incr_cursor) != NULL) {
+		DUK_ASSERT(!DUK_HEAPHDR_IS_ANY_STRING(curr));
+		DUK_ASSERT(!DUK_HEAPHDR_HAS_READONLY(curr));
+		DUK_ASSERT(!DUK_HEAPHDR_HAS_TEMPROOT(curr));
+
+		next = DUK_HEAPHDR_GET_NEXT(heap, curr);
+		heap->ms_incr_cursor = next;
+		count++;
+
+		if (DUK_HEAPHDR_HAS_REACHABLE(curr)) {
+			DUK_HEAPHDR_CLEAR_REACHABLE(curr);
+#if defined(DUK_USE_FINALIZER_SUPPORT)
+			if (DUK_UNLIKELY(DUK_HEAPHDR_HAS_FINALIZABLE(curr))) {
+				DUK_ASSERT(!DUK_HEAPHDR_HAS_FINALIZED(curr));
+				DUK_DD(DUK_DDPRINT("incremental sweep; finalizable --> move to finalize_list: %p", (void *) curr));
+			} else
+#endif
+			{
+				if (DUK_UNLIKELY(DUK_HEAPHDR_HAS_FINALIZED(curr)) &&
+				    !(heap->ms_incr_flags & DUK_MS_FLAG_POSTPONE_RESCUE)) {
+					DUK_DD(DUK_DDPRINT("incremental sweep; finalized --> rescued after finalization: %p",
+					                   (void *) curr));
+					DUK_HEAPHDR_CLEAR_FINALIZED(curr);
+				} else {
+					heap->ms_incr_keep++;
+				}
+				if (DUK_HEAPHDR_IS_ANY_OBJECT(curr) && DUK_HOBJECT_IS_THREAD((duk_hobject *) curr)) {
+					duk_valstack_shrink_check_nothrow((duk_hthread *) curr, 0 /*snug*/);
+				}
+				continue;
+			}
+		} else {
+			/* Refcount finalized in the finish step. */
+			DUK_ASSERT(DUK_HEAPHDR_GET_REFCOUNT(curr) == 0);
+			DUK_ASSERT(!DUK_HEAPHDR_HAS_FINALIZABLE(curr));
+			DUK_DD(DUK_DDPRINT("incremental sweep; not reachable --> free: %p", (void *) curr));
+		}
+
+		/* Unlink directly, the cursor has been advanced already. */
+		prev = DUK_HEAPHDR_GET_PREV(heap, curr);
+		if (prev != NULL) {
+			DUK_HEAPHDR_SET_NEXT(heap, prev, next);
+		} else {
+			DUK_ASSERT(heap->heap_allocated == curr);
+			heap->heap_allocated = next;
+		}
+		if (next != NULL) {
+			DUK_HEAPHDR_SET_PREV(heap, next, prev);
+		}
+
+#if defined(DUK_USE_FINALIZER_SUPPORT)
+		if (DUK_HEAPHDR_HAS_FINALIZABLE(curr)) {
+			DUK_HEAPHDR_PREINC_REFCOUNT(curr); /* Bump refcount while pending a finalizer call. */
+			DUK_HEAP_INSERT_INTO_FINALIZE_LIST(heap, curr);
+			continue;
+		}
+#endif
+		duk_heap_free_heaphdr_raw(heap, curr);
+	}
+}
+
+/* Run incremental work with mark-and-sweep protection: one step with a
+ * non-zero 'budget', otherwise complete the cycle.  Returns 1 if the cycle
+ * was completed.
+ */
+DUK_LOCAL duk_bool_t duk__incr_run(duk_heap *heap, duk_size_t budget) {
+	duk_bool_t entry_creating_error;
+	duk_bool_t done = 0;
+
+	DUK_ASSERT(heap->ms_prevent_count == 0);
+	DUK_ASSERT(heap->ms_running == 0);
+	heap->ms_prevent_count = 1;
+	heap->ms_running = 1;
+	entry_creating_error = heap->creating_error;
+	heap->creating_error = 0;
+
+#if defined(DUK_USE_GC_FREE_BATCH)
+	duk_heap_free_batch_begin(heap);
+#endif
+	if (heap->ms_incr_phase == DUK_HEAP_INCR_IDLE) {
+		DUK_ASSERT(budget > 0);
+		duk__incr_begin(heap);
+	} else if (heap->ms_incr_phase == DUK_HEAP_INCR_MARK) {
+		if (budget > 0) {
+			(void) duk__incr_mark_gray(heap, budget, DUK_USE_MARK_AND_SWEEP_RECLIMIT);
+		}
+		if (heap->ms_gray_top == 0 || budget == 0) {
+			duk__incr_finish(heap);
+		}
+	} else {
+		DUK_ASSERT(heap->ms_incr_phase == DUK_HEAP_INCR_SWEEP);
+		duk__incr_sweep(heap, budget);
+	}
+	if (budget == 0 && heap->ms_incr_phase == DUK_HEAP_INCR_SWEEP) {
+		duk__incr_sweep(heap, DUK_SIZE_MAX);
+	}
+	if (heap->ms_incr_phase == DUK_HEAP_INCR_SWEEP && heap->ms_incr_cursor == NULL) {
+		heap->ms_incr_phase = DUK_HEAP_INCR_IDLE;
+		done = 1;
+	}
+#if defined(DUK_USE_GC_FREE_BATCH)
+	duk_heap_free_batch_end(heap);
+#endif
+
+	DUK_ASSERT(heap->ms_prevent_count == 1);
+	DUK_ASSERT(heap->ms_running == 1);
+	heap->ms_prevent_count = 0;
+	heap->ms_running = 0;
+	heap->creating_error = entry_creating_error;
+
+#if defined(DUK_USE_VOLUNTARY_GC)
+	if (done) {
+		duk_size_t tmp;
+
+		tmp = heap->ms_incr_keep / 256;
+		heap->ms_trigger_counter =
+		    (duk_int_t) ((tmp * DUK_HEAP_MARK_AND_SWEEP_TRIGGER_MULT) + DUK_HEAP_MARK_AND_SWEEP_TRIGGER_ADD);
+	} else {
+		heap->ms_trigger_counter = DUK_HEAP_INCR_STEP_INTERVAL;
+	}
+#endif
+	if (done) {
+		DUK_D(DUK_DPRINT("incremental gc cycle finished: %ld objects and strings kept", (long) heap->ms_incr_keep));
+	}
+	return done;
+}
+
+DUK_INTERNAL duk_bool_t duk_heap_mark_and_sweep_step(duk_heap *heap, duk_size_t budget) {
+	DUK_ASSERT(heap->heap_thread != NULL);
+
+	if (heap->ms_prevent_count != 0) {
+		DUK_DD(DUK_DDPRINT("reject recursive incremental gc step"));
+		return (heap->ms_incr_phase != DUK_HEAP_INCR_IDLE);
+	}
+
+	if (budget == 0) {
+		budget = DUK_HEAP_INCR_STEP_WORK;
+	}
+	if (!duk__incr_run(heap, budget)) {
+		return 1;
+	}
+
+#if defined(DUK_USE_FINALIZER_SUPPORT)
+	duk_heap_process_finalize_list(heap);
+#endif
+	return 0;
+}
+#endif /* DUK_USE_INCREMENTAL_GC */
+
 /*
  *  Main mark-and-sweep function.
  *
@@ -1363,6 +2406,23 @@ DUK_INTERNAL void duk_heap_mark_and_sweep(duk_heap *heap, duk_small_uint_t flags
 	}
 #endif
 
+#if defined(DUK_USE_GENERATIONAL_GC)
+	if (duk__ms_minor_allowed(heap, flags)) {
+		duk__mark_and_sweep_minor(heap);
+		return;
+	}
+#endif
+#if defined(DUK_USE_INCREMENTAL_GC)
+	if ((flags & (DUK_MS_FLAG_VOLUNTARY | DUK_MS_FLAG_EMERGENCY)) == DUK_MS_FLAG_VOLUNTARY) {
+		(void) duk_heap_mark_and_sweep_step(heap, DUK_HEAP_INCR_STEP_WORK);
+		return;
+	}
+	if (heap->ms_incr_phase != DUK_HEAP_INCR_IDLE) {
+		/* Finalizers run after the atomic collection. */
+		(void) duk__incr_run(heap, 0);
+	}
+#endif
+
 	/*
 	 *  Assertions before
 	 */
@@ -1419,6 +2479,9 @@ DUK_INTERNAL void duk_heap_mark_and_sweep(duk_heap *heap, duk_small_uint_t flags
 	 *  previous run had finalizer skip flag.
 	 */
 
+#if defined(DUK_USE_GENERATIONAL_GC)
+	duk__clear_old_marks(heap);
+#endif
 #if defined(DUK_USE_ASSERTIONS) && defined(DUK_USE_REFERENCE_COUNTING)
 	duk__clear_assert_refcounts(heap);
 #endif
@@ -1430,12 +2493,19 @@ DUK_INTERNAL void duk_heap_mark_and_sweep(duk_heap *heap, duk_small_uint_t flags
 	DUK_ASSERT(heap->refzero_list == NULL); /* Always handled to completion inline in DECREF. */
 #endif
 	duk__mark_temproots_by_heap_scan(heap); /* Temproots. */
+#if defined(DUK_USE_COLLECTION_BUILTINS)
+	duk__mark_weak_collections(heap); /* Weak collection values with reachable keys. */
+#endif
 
 #if defined(DUK_USE_FINALIZER_SUPPORT)
 	duk__mark_finalizable(heap); /* Mark finalizable as reachability roots. */
 	duk__mark_finalize_list(heap); /* Mark finalizer work list as reachability roots. */
 #endif
 	duk__mark_temproots_by_heap_scan(heap); /* Temproots. */
+#if defined(DUK_USE_COLLECTION_BUILTINS)
+	duk__mark_weak_collections(heap);
+	duk__purge_weak_collections(heap); /* Remove entries with unreachable keys. */
+#endif
 
 	/*
 	 *  Sweep garbage and remove marking flags, and move objects with
@@ -1455,9 +2525,15 @@ DUK_INTERNAL void duk_heap_mark_and_sweep(duk_heap *heap, duk_small_uint_t flags
 
 #if defined(DUK_USE_REFERENCE_COUNTING)
 	duk__finalize_refcounts(heap);
+#endif
+#if defined(DUK_USE_GC_FREE_BATCH)
+	duk_heap_free_batch_begin(heap);
 #endif
 	duk__sweep_heap(heap, flags, &count_keep_obj);
 	duk__sweep_stringtable(heap, &count_keep_str);
+#if defined(DUK_USE_GC_FREE_BATCH)
+	duk_heap_free_batch_end(heap);
+#endif
 #if defined(DUK_USE_ASSERTIONS) && defined(DUK_USE_REFERENCE_COUNTING)
 	duk__check_assert_refcounts(heap);
 #endif
@@ -1549,9 +2625,19 @@ DUK_INTERNAL void duk_heap_mark_and_sweep(duk_heap *heap, duk_small_uint_t flags
 	 *  Reset trigger counter
 	 */
 
+#if defined(DUK_USE_GENERATIONAL_GC)
+	heap->ms_full_keep = count_keep_obj + count_keep_str;
+	heap->ms_promoted = 0;
+	heap->ms_minor_count = 0;
+#endif
 #if defined(DUK_USE_VOLUNTARY_GC)
 	tmp = (count_keep_obj + count_keep_str) / 256;
 	heap->ms_trigger_counter = (duk_int_t) ((tmp * DUK_HEAP_MARK_AND_SWEEP_TRIGGER_MULT) + DUK_HEAP_MARK_AND_SWEEP_TRIGGER_ADD);
+#if defined(DUK_USE_GENERATIONAL_GC)
+	if (heap->ms_trigger_counter > DUK_HEAP_GENGC_NURSERY_TRIGGER) {
+		heap->ms_trigger_counter = DUK_HEAP_GENGC_NURSERY_TRIGGER;
+	}
+#endif
 	DUK_D(DUK_DPRINT("garbage collect (mark-and-sweep) finished: %ld objects kept, %ld strings kept, trigger reset to %ld",
 	                 (long) count_keep_obj,
 	                 (long) count_keep_str,
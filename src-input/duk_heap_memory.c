@@ -61,6 +61,11 @@ DUK_LOCAL DUK_NOINLINE_PERF DUK_COLD void *duk__heap_mem_alloc_slowpath(duk_heap
 		if (i >= DUK_HEAP_ALLOC_FAIL_MARKANDSWEEP_EMERGENCY_LIMIT - 1) {
 			flags |= DUK_MS_FLAG_EMERGENCY;
 		}
+#if defined(DUK_USE_GENERATIONAL_GC) || defined(DUK_USE_INCREMENTAL_GC)
+		if (i == 0) {
+			flags |= DUK_MS_FLAG_VOLUNTARY;
+		}
+#endif
 
 		duk_heap_mark_and_sweep(heap, flags);
 
@@ -222,6 +227,11 @@ DUK_LOCAL DUK_NOINLINE_PERF DUK_COLD void *duk__heap_mem_realloc_slowpath(duk_he
 		if (i >= DUK_HEAP_ALLOC_FAIL_MARKANDSWEEP_EMERGENCY_LIMIT - 1) {
 			flags |= DUK_MS_FLAG_EMERGENCY;
 		}
+#if defined(DUK_USE_GENERATIONAL_GC) || defined(DUK_USE_INCREMENTAL_GC)
+		if (i == 0) {
+			flags |= DUK_MS_FLAG_VOLUNTARY;
+		}
+#endif
 
 		duk_heap_mark_and_sweep(heap, flags);
 
@@ -338,6 +348,11 @@ DUK_LOCAL DUK_NOINLINE_PERF DUK_COLD void *duk__heap_mem_realloc_indirect_slowpa
 		if (i >= DUK_HEAP_ALLOC_FAIL_MARKANDSWEEP_EMERGENCY_LIMIT - 1) {
 			flags |= DUK_MS_FLAG_EMERGENCY;
 		}
+#if defined(DUK_USE_GENERATIONAL_GC) || defined(DUK_USE_INCREMENTAL_GC)
+		if (i == 0) {
+			flags |= DUK_MS_FLAG_VOLUNTARY;
+		}
+#endif
 
 		duk_heap_mark_and_sweep(heap, flags);
 #if defined(DUK_USE_DEBUG)
@@ -417,11 +432,68 @@ gc_retry:
  *  Free memory
  */
 
+#if defined(DUK_USE_GC_FREE_BATCH)
+/* Hand the current batch over to the application and start a new one.
+ * If the new batch can't be allocated, the remaining frees of the sweep
+ * are done directly.
+ */
+DUK_LOCAL void duk__free_batch_flush(duk_heap *heap, duk_bool_t restart) {
+	void **batch;
+
+	batch = heap->free_batch;
+	DUK_ASSERT(batch != NULL);
+	heap->free_batch = NULL;
+
+	if (heap->free_batch_count > 0) {
+		DUK_DD(DUK_DDPRINT("hand over free batch of %ld pointers", (long) heap->free_batch_count));
+		DUK_USE_GC_FREE_BATCH(heap->heap_udata, batch, heap->free_batch_count);
+	} else {
+		DUK_FREE_RAW(heap, (void *) batch);
+	}
+	heap->free_batch_count = 0;
+
+	if (restart) {
+		duk_heap_free_batch_begin(heap);
+	}
+}
+
+DUK_INTERNAL void duk_heap_free_batch_begin(duk_heap *heap) {
+	DUK_ASSERT(heap != NULL);
+	DUK_ASSERT(heap->free_batch == NULL);
+	DUK_ASSERT(heap->free_batch_count == 0);
+
+	/* Raw allocation: no GC may be triggered while sweeping. */
+	heap->free_batch = (void **) DUK_ALLOC_RAW(heap, sizeof(void *) * DUK_HEAP_FREE_BATCH_SIZE);
+}
+
+DUK_INTERNAL void duk_heap_free_batch_end(duk_heap *heap) {
+	DUK_ASSERT(heap != NULL);
+
+	if (heap->free_batch != NULL) {
+		duk__free_batch_flush(heap, 0 /*restart*/);
+	}
+	DUK_ASSERT(heap->free_batch == NULL);
+}
+#endif /* DUK_USE_GC_FREE_BATCH */
+
 DUK_INTERNAL DUK_INLINE_PERF DUK_HOT void duk_heap_mem_free(duk_heap *heap, void *ptr) {
 	DUK_ASSERT(heap != NULL);
 	DUK_ASSERT(heap->free_func != NULL);
 	/* ptr may be NULL */
 
+#if defined(DUK_USE_GC_FREE_BATCH)
+	if (heap->free_batch != NULL) {
+		if (ptr == NULL) {
+			return;
+		}
+		heap->free_batch[heap->free_batch_count++] = ptr;
+		if (heap->free_batch_count >= DUK_HEAP_FREE_BATCH_SIZE) {
+			duk__free_batch_flush(heap, 1 /*restart*/);
+		}
+		return;
+	}
+#endif
+
 	/* Must behave like a no-op with NULL and any pointer returned from
 	 * malloc/realloc with zero size.
 	 */
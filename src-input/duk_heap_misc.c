@@ -21,6 +21,16 @@ DUK_INTERNAL void duk_heap_insert_into_heap_allocated(duk_heap *heap, duk_heaphd
 	DUK_HEAPHDR_ASSERT_LINKS(heap, hdr);
 	DUK_HEAPHDR_ASSERT_LINKS(heap, root);
 	heap->heap_allocated = hdr;
+
+#if defined(DUK_USE_INCREMENTAL_GC)
+	/* Objects created (or queued back from finalize_list) while an
+	 * incremental cycle is marking are allocated black.  Their references
+	 * are found using refcounts when marking finishes.
+	 */
+	if (DUK_UNLIKELY(heap->ms_incr_phase == DUK_HEAP_INCR_MARK)) {
+		DUK_HEAPHDR_SET_REACHABLE(hdr);
+	}
+#endif
 }
 
 #if defined(DUK_USE_REFERENCE_COUNTING)
@@ -63,6 +73,13 @@ DUK_INTERNAL void duk_heap_remove_from_heap_allocated(duk_heap *heap, duk_heaphd
 	} else {
 		;
 	}
+
+#if defined(DUK_USE_INCREMENTAL_GC)
+	/* Don't leave the incremental sweep cursor dangling. */
+	if (DUK_UNLIKELY(heap->ms_incr_cursor == hdr)) {
+		heap->ms_incr_cursor = next;
+	}
+#endif
 }
 #endif /* DUK_USE_REFERENCE_COUNTING */
 
@@ -146,6 +146,37 @@ DUK_LOCAL void duk__refc_fin_hproxy(duk_heap *heap, duk_hthread *thr, duk_hobjec
 	DUK_HOBJECT_DECREF_NORZ_ALLOWNULL(thr, p->handler);
 }
 
+#if defined(DUK_USE_COLLECTION_BUILTINS)
+DUK_LOCAL void duk__refc_fin_hmap(duk_heap *heap, duk_hthread *thr, duk_hobject *h) {
+	duk_hmap *m = (duk_hmap *) h;
+
+	DUK_HMAP_ASSERT_VALID(m);
+	DUK_UNREF(heap);
+
+	/* Weak collections hold counted references too. */
+	duk__decref_tvals_norz(thr, m->entries, (duk_idx_t) (m->e_next * DUK_HMAP_GET_STRIDE(m)));
+}
+#endif
+
+#if defined(DUK_USE_PROMISE_BUILTIN)
+DUK_LOCAL void duk__refc_fin_hpromise(duk_heap *heap, duk_hthread *thr, duk_hobject *h) {
+	duk_hpromise *p = (duk_hpromise *) h;
+	duk_promise_job *job;
+
+	DUK_HPROMISE_ASSERT_VALID(p);
+	DUK_UNREF(heap);
+
+	/* Pending reaction records are freed with the Promise. */
+	DUK_TVAL_DECREF_NORZ(thr, &p->value);
+	for (job = p->reactions; job != NULL; job = job->next) {
+		DUK_HOBJECT_DECREF_NORZ(thr, (duk_hobject *) job->target);
+		DUK_TVAL_DECREF_NORZ(thr, &job->handler_f);
+		DUK_TVAL_DECREF_NORZ(thr, &job->handler_r);
+		DUK_TVAL_DECREF_NORZ(thr, &job->value);
+	}
+}
+#endif
+
 DUK_LOCAL void duk__refc_fin_hthread(duk_heap *heap, duk_hthread *thr, duk_hobject *h) {
 	duk_hthread *t = (duk_hthread *) h;
 	duk_activation *act;
@@ -228,6 +259,21 @@ DUK_LOCAL void duk__refc_fin_slowrefs(duk_heap *heap, duk_hobject *h) {
 		break;
 	}
 #endif /* DUK_USE_ES6_PROXY */
+#if defined(DUK_USE_COLLECTION_BUILTINS)
+	case DUK_HTYPE_MAP:
+	case DUK_HTYPE_SET:
+	case DUK_HTYPE_WEAKMAP:
+	case DUK_HTYPE_WEAKSET: {
+		duk__refc_fin_hmap(heap, thr, h);
+		break;
+	}
+#endif /* DUK_USE_COLLECTION_BUILTINS */
+#if defined(DUK_USE_PROMISE_BUILTIN)
+	case DUK_HTYPE_PROMISE: {
+		duk__refc_fin_hpromise(heap, thr, h);
+		break;
+	}
+#endif /* DUK_USE_PROMISE_BUILTIN */
 	case DUK_HTYPE_THREAD: {
 		duk__refc_fin_hthread(heap, thr, h);
 		break;
@@ -428,7 +474,14 @@ DUK_LOCAL void duk__refcount_free_pending(duk_heap *heap) {
 		DUK_ASSERT((prev == NULL && heap->refzero_list == curr) || (prev != NULL && heap->refzero_list != curr));
 		/* prev->next is intentionally not updated and is garbage. */
 
-		duk_free_hobject(heap, (duk_hobject *) curr); /* Invalidates 'curr'. */
+#if defined(DUK_USE_INCREMENTAL_GC)
+		if (DUK_UNLIKELY(heap->ms_incr_phase == DUK_HEAP_INCR_MARK) && duk_heap_mark_and_sweep_defer_free(heap, curr)) {
+			/* Freed when incremental marking is done. */
+		} else
+#endif
+		{
+			duk_free_hobject(heap, (duk_hobject *) curr); /* Invalidates 'curr'. */
+		}
 
 		curr = prev;
 	} while (curr != NULL);
@@ -488,6 +541,20 @@ DUK_LOCAL DUK_INLINE void duk__refcount_refzero_hobject(duk_heap *heap, duk_hobj
 			 * objects pending finalization.
 			 */
 			DUK_HEAPHDR_PREINC_REFCOUNT(hdr);
+#endif
+#if defined(DUK_USE_GENERATIONAL_GC)
+			/* Old objects have a sticky REACHABLE flag, but objects
+			 * on finalize_list must be unmarked.
+			 */
+			DUK_HEAPHDR_CLEAR_REACHABLE(hdr);
+#elif defined(DUK_USE_INCREMENTAL_GC)
+			/* Objects not yet swept by an incremental cycle are
+			 * still marked.  While marking, marks on finalize_list
+			 * are cleared when marking is done.
+			 */
+			if (heap->ms_incr_phase != DUK_HEAP_INCR_MARK) {
+				DUK_HEAPHDR_CLEAR_REACHABLE(hdr);
+			}
 #endif
 			DUK_HEAP_INSERT_INTO_FINALIZE_LIST(heap, hdr);
 
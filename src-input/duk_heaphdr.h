@@ -40,6 +40,7 @@
 #define DUK_HEAPHDR_FLAGS_USER_START    11 /* 21 user flags */
 #define DUK_HEAPHDR_USER_FLAG_NUMBER(n) (DUK_HEAPHDR_FLAGS_USER_START + (n))
 #define DUK_HEAPHDR_USER_FLAG(n)        (1UL << (DUK_HEAPHDR_FLAGS_USER_START + (n)))
+#define DUK_HEAPHDR_FLAGS_USER_MASK     (~(DUK_HEAPHDR_USER_FLAG(0) - 1UL))
 
 #define DUK_HEAPHDR_FLAG_TEMPROOT    0x0040UL /* mark-and-sweep: children not processed */
 #define DUK_HEAPHDR_FLAG_REACHABLE   0x0080UL /* mark-and-sweep: reachable */
@@ -161,11 +162,11 @@
 #define DUK_HTYPE_RESERVED31        31
 /* 0b10xxxx: built-ins etc */
 #define DUK_HTYPE_NONE              32
-#define DUK_HTYPE_RESERVED33        33
-#define DUK_HTYPE_RESERVED34        34
-#define DUK_HTYPE_RESERVED35        35
-#define DUK_HTYPE_RESERVED36        36
-#define DUK_HTYPE_RESERVED37        37
+#define DUK_HTYPE_MAP               33
+#define DUK_HTYPE_SET               34
+#define DUK_HTYPE_WEAKMAP           35
+#define DUK_HTYPE_WEAKSET           36
+#define DUK_HTYPE_PROMISE           37
 #define DUK_HTYPE_RESERVED38        38
 #define DUK_HTYPE_RESERVED39        39
 #define DUK_HTYPE_RESERVED40        40
@@ -233,11 +234,11 @@
 #define DUK_HMASK_THREAD            (DUK_U64_CONSTANT(1) << DUK_HTYPE_THREAD)
 #define DUK_HMASK_PROXY             (DUK_U64_CONSTANT(1) << DUK_HTYPE_PROXY)
 #define DUK_HMASK_RESERVED31        (DUK_U64_CONSTANT(1) << DUK_HTYPE_RESERVED31)
-#define DUK_HMASK_RESERVED33        (DUK_U64_CONSTANT(1) << DUK_HTYPE_RESERVED33)
-#define DUK_HMASK_RESERVED34        (DUK_U64_CONSTANT(1) << DUK_HTYPE_RESERVED34)
-#define DUK_HMASK_RESERVED35        (DUK_U64_CONSTANT(1) << DUK_HTYPE_RESERVED35)
-#define DUK_HMASK_RESERVED36        (DUK_U64_CONSTANT(1) << DUK_HTYPE_RESERVED36)
-#define DUK_HMASK_RESERVED37        (DUK_U64_CONSTANT(1) << DUK_HTYPE_RESERVED37)
+#define DUK_HMASK_MAP               (DUK_U64_CONSTANT(1) << DUK_HTYPE_MAP)
+#define DUK_HMASK_SET               (DUK_U64_CONSTANT(1) << DUK_HTYPE_SET)
+#define DUK_HMASK_WEAKMAP           (DUK_U64_CONSTANT(1) << DUK_HTYPE_WEAKMAP)
+#define DUK_HMASK_WEAKSET           (DUK_U64_CONSTANT(1) << DUK_HTYPE_WEAKSET)
+#define DUK_HMASK_PROMISE           (DUK_U64_CONSTANT(1) << DUK_HTYPE_PROMISE)
 #define DUK_HMASK_RESERVED38        (DUK_U64_CONSTANT(1) << DUK_HTYPE_RESERVED38)
 #define DUK_HMASK_RESERVED39        (DUK_U64_CONSTANT(1) << DUK_HTYPE_RESERVED39)
 #define DUK_HMASK_RESERVED40        (DUK_U64_CONSTANT(1) << DUK_HTYPE_RESERVED40)
@@ -73,6 +73,21 @@ DUK_INTERNAL void duk_heaphdr_assert_valid_subclassed(duk_heap *heap, duk_heaphd
 		DUK_HPROXY_ASSERT_VALID((duk_hproxy *) h);
 		break;
 	}
+#if defined(DUK_USE_COLLECTION_BUILTINS)
+	case DUK_HTYPE_MAP:
+	case DUK_HTYPE_SET:
+	case DUK_HTYPE_WEAKMAP:
+	case DUK_HTYPE_WEAKSET: {
+		DUK_HMAP_ASSERT_VALID((duk_hmap *) h);
+		break;
+	}
+#endif
+#if defined(DUK_USE_PROMISE_BUILTIN)
+	case DUK_HTYPE_PROMISE: {
+		DUK_HPROMISE_ASSERT_VALID((duk_hpromise *) h);
+		break;
+	}
+#endif
 	case DUK_HTYPE_THREAD: {
 		DUK_HTHREAD_ASSERT_VALID((duk_hthread *) h);
 		break;
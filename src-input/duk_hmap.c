@@ -0,0 +1,393 @@
+/*
+ *  Keyed collection (Map, Set, WeakMap, WeakSet) hash table.
+ */
+
+#include "duk_internal.h"
+
+#if defined(DUK_USE_COLLECTION_BUILTINS)
+
+/* Hash a key so that keys which are equal under SameValueZero hash
+ * identically: fastints and doubles must agree, +0 and -0 must agree,
+ * and all NaNs must agree.  Strings are interned so their precomputed
+ * hash is used; other heap allocated values hash on their address.
+ */
+DUK_LOCAL duk_uint32_t duk__hmap_hash(duk_tval *tv) {
+	duk_uint32_t res;
+
+	if (DUK_TVAL_IS_NUMBER(tv)) {
+		duk_double_union du;
+
+		du.d = DUK_TVAL_GET_NUMBER(tv);
+		if (du.d == 0.0) {
+			res = 0;
+		} else if (DUK_ISNAN(du.d)) {
+			res = 0x7ff80000UL;
+		} else {
+			res = du.ui[0] ^ du.ui[1];
+		}
+	} else {
+		switch (DUK_TVAL_GET_TAG(tv)) {
+		case DUK_TAG_UNDEFINED:
+			res = 1;
+			break;
+		case DUK_TAG_NULL:
+			res = 2;
+			break;
+		case DUK_TAG_BOOLEAN:
+			res = 3 + (duk_uint32_t) DUK_TVAL_GET_BOOLEAN(tv);
+			break;
+		case DUK_TAG_POINTER:
+			res = (duk_uint32_t) (duk_uintptr_t) DUK_TVAL_GET_POINTER(tv);
+			break;
+		case DUK_TAG_LIGHTFUNC: {
+			duk_c_function func;
+			duk_small_uint_t lf_flags;
+
+			/* Function pointers can't be portably converted to
+			 * integers, so hash on the flags only.
+			 */
+			DUK_TVAL_GET_LIGHTFUNC(tv, func, lf_flags);
+			DUK_UNREF(func);
+			res = (duk_uint32_t) lf_flags;
+			break;
+		}
+		case DUK_TAG_STRING:
+			return duk_hstring_get_hash(DUK_TVAL_GET_STRING(tv));
+		default:
+			DUK_ASSERT(DUK_TVAL_IS_HEAP_ALLOCATED(tv));
+			res = (duk_uint32_t) ((duk_uintptr_t) DUK_TVAL_GET_HEAPHDR(tv) >> 3);
+			break;
+		}
+	}
+
+	/* Final mix so that aligned addresses and small integers spread
+	 * over the low bits used for bucket selection.
+	 */
+	res ^= res >> 16;
+	res *= 0x85ebca6bUL;
+	res ^= res >> 13;
+	return res;
+}
+
+/* SameValueZero for a stored key and a lookup key.  A deleted entry has an
+ * UNUSED key which never compares equal to a lookup key.
+ */
+DUK_LOCAL duk_bool_t duk__hmap_key_equals(duk_tval *tv_x, duk_tval *tv_y) {
+	if (DUK_TVAL_IS_HEAP_ALLOCATED(tv_x) && DUK_TVAL_IS_HEAP_ALLOCATED(tv_y)) {
+		return DUK_TVAL_GET_HEAPHDR(tv_x) == DUK_TVAL_GET_HEAPHDR(tv_y);
+	}
+	if (DUK_TVAL_IS_NUMBER(tv_x) && DUK_TVAL_IS_NUMBER(tv_y)) {
+		duk_double_t d1 = DUK_TVAL_GET_NUMBER(tv_x);
+		duk_double_t d2 = DUK_TVAL_GET_NUMBER(tv_y);
+		return (d1 == d2 || (DUK_ISNAN(d1) && DUK_ISNAN(d2)));
+	}
+	return duk_js_samevalue(tv_x, tv_y);
+}
+
+DUK_LOCAL duk_uint32_t duk__hmap_lookup(duk_hmap *h, duk_tval *tv_key, duk_uint32_t hash) {
+	duk_uint32_t *chain;
+	duk_uint32_t i;
+
+	if (h->e_size == 0) {
+		return DUK_HMAP_INDEX_NONE;
+	}
+
+	chain = DUK_HMAP_GET_CHAIN(h);
+	i = DUK_HMAP_GET_BUCKETS(h)[hash & (h->e_size - 1U)];
+	while (i != DUK_HMAP_INDEX_NONE) {
+		DUK_ASSERT(i < h->e_next);
+		if (duk__hmap_key_equals(DUK_HMAP_GET_KEY(h, i), tv_key)) {
+			break;
+		}
+		i = chain[i];
+	}
+	return i;
+}
+
+DUK_LOCAL void duk__hmap_link(duk_hmap *h, duk_uint32_t idx, duk_uint32_t hash) {
+	duk_uint32_t *buckets;
+
+	buckets = DUK_HMAP_GET_BUCKETS(h);
+	DUK_HMAP_GET_CHAIN(h)[idx] = buckets[hash & (h->e_size - 1U)];
+	buckets[hash & (h->e_size - 1U)] = idx;
+}
+
+/* Unlink an entry from its hash chain and mark it deleted.  The entry
+ * stays in place so that entry indices remain stable.  The caller is
+ * responsible for the references held by the entry.
+ */
+DUK_LOCAL void duk__hmap_unlink(duk_hmap *h, duk_uint32_t idx) {
+	duk_uint32_t *chain;
+	duk_uint32_t *ptr;
+
+	chain = DUK_HMAP_GET_CHAIN(h);
+	ptr = DUK_HMAP_GET_BUCKETS(h) + (duk__hmap_hash(DUK_HMAP_GET_KEY(h, idx)) & (h->e_size - 1U));
+	while (*ptr != idx) {
+		DUK_ASSERT(*ptr != DUK_HMAP_INDEX_NONE);
+		ptr = chain + *ptr;
+	}
+	*ptr = chain[idx];
+	chain[idx] = DUK_HMAP_INDEX_NONE;
+
+	DUK_TVAL_SET_UNUSED(DUK_HMAP_GET_KEY(h, idx));
+	if (DUK_HMAP_GET_STRIDE(h) == 2U) {
+		DUK_TVAL_SET_UNDEFINED(DUK_HMAP_GET_VALUE(h, idx));
+	}
+	DUK_ASSERT(h->count > 0);
+	h->count--;
+}
+
+/* Reallocate the table so that there's room for at least one more entry.
+ * Deleted entries are compacted away unless a forEach() loop is running,
+ * in which case entry indices must be kept stable.
+ */
+DUK_LOCAL void duk__hmap_resize(duk_hthread *thr, duk_hmap *h) {
+	duk_small_uint_t prev_ms_base_flags;
+	duk_bool_t prev_error_not_allowed;
+	duk_bool_t compact;
+	duk_uint32_t stride;
+	duk_uint32_t used;
+	duk_uint32_t new_e_size;
+	duk_size_t entry_bytes;
+	duk_tval *old_entries;
+	duk_tval *new_entries;
+	duk_uint32_t old_e_next;
+	duk_uint32_t i, j;
+
+	DUK_HMAP_ASSERT_VALID(h);
+
+	compact = (h->iter_count == 0);
+	stride = DUK_HMAP_GET_STRIDE(h);
+	used = (compact ? h->count : h->e_next);
+	new_e_size = DUK_HMAP_MIN_SIZE;
+	while (new_e_size < used + (used >> 1) + 1U && new_e_size < 0x80000000UL) {
+		new_e_size <<= 1;
+	}
+	entry_bytes = sizeof(duk_tval) * stride + 2U * sizeof(duk_uint32_t);
+	if (new_e_size <= used || (duk_size_t) new_e_size > DUK_SIZE_MAX / entry_bytes) {
+		DUK_ERROR_ALLOC_FAILED(thr);
+		DUK_WO_NORETURN(return;);
+	}
+
+	/* Prevent finalizers which might mutate the collection while it's
+	 * being rebuilt.
+	 */
+	duk_hobject_start_critical(thr, &prev_ms_base_flags, DUK_MS_FLAG_NO_OBJECT_COMPACTION, &prev_error_not_allowed);
+	new_entries = (duk_tval *) DUK_ALLOC(thr->heap, (duk_size_t) new_e_size * entry_bytes);
+	duk_hobject_end_critical(thr, &prev_ms_base_flags, &prev_error_not_allowed);
+	if (DUK_UNLIKELY(new_entries == NULL)) {
+		DUK_ERROR_ALLOC_FAILED(thr);
+		DUK_WO_NORETURN(return;);
+	}
+
+	/* Copy only after the allocation: a mark-and-sweep triggered by it
+	 * may have removed weak entries.  Reference counts move with the
+	 * entries as is.
+	 */
+	old_entries = h->entries;
+	old_e_next = h->e_next;
+	j = 0;
+	for (i = 0; i < old_e_next; i++) {
+		duk_tval *tv_src = old_entries + (duk_size_t) i * stride;
+
+		if (compact && DUK_TVAL_IS_UNUSED(tv_src)) {
+			continue;
+		}
+		duk_memcpy((void *) (new_entries + (duk_size_t) j * stride), (const void *) tv_src, sizeof(duk_tval) * stride);
+		j++;
+	}
+	DUK_ASSERT(j < new_e_size);
+
+	h->entries = new_entries;
+	h->e_size = new_e_size;
+	h->e_next = j;
+
+	duk_memset((void *) DUK_HMAP_GET_BUCKETS(h), 0xff, sizeof(duk_uint32_t) * new_e_size);
+	for (i = 0; i < j; i++) {
+		duk_tval *tv_key = DUK_HMAP_GET_KEY(h, i);
+
+		if (DUK_TVAL_IS_UNUSED(tv_key)) {
+			DUK_HMAP_GET_CHAIN(h)[i] = DUK_HMAP_INDEX_NONE;
+			continue;
+		}
+		duk__hmap_link(h, i, duk__hmap_hash(tv_key));
+	}
+
+	DUK_FREE_CHECKED(thr, (void *) old_entries);
+	DUK_HMAP_ASSERT_VALID(h);
+
+	DUK_DD(DUK_DDPRINT("resized collection %p: e_size=%ld, e_next=%ld, count=%ld",
+	                   (void *) h,
+	                   (long) h->e_size,
+	                   (long) h->e_next,
+	                   (long) h->count));
+}
+
+/* Find the entry index of a key, DUK_HMAP_INDEX_NONE if not found. */
+DUK_INTERNAL duk_uint32_t duk_hmap_find(duk_hmap *h, duk_tval *tv_key) {
+	DUK_ASSERT(h != NULL);
+	DUK_ASSERT(tv_key != NULL);
+
+	if (h->count == 0) {
+		return DUK_HMAP_INDEX_NONE;
+	}
+	return duk__hmap_lookup(h, tv_key, duk__hmap_hash(tv_key));
+}
+
+/* Add a key or update the value of an existing key.  For Set variants
+ * 'tv_val' is ignored and may be NULL.
+ */
+DUK_INTERNAL void duk_hmap_put(duk_hthread *thr, duk_hmap *h, duk_tval *tv_key, duk_tval *tv_val) {
+	duk_uint32_t hash;
+	duk_uint32_t idx;
+	duk_tval *tv_slot;
+
+	DUK_ASSERT(thr != NULL);
+	DUK_ASSERT(h != NULL);
+	DUK_ASSERT(tv_key != NULL);
+	DUK_ASSERT(!DUK_TVAL_IS_UNUSED(tv_key));
+	DUK_HMAP_ASSERT_VALID(h);
+
+	hash = duk__hmap_hash(tv_key);
+	idx = duk__hmap_lookup(h, tv_key, hash);
+	if (idx != DUK_HMAP_INDEX_NONE) {
+		if (DUK_HMAP_GET_STRIDE(h) == 2U) {
+			DUK_ASSERT(tv_val != NULL);
+			tv_slot = DUK_HMAP_GET_VALUE(h, idx);
+			DUK_TVAL_SET_TVAL_UPDREF(thr, tv_slot, tv_val); /* side effects */
+		}
+		return;
+	}
+
+	if (h->e_next >= h->e_size) {
+		duk__hmap_resize(thr, h);
+	}
+	DUK_ASSERT(h->e_next < h->e_size);
+
+	idx = h->e_next++;
+	tv_slot = DUK_HMAP_GET_KEY(h, idx);
+	if (DUK_TVAL_IS_NUMBER(tv_key) && DUK_TVAL_GET_NUMBER(tv_key) == 0.0) {
+		/* SameValueZero: -0 is stored as +0. */
+		DUK_TVAL_SET_NUMBER(tv_slot, 0.0);
+	} else {
+		DUK_TVAL_SET_TVAL_INCREF(thr, tv_slot, tv_key);
+	}
+	if (DUK_HMAP_GET_STRIDE(h) == 2U) {
+		DUK_ASSERT(tv_val != NULL);
+		DUK_TVAL_SET_TVAL_INCREF(thr, tv_slot + 1, tv_val);
+	}
+	duk__hmap_link(h, idx, hash);
+	h->count++;
+	DUK_HMAP_ASSERT_VALID(h);
+}
+
+/* Remove a key, return 1 if it was present. */
+DUK_INTERNAL duk_bool_t duk_hmap_remove(duk_hthread *thr, duk_hmap *h, duk_tval *tv_key) {
+	duk_uint32_t idx;
+	duk_uint32_t stride;
+	duk_tval tv_tmp[2];
+
+	DUK_ASSERT(thr != NULL);
+	DUK_ASSERT(h != NULL);
+	DUK_ASSERT(tv_key != NULL);
+	DUK_HMAP_ASSERT_VALID(h);
+
+	idx = duk_hmap_find(h, tv_key);
+	if (idx == DUK_HMAP_INDEX_NONE) {
+		return 0;
+	}
+
+	/* Update the collection fully before DECREFs which may have side
+	 * effects.
+	 */
+	stride = DUK_HMAP_GET_STRIDE(h);
+	duk_memcpy((void *) tv_tmp, (const void *) DUK_HMAP_GET_KEY(h, idx), sizeof(duk_tval) * stride);
+	duk__hmap_unlink(h, idx);
+	DUK_HMAP_ASSERT_VALID(h);
+
+	DUK_TVAL_DECREF_NORZ(thr, &tv_tmp[0]);
+	if (stride == 2U) {
+		DUK_TVAL_DECREF_NORZ(thr, &tv_tmp[1]);
+	}
+	DUK_REFZERO_CHECK_SLOW(thr);
+	return 1;
+}
+
+/* Remove an entry whose key is about to be swept by mark-and-sweep.  Called
+ * with refzero processing suppressed, so plain NORZ DECREFs suffice.
+ */
+DUK_INTERNAL void duk_hmap_remove_index_norz(duk_heap *heap, duk_hmap *h, duk_uint32_t idx) {
+	duk_hthread *thr;
+	duk_uint32_t stride;
+	duk_tval tv_tmp[2];
+
+	DUK_ASSERT(heap != NULL);
+	DUK_ASSERT(h != NULL);
+	DUK_ASSERT(idx < h->e_next);
+	DUK_ASSERT(!DUK_TVAL_IS_UNUSED(DUK_HMAP_GET_KEY(h, idx)));
+
+	thr = heap->heap_thread;
+	DUK_ASSERT(thr != NULL);
+	DUK_UNREF(thr);
+
+	stride = DUK_HMAP_GET_STRIDE(h);
+	duk_memcpy((void *) tv_tmp, (const void *) DUK_HMAP_GET_KEY(h, idx), sizeof(duk_tval) * stride);
+	duk__hmap_unlink(h, idx);
+
+	DUK_TVAL_DECREF_NORZ(thr, &tv_tmp[0]);
+	if (stride == 2U) {
+		DUK_TVAL_DECREF_NORZ(thr, &tv_tmp[1]);
+	}
+}
+
+/* Remove all entries. */
+DUK_INTERNAL void duk_hmap_clear(duk_hthread *thr, duk_hmap *h) {
+	DUK_ASSERT(thr != NULL);
+	DUK_ASSERT(h != NULL);
+	DUK_HMAP_ASSERT_VALID(h);
+
+	if (h->iter_count == 0) {
+		duk_tval *entries;
+		duk_uint32_t n;
+
+		entries = h->entries;
+		n = h->e_next * DUK_HMAP_GET_STRIDE(h);
+
+		/* Detach the table before DECREFs which may have side effects. */
+		h->entries = NULL;
+		h->e_size = 0;
+		h->e_next = 0;
+		h->count = 0;
+		while (n-- > 0) {
+			DUK_TVAL_DECREF_NORZ(thr, entries + n);
+		}
+		DUK_FREE_CHECKED(thr, (void *) entries);
+	} else {
+		/* A forEach() loop is running: keep entry indices stable,
+		 * new entries are appended after the cleared ones.
+		 */
+		duk_uint32_t stride;
+		duk_uint32_t i;
+
+		stride = DUK_HMAP_GET_STRIDE(h);
+		for (i = 0; i < h->e_next; i++) {
+			duk_tval tv_tmp[2];
+
+			if (DUK_TVAL_IS_UNUSED(DUK_HMAP_GET_KEY(h, i))) {
+				continue;
+			}
+			duk_memcpy((void *) tv_tmp, (const void *) DUK_HMAP_GET_KEY(h, i), sizeof(duk_tval) * stride);
+			duk__hmap_unlink(h, i);
+			DUK_TVAL_DECREF_NORZ(thr, &tv_tmp[0]);
+			if (stride == 2U) {
+				DUK_TVAL_DECREF_NORZ(thr, &tv_tmp[1]);
+			}
+		}
+		DUK_ASSERT(h->count == 0);
+	}
+	DUK_HMAP_ASSERT_VALID(h);
+
+	DUK_REFZERO_CHECK_SLOW(thr);
+}
+
+#endif /* DUK_USE_COLLECTION_BUILTINS */
@@ -0,0 +1,94 @@
+/*
+ *  Keyed collection representation, used for Map, Set, WeakMap, and
+ *  WeakSet instances.
+ *
+ *  Entries are kept in insertion order in an entry array; a Map entry is
+ *  a (key, value) pair of duk_tvals while a Set entry is just the key.
+ *  Keys are compared using SameValueZero, and are located through a
+ *  chained hash: bucket heads and per-entry chain links are indices into
+ *  the entry array.  Deleted entries get an UNUSED key and remain in the
+ *  entry array (and their hash chain) until the table is rebuilt, so that
+ *  entry indices stay stable while a forEach() loop is running.
+ *
+ *  Weak variants hold counted references to their keys like the strong
+ *  variants so that a key can never be freed while it's in the table.
+ *  Mark-and-sweep treats the entries as ephemerons: keys are not marked
+ *  through the table, values are marked only when their key is reachable
+ *  through other means, and entries with unreachable keys are removed
+ *  before sweeping.  As a result weakly held keys are released by the
+ *  next mark-and-sweep rather than by reference counting.
+ */
+
+#if !defined(DUK_HMAP_H_INCLUDED)
+#define DUK_HMAP_H_INCLUDED
+
+#if defined(DUK_USE_COLLECTION_BUILTINS)
+
+#if defined(DUK_USE_ASSERTIONS)
+DUK_INTERNAL_DECL void duk_hmap_assert_valid(duk_hmap *h);
+#define DUK_HMAP_ASSERT_VALID(h) \
+	do { \
+		duk_hmap_assert_valid((h)); \
+	} while (0)
+#else
+#define DUK_HMAP_ASSERT_VALID(h) \
+	do { \
+	} while (0)
+#endif
+
+/* Marker for an empty bucket or the end of a hash chain. */
+#define DUK_HMAP_INDEX_NONE 0xffffffffUL
+
+#define DUK_HMAP_MIN_SIZE 4
+
+#define DUK_HTYPE_IS_ANY_HMAP(htype)  ((htype) >= DUK_HTYPE_MAP && (htype) <= DUK_HTYPE_WEAKSET)
+#define DUK_HTYPE_IS_WEAK_HMAP(htype) ((htype) == DUK_HTYPE_WEAKMAP || (htype) == DUK_HTYPE_WEAKSET)
+#define DUK_HTYPE_IS_SET_HMAP(htype)  ((htype) == DUK_HTYPE_SET || (htype) == DUK_HTYPE_WEAKSET)
+
+#define DUK_HMAP_IS_WEAK(h) DUK_HTYPE_IS_WEAK_HMAP(DUK_HOBJECT_GET_HTYPE((h)))
+
+/* Number of duk_tvals per entry: 2 for maps, 1 for sets. */
+#define DUK_HMAP_GET_STRIDE(h) (DUK_HTYPE_IS_SET_HMAP(DUK_HOBJECT_GET_HTYPE((h))) ? 1U : 2U)
+
+#define DUK_HMAP_GET_KEY(h, i)   ((h)->entries + (duk_size_t) (i) * DUK_HMAP_GET_STRIDE((h)))
+#define DUK_HMAP_GET_VALUE(h, i) ((h)->entries + (duk_size_t) (i) * 2U + 1U) /* Map variants only. */
+
+/* Chain links and bucket heads follow the entries in the same allocation;
+ * there are e_size of both.
+ */
+#define DUK_HMAP_GET_CHAIN(h)   ((duk_uint32_t *) (void *) ((h)->entries + (duk_size_t) (h)->e_size * DUK_HMAP_GET_STRIDE((h))))
+#define DUK_HMAP_GET_BUCKETS(h) (DUK_HMAP_GET_CHAIN((h)) + (h)->e_size)
+
+struct duk_hmap {
+	/* Shared object part. */
+	duk_hobject obj;
+
+	/* Entry array, chain links, and bucket heads in a single allocation,
+	 * NULL if the collection has never had entries.
+	 */
+	duk_tval *entries;
+
+	/* Allocated entries (a power of two), entries used so far (including
+	 * deleted ones), and live entries.
+	 */
+	duk_uint32_t e_size;
+	duk_uint32_t e_next;
+	duk_uint32_t count;
+
+	/* Number of forEach() loops in progress.  While non-zero, deleted
+	 * entries are not compacted away.
+	 */
+	duk_uint32_t iter_count;
+
+	/* Mark-and-sweep work list of reachable weak collections. */
+	duk_hmap *ms_next;
+};
+
+DUK_INTERNAL_DECL duk_uint32_t duk_hmap_find(duk_hmap *h, duk_tval *tv_key);
+DUK_INTERNAL_DECL void duk_hmap_put(duk_hthread *thr, duk_hmap *h, duk_tval *tv_key, duk_tval *tv_val);
+DUK_INTERNAL_DECL duk_bool_t duk_hmap_remove(duk_hthread *thr, duk_hmap *h, duk_tval *tv_key);
+DUK_INTERNAL_DECL void duk_hmap_remove_index_norz(duk_heap *heap, duk_hmap *h, duk_uint32_t idx);
+DUK_INTERNAL_DECL void duk_hmap_clear(duk_hthread *thr, duk_hmap *h);
+
+#endif /* DUK_USE_COLLECTION_BUILTINS */
+#endif /* DUK_HMAP_H_INCLUDED */
@@ -48,7 +48,7 @@
 	DUK_HEAPHDR_USER_FLAG(17) /* 'Arguments' object and has arguments exotic behavior (non-strict callee) */
 #define DUK_HOBJECT_FLAG_EXOTIC_PROXYOBJ DUK_HEAPHDR_USER_FLAG(18) /* 'Proxy' object */
 #define DUK_HOBJECT_FLAG_SPECIAL_CALL    DUK_HEAPHDR_USER_FLAG(19) /* special casing in call behavior, for .call(), .apply(), etc. */
-#define DUK_HOBJECT_FLAG_UNUSED20        DUK_HEAPHDR_USER_FLAG(20)
+#define DUK_HOBJECT_FLAG_SHAPED          DUK_HEAPHDR_USER_FLAG(20) /* object keys and attributes are in a shared shape */
 
 #define DUK_HOBJECT_GET_HTYPE(h)      DUK_HEAPHDR_GET_HTYPE((duk_heaphdr *) (h))
 #define DUK_HOBJECT_SET_HTYPE(h, val) DUK_HEAPHDR_SET_HTYPE((duk_heaphdr *) (h), (val))
@@ -86,6 +86,16 @@
 #else
 #define DUK_HOBJECT_IS_PROXY(h) 0
 #endif
+#if defined(DUK_USE_COLLECTION_BUILTINS)
+#define DUK_HOBJECT_IS_HMAP(h) DUK_HTYPE_IS_ANY_HMAP(DUK_HOBJECT_GET_HTYPE((h)))
+#else
+#define DUK_HOBJECT_IS_HMAP(h) 0
+#endif
+#if defined(DUK_USE_PROMISE_BUILTIN)
+#define DUK_HOBJECT_IS_PROMISE(h) (DUK_HOBJECT_GET_HTYPE((h)) == DUK_HTYPE_PROMISE)
+#else
+#define DUK_HOBJECT_IS_PROMISE(h) 0
+#endif
 
 #define DUK_HOBJECT_IS_NONBOUND_FUNCTION(h) \
 	DUK_HEAPHDR_CHECK_FLAG_BITS(&(h)->hdr, DUK_HOBJECT_FLAG_COMPFUNC | DUK_HOBJECT_FLAG_NATFUNC)
@@ -134,6 +144,7 @@
 #define DUK_HOBJECT_HAS_EXOTIC_PROXYOBJ(h) 0
 #endif
 #define DUK_HOBJECT_HAS_SPECIAL_CALL(h) DUK_HEAPHDR_CHECK_FLAG_BITS(&(h)->hdr, DUK_HOBJECT_FLAG_SPECIAL_CALL)
+#define DUK_HOBJECT_HAS_SHAPED(h)       DUK_HEAPHDR_CHECK_FLAG_BITS(&(h)->hdr, DUK_HOBJECT_FLAG_SHAPED)
 
 #define DUK_HOBJECT_SET_EXTENSIBLE(h)    DUK_HEAPHDR_SET_FLAG_BITS(&(h)->hdr, DUK_HOBJECT_FLAG_EXTENSIBLE)
 #define DUK_HOBJECT_SET_CONSTRUCTABLE(h) DUK_HEAPHDR_SET_FLAG_BITS(&(h)->hdr, DUK_HOBJECT_FLAG_CONSTRUCTABLE)
@@ -159,6 +170,7 @@
 #define DUK_HOBJECT_SET_EXOTIC_PROXYOBJ(h) DUK_HEAPHDR_SET_FLAG_BITS(&(h)->hdr, DUK_HOBJECT_FLAG_EXOTIC_PROXYOBJ)
 #endif
 #define DUK_HOBJECT_SET_SPECIAL_CALL(h) DUK_HEAPHDR_SET_FLAG_BITS(&(h)->hdr, DUK_HOBJECT_FLAG_SPECIAL_CALL)
+#define DUK_HOBJECT_SET_SHAPED(h)       DUK_HEAPHDR_SET_FLAG_BITS(&(h)->hdr, DUK_HOBJECT_FLAG_SHAPED)
 
 #define DUK_HOBJECT_CLEAR_EXTENSIBLE(h)    DUK_HEAPHDR_CLEAR_FLAG_BITS(&(h)->hdr, DUK_HOBJECT_FLAG_EXTENSIBLE)
 #define DUK_HOBJECT_CLEAR_CONSTRUCTABLE(h) DUK_HEAPHDR_CLEAR_FLAG_BITS(&(h)->hdr, DUK_HOBJECT_FLAG_CONSTRUCTABLE)
@@ -184,6 +196,7 @@
 #define DUK_HOBJECT_CLEAR_EXOTIC_PROXYOBJ(h) DUK_HEAPHDR_CLEAR_FLAG_BITS(&(h)->hdr, DUK_HOBJECT_FLAG_EXOTIC_PROXYOBJ)
 #endif
 #define DUK_HOBJECT_CLEAR_SPECIAL_CALL(h) DUK_HEAPHDR_CLEAR_FLAG_BITS(&(h)->hdr, DUK_HOBJECT_FLAG_SPECIAL_CALL)
+#define DUK_HOBJECT_CLEAR_SHAPED(h)       DUK_HEAPHDR_CLEAR_FLAG_BITS(&(h)->hdr, DUK_HOBJECT_FLAG_SHAPED)
 
 /* Object can use FASTREFS <=> has no strong reference fields beyond
  * duk_hobject base header.
@@ -191,7 +204,7 @@
 #define DUK_HOBJECT_PROHIBITS_FASTREFS(h) \
 	(DUK_HOBJECT_IS_COMPFUNC((h)) || DUK_HOBJECT_IS_DECENV((h)) || DUK_HOBJECT_IS_OBJENV((h)) || DUK_HOBJECT_IS_BUFOBJ((h)) || \
 	 DUK_HOBJECT_IS_THREAD((h)) || DUK_HOBJECT_IS_PROXY((h)) || DUK_HOBJECT_IS_BOUNDFUNC((h)) || DUK_HOBJECT_IS_ARRAY((h)) || \
-	 DUK_HOBJECT_IS_ARGUMENTS((h)))
+	 DUK_HOBJECT_IS_ARGUMENTS((h)) || DUK_HOBJECT_IS_HMAP((h)) || DUK_HOBJECT_IS_PROMISE((h)))
 #define DUK_HOBJECT_ALLOWS_FASTREFS(h) (!DUK_HOBJECT_PROHIBITS_FASTREFS((h)))
 
 /* Flags used for property attributes in packed flags.  Must fit into 8 bits. */
@@ -398,6 +411,14 @@ struct duk_hobject {
 	duk_uint32_t e_size; /* entry part size */
 	duk_uint32_t e_next; /* index for next new key ([0,e_next[ are gc reachable, above is garbage) */
 #endif
+
+#if defined(DUK_USE_HOBJECT_SHAPES)
+	/* Shared keys and attributes when DUK_HOBJECT_FLAG_SHAPED is set.
+	 * The props allocation then only holds e_size values, there's no
+	 * hash part, and e_next == shape->nkeys.  NULL otherwise.
+	 */
+	duk_hshape *shape;
+#endif
 };
 
 /*
@@ -427,6 +448,12 @@ DUK_INTERNAL_DECL duk_hthread *duk_hthread_alloc(duk_hthread *thr, duk_uint_t ho
 DUK_INTERNAL_DECL duk_hdecenv *duk_hdecenv_alloc(duk_hthread *thr, duk_uint_t hobject_flags);
 DUK_INTERNAL_DECL duk_hobjenv *duk_hobjenv_alloc(duk_hthread *thr, duk_uint_t hobject_flags);
 DUK_INTERNAL_DECL duk_hproxy *duk_hproxy_alloc(duk_hthread *thr, duk_uint_t hobject_flags);
+#if defined(DUK_USE_COLLECTION_BUILTINS)
+DUK_INTERNAL_DECL duk_hmap *duk_hmap_alloc(duk_hthread *thr, duk_uint_t hobject_flags);
+#endif
+#if defined(DUK_USE_PROMISE_BUILTIN)
+DUK_INTERNAL_DECL duk_hpromise *duk_hpromise_alloc(duk_hthread *thr, duk_uint_t hobject_flags);
+#endif
 
 /* resize */
 DUK_INTERNAL_DECL void duk_hobject_realloc_strprops(duk_hthread *thr, duk_hobject *obj, duk_uint32_t new_e_size);
@@ -437,7 +464,15 @@ DUK_INTERNAL_DECL void duk_hobject_resize_arraypart(duk_hthread *thr,
                                                     duk_hobject *obj,
                                                     duk_uint32_t new_a_size);
 #endif
-DUK_INTERNAL_DECL duk_int_t duk_hobject_alloc_strentry_checked(duk_hthread *thr, duk_hobject *obj, duk_hstring *key);
+DUK_INTERNAL_DECL duk_int_t duk_hobject_alloc_strentry_checked(duk_hthread *thr,
+                                                               duk_hobject *obj,
+                                                               duk_hstring *key,
+                                                               duk_uint8_t attrs);
+#if defined(DUK_USE_HOBJECT_SHAPES)
+DUK_INTERNAL_DECL void duk_hobject_init_shape(duk_hthread *thr, duk_hobject *obj);
+DUK_INTERNAL_DECL void duk_hobject_unshape(duk_hthread *thr, duk_hobject *obj);
+DUK_INTERNAL_DECL void duk_hobject_shape_pop_last(duk_hthread *thr, duk_hobject *obj);
+#endif
 DUK_INTERNAL_DECL duk_int_t duk_hobject_alloc_idxentry_checked(duk_hthread *thr, duk_hobject *obj, duk_uint32_t key);
 
 /* low-level property functions */
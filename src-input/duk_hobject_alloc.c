@@ -26,6 +26,9 @@ DUK_LOCAL void duk__init_object_parts(duk_heap *heap, duk_uint_t hobject_flags,
 #if defined(DUK_USE_EXPLICIT_NULL_INIT)
 	duk_hobject_set_proto_raw(heap, obj, NULL);
 	duk_hobject_set_strprops(heap, obj, NULL);
+#if defined(DUK_USE_HOBJECT_SHAPES)
+	obj->shape = NULL;
+#endif
 #endif
 #if defined(DUK_USE_HEAPPTR16)
 	/* Zero encoded pointer is required to match NULL. */
@@ -277,3 +280,42 @@ DUK_INTERNAL duk_hproxy *duk_hproxy_alloc(duk_hthread *thr, duk_uint_t hobject_f
 
 	return res;
 }
+
+#if defined(DUK_USE_COLLECTION_BUILTINS)
+DUK_INTERNAL duk_hmap *duk_hmap_alloc(duk_hthread *thr, duk_uint_t hobject_flags) {
+	duk_hmap *res;
+
+	res = (duk_hmap *) duk__hobject_alloc_init(thr, hobject_flags, sizeof(duk_hmap));
+	DUK_ASSERT(DUK_HTYPE_IS_ANY_HMAP(DUK_HOBJECT_GET_HTYPE(res)));
+#if defined(DUK_USE_EXPLICIT_NULL_INIT)
+	res->entries = NULL;
+	res->ms_next = NULL;
+#endif
+	DUK_ASSERT(res->entries == NULL);
+	DUK_ASSERT(res->e_size == 0);
+	DUK_ASSERT(res->e_next == 0);
+	DUK_ASSERT(res->count == 0);
+	DUK_ASSERT(res->iter_count == 0);
+
+	return res;
+}
+#endif /* DUK_USE_COLLECTION_BUILTINS */
+
+#if defined(DUK_USE_PROMISE_BUILTIN)
+DUK_INTERNAL duk_hpromise *duk_hpromise_alloc(duk_hthread *thr, duk_uint_t hobject_flags) {
+	duk_hpromise *res;
+
+	res = (duk_hpromise *) duk__hobject_alloc_init(thr, hobject_flags, sizeof(duk_hpromise));
+	DUK_ASSERT(DUK_HOBJECT_GET_HTYPE(res) == DUK_HTYPE_PROMISE);
+	DUK_TVAL_SET_UNDEFINED(&res->value);
+#if defined(DUK_USE_EXPLICIT_NULL_INIT)
+	res->reactions = NULL;
+#endif
+	DUK_ASSERT(res->reactions == NULL);
+	DUK_ASSERT(res->resolve_gen == 0);
+	DUK_ASSERT(res->all_remaining == 0);
+	DUK_ASSERT(res->state == DUK_HPROMISE_STATE_PENDING);
+
+	return res;
+}
+#endif /* DUK_USE_PROMISE_BUILTIN */
@@ -55,6 +55,19 @@ DUK_INTERNAL void duk_hobject_assert_valid(duk_heap *heap, duk_hobject *h) {
 		DUK_ASSERT(!DUK_HSTRING_HAS_ARRIDX(k1));
 	}
 
+#if defined(DUK_USE_HOBJECT_SHAPES)
+	/* Shaped objects have no hash part and no deleted keys. */
+	if (DUK_HOBJECT_HAS_SHAPED(h)) {
+		DUK_ASSERT(h->shape != NULL);
+		DUK_ASSERT(h->shape->nkeys == duk_hobject_get_enext(h));
+		DUK_ASSERT(h->shape->nkeys <= DUK_HSHAPE_MAX_KEYS);
+		DUK_ASSERT(duk_hobject_get_strhash(heap, h) == NULL);
+		for (i = 0; i < duk_hobject_get_enext(h); i++) {
+			DUK_ASSERT(DUK_HSHAPE_GET_KEYS(h->shape)[i] != NULL);
+		}
+	}
+#endif
+
 	/* If an object has a linear array items part, it must not have an
 	 * index key part.
 	 */
@@ -212,6 +225,28 @@ DUK_INTERNAL void duk_hproxy_assert_valid(duk_hproxy *h) {
 	DUK_ASSERT(DUK_HOBJECT_HAS_EXOTIC_PROXYOBJ((duk_hobject *) h));
 }
 
+#if defined(DUK_USE_COLLECTION_BUILTINS)
+DUK_INTERNAL void duk_hmap_assert_valid(duk_hmap *h) {
+	DUK_ASSERT(h != NULL);
+	DUK_ASSERT(DUK_HTYPE_IS_ANY_HMAP(DUK_HOBJECT_GET_HTYPE((duk_hobject *) h)));
+	DUK_ASSERT((h->entries == NULL) == (h->e_size == 0));
+	DUK_ASSERT((h->e_size & (h->e_size - 1U)) == 0);
+	DUK_ASSERT(h->e_next <= h->e_size);
+	DUK_ASSERT(h->count <= h->e_next);
+}
+#endif
+
+#if defined(DUK_USE_PROMISE_BUILTIN)
+DUK_INTERNAL void duk_hpromise_assert_valid(duk_hpromise *h) {
+	DUK_ASSERT(h != NULL);
+	DUK_ASSERT(DUK_HOBJECT_GET_HTYPE((duk_hobject *) h) == DUK_HTYPE_PROMISE);
+	DUK_ASSERT(h->state == DUK_HPROMISE_STATE_PENDING || h->state == DUK_HPROMISE_STATE_FULFILLED ||
+	           h->state == DUK_HPROMISE_STATE_REJECTED);
+	DUK_ASSERT(h->state == DUK_HPROMISE_STATE_PENDING || h->reactions == NULL);
+	DUK_ASSERT(h->state != DUK_HPROMISE_STATE_PENDING || DUK_TVAL_IS_UNDEFINED(&h->value));
+}
+#endif
+
 DUK_INTERNAL void duk_hthread_assert_valid(duk_hthread *thr) {
 	DUK_ASSERT(thr != NULL);
 	DUK_ASSERT(DUK_HEAPHDR_GET_HTYPE((duk_heaphdr *) thr) == DUK_HTYPE_THREAD);
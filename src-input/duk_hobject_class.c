@@ -88,6 +88,21 @@
 #if (DUK_STRIDX_FLOAT64_ARRAY > 255)
 #error constant too large
 #endif
+#if (DUK_STRIDX_UC_MAP > 255)
+#error constant too large
+#endif
+#if (DUK_STRIDX_UC_SET > 255)
+#error constant too large
+#endif
+#if (DUK_STRIDX_WEAK_MAP > 255)
+#error constant too large
+#endif
+#if (DUK_STRIDX_WEAK_SET > 255)
+#error constant too large
+#endif
+#if (DUK_STRIDX_PROMISE > 255)
+#error constant too large
+#endif
 #if (DUK_STRIDX_EMPTY_STRING > 255)
 #error constant too large
 #endif
@@ -111,8 +126,8 @@ DUK_INTERNAL duk_uint8_t duk_htype_to_stridx[64] = {
 	DUK_STRIDX_UC_OBJECT, /* Proxy, final result depends on callability */
 	DUK_STRIDX_EMPTY_STRING,
 
-	DUK_STRIDX_EMPTY_STRING,  DUK_STRIDX_EMPTY_STRING, DUK_STRIDX_EMPTY_STRING,
-	DUK_STRIDX_EMPTY_STRING,  DUK_STRIDX_EMPTY_STRING, DUK_STRIDX_EMPTY_STRING,
+	DUK_STRIDX_EMPTY_STRING,  DUK_STRIDX_UC_MAP,       DUK_STRIDX_UC_SET,
+	DUK_STRIDX_WEAK_MAP,      DUK_STRIDX_WEAK_SET,     DUK_STRIDX_PROMISE,
 	DUK_STRIDX_EMPTY_STRING,  DUK_STRIDX_EMPTY_STRING,
 
 	DUK_STRIDX_EMPTY_STRING,  DUK_STRIDX_EMPTY_STRING, DUK_STRIDX_EMPTY_STRING,
@@ -7,7 +7,6 @@ DUK_INTERNAL duk_bool_t duk_hobject_lookup_strprop_index(duk_hthread *thr,
 #if defined(DUK_USE_HOBJECT_HASH_PART)
 	duk_uint32_t *hash;
 #endif
-	duk_propvalue *val_base;
 	duk_hstring **key_base;
 
 	DUK_ASSERT(thr != NULL);
@@ -16,9 +15,8 @@ DUK_INTERNAL duk_bool_t duk_hobject_lookup_strprop_index(duk_hthread *thr,
 	DUK_ASSERT(key != NULL);
 	DUK_ASSERT(out_idx != NULL);
 
-	val_base = duk_hobject_get_strprops(thr->heap, obj);
-	key_base = (duk_hstring **) (void *) (val_base + duk_hobject_get_esize(obj));
-	/* attr_base not needed */
+	key_base = duk_hobject_get_strprops_keys(thr->heap, obj);
+	/* val_base and attr_base not needed */
 
 #if defined(DUK_USE_HOBJECT_HASH_PART)
 	hash = duk_hobject_get_strhash(thr->heap, obj);
@@ -101,8 +99,7 @@ DUK_INTERNAL duk_bool_t duk_hobject_lookup_strprop_val_attrs(duk_hthread *thr,
 	DUK_ASSERT(out_valptr != NULL);
 	DUK_ASSERT(out_attrs != NULL);
 
-	val_base = duk_hobject_get_strprops(thr->heap, obj);
-	key_base = (duk_hstring **) (void *) (val_base + duk_hobject_get_esize(obj));
+	duk_hobject_get_strprops_key_attr(thr->heap, obj, &val_base, &key_base, &attr_base);
 
 #if defined(DUK_USE_HOBJECT_HASH_PART)
 	hash = duk_hobject_get_strhash(thr->heap, obj);
@@ -115,7 +112,6 @@ DUK_INTERNAL duk_bool_t duk_hobject_lookup_strprop_val_attrs(duk_hthread *thr,
 		n = duk_hobject_get_enext(obj);
 		for (i = 0; i < n; i++) {
 			if (key_base[i] == key) {
-				attr_base = (duk_uint8_t *) (void *) (key_base + duk_hobject_get_esize(obj));
 				*out_valptr = val_base + i;
 				*out_attrs = *(attr_base + i);
 				return 1;
@@ -148,7 +144,6 @@ DUK_INTERNAL duk_bool_t duk_hobject_lookup_strprop_val_attrs(duk_hthread *thr,
 			if (DUK_LIKELY(t < 0x80000000UL)) {
 				DUK_ASSERT(t < duk_hobject_get_esize(obj));
 				if (DUK_LIKELY(key_base[t] == key)) {
-					attr_base = (duk_uint8_t *) (void *) (key_base + duk_hobject_get_esize(obj));
 					*out_valptr = val_base + t;
 					*out_attrs = *(attr_base + t);
 					return 1;
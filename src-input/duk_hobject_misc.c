@@ -100,8 +100,18 @@ DUK_INTERNAL void duk_hobject_get_strprops_key_attr(duk_heap *heap,
 	duk_uint8_t *attr_base;
 
 	val_base = duk_hobject_get_strprops(heap, obj);
-	key_base = (duk_hstring **) (void *) (val_base + duk_hobject_get_esize(obj));
-	attr_base = (duk_uint8_t *) (void *) (key_base + duk_hobject_get_esize(obj));
+#if defined(DUK_USE_HOBJECT_SHAPES)
+	if (DUK_HOBJECT_HAS_SHAPED(obj)) {
+		DUK_ASSERT(obj->shape != NULL);
+		DUK_ASSERT(obj->shape->nkeys == duk_hobject_get_enext(obj));
+		key_base = DUK_HSHAPE_GET_KEYS(obj->shape);
+		attr_base = DUK_HSHAPE_GET_ATTRS(obj->shape);
+	} else
+#endif
+	{
+		key_base = (duk_hstring **) (void *) (val_base + duk_hobject_get_esize(obj));
+		attr_base = (duk_uint8_t *) (void *) (key_base + duk_hobject_get_esize(obj));
+	}
 
 	*out_val_base = val_base;
 	*out_key_base = key_base;
@@ -121,6 +131,12 @@ DUK_INTERNAL duk_propvalue *duk_hobject_get_strprops(duk_heap *heap, duk_hobject
 }
 
 DUK_INTERNAL duk_hstring **duk_hobject_get_strprops_keys(duk_heap *heap, duk_hobject *h) {
+#if defined(DUK_USE_HOBJECT_SHAPES)
+	if (DUK_HOBJECT_HAS_SHAPED(h)) {
+		DUK_ASSERT(h->shape != NULL);
+		return DUK_HSHAPE_GET_KEYS(h->shape);
+	}
+#endif
 	return (duk_hstring **) (void *) (duk_hobject_get_strprops(heap, h) + duk_hobject_get_esize(h));
 }
 
@@ -129,6 +145,12 @@ DUK_INTERNAL duk_propvalue *duk_hobject_get_strprops_values(duk_heap *heap, duk_
 }
 
 DUK_INTERNAL duk_uint8_t *duk_hobject_get_strprops_attrs(duk_heap *heap, duk_hobject *h) {
+#if defined(DUK_USE_HOBJECT_SHAPES)
+	if (DUK_HOBJECT_HAS_SHAPED(h)) {
+		DUK_ASSERT(h->shape != NULL);
+		return DUK_HSHAPE_GET_ATTRS(h->shape);
+	}
+#endif
 	return (duk_uint8_t *) (void *) ((duk_uint8_t *) duk_hobject_get_strprops(heap, h) +
 	                                 duk_hobject_get_esize(h) * (sizeof(duk_propvalue) + sizeof(duk_hstring *)));
 }
@@ -245,6 +267,11 @@ DUK_INTERNAL duk_size_t duk_hobject_compute_strhash_size(duk_uint32_t n_hash) {
 DUK_INTERNAL duk_size_t duk_hobject_get_ebytes(duk_hobject *h) {
 	DUK_ASSERT(h != NULL);
 
+#if defined(DUK_USE_HOBJECT_SHAPES)
+	if (DUK_HOBJECT_HAS_SHAPED(h)) {
+		return duk_hobject_get_esize(h) * sizeof(duk_propvalue);
+	}
+#endif
 	return duk_hobject_compute_strprops_size(duk_hobject_get_esize(h));
 }
 
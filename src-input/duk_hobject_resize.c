@@ -277,7 +277,12 @@ DUK_LOCAL void duk__hobject_realloc_strprops_post_assert(duk_hthread *thr, duk_h
 }
 #endif /* DUK_USE_ASSERTIONS */
 
-DUK_INTERNAL void duk_hobject_realloc_strprops(duk_hthread *thr, duk_hobject *obj, duk_uint32_t new_e_size) {
+/* When 'shaped' is set the result only has a values array and keys and
+ * attributes remain in the (unchanged) shape; the object must be shaped
+ * already.  Otherwise the result is a normal property table, and a shaped
+ * object loses its shape.
+ */
+DUK_LOCAL void duk__hobject_realloc_strprops_raw(duk_hthread *thr, duk_hobject *obj, duk_uint32_t new_e_size, duk_bool_t shaped) {
 	duk_small_uint_t prev_ms_base_flags;
 	duk_bool_t prev_error_not_allowed;
 #if defined(DUK_USE_HOBJECT_HASH_PART)
@@ -305,8 +310,16 @@ DUK_INTERNAL void duk_hobject_realloc_strprops(duk_hthread *thr, duk_hobject *ob
 	duk__hobject_realloc_strprops_pre_assert(thr, obj);
 #endif
 
+#if defined(DUK_USE_HOBJECT_SHAPES)
+	DUK_ASSERT(!shaped || DUK_HOBJECT_HAS_SHAPED(obj));
+	DUK_ASSERT(!shaped || new_e_size <= DUK_HSHAPE_MAX_KEYS);
+#else
+	DUK_ASSERT(shaped == 0);
+	DUK_UNREF(shaped);
+#endif
+
 #if defined(DUK_USE_HOBJECT_HASH_PART)
-	new_h_size = duk__compute_hash_size(new_e_size);
+	new_h_size = shaped ? 0 : duk__compute_hash_size(new_e_size);
 	DUK_ASSERT(new_h_size == 0 || new_h_size >= new_e_size); /* Required to guarantee success of rehashing. */
 #endif
 
@@ -366,7 +379,11 @@ DUK_INTERNAL void duk_hobject_realloc_strprops(duk_hthread *thr, duk_hobject *ob
 		 *
 		 * Alloc size wrapping prevented by maximum property count.
 		 */
-		new_p_alloc_size = duk_hobject_compute_strprops_size(new_e_size);
+		if (shaped) {
+			new_p_alloc_size = new_e_size * sizeof(duk_propvalue);
+		} else {
+			new_p_alloc_size = duk_hobject_compute_strprops_size(new_e_size);
+		}
 		DUK_ASSERT(new_p_alloc_size > 0U);
 		new_p = (duk_uint8_t *) DUK_ALLOC(thr->heap, new_p_alloc_size);
 		if (new_p == NULL) {
@@ -402,8 +419,22 @@ DUK_INTERNAL void duk_hobject_realloc_strprops(duk_hthread *thr, duk_hobject *ob
 	new_e_next = 0;
 	DUK_ASSERT((new_p != NULL) || (new_e_k == NULL && new_e_pv == NULL && new_e_f == NULL));
 
-	/* Copy and compact keys and values in the entry part. */
-	new_e_next = duk__hobject_realloc_strprops_copykeys(thr, obj, new_e_k, new_e_pv, new_e_f, new_e_next);
+#if defined(DUK_USE_HOBJECT_SHAPES)
+	if (shaped) {
+		/* Shaped objects have no deleted keys, so values are copied
+		 * as is without compaction.
+		 */
+		new_e_next = duk_hobject_get_enext(obj);
+		DUK_ASSERT(new_e_next <= new_e_size);
+		duk_memcpy_unsafe((void *) new_e_pv,
+		                  (const void *) duk_hobject_get_strprops(thr->heap, obj),
+		                  sizeof(duk_propvalue) * new_e_next);
+	} else
+#endif
+	{
+		/* Copy and compact keys and values in the entry part. */
+		new_e_next = duk__hobject_realloc_strprops_copykeys(thr, obj, new_e_k, new_e_pv, new_e_f, new_e_next);
+	}
 
 	/* Rebuild the hash part always from scratch (guaranteed to finish
 	 * as long as caller gave consistent parameters).  Rehashing is
@@ -431,6 +462,17 @@ DUK_INTERNAL void duk_hobject_realloc_strprops(duk_hthread *thr, duk_hobject *ob
 #endif
 	duk_hobject_set_esize(obj, new_e_size);
 	duk_hobject_set_enext(obj, new_e_next);
+#if defined(DUK_USE_HOBJECT_SHAPES)
+	if (!shaped && DUK_HOBJECT_HAS_SHAPED(obj)) {
+		/* Keys and attributes were copied from the shape, it is no
+		 * longer needed.  The object keeps its own key references.
+		 */
+		DUK_DDD(DUK_DDDPRINT("object %p dropped shape %p", (void *) obj, (void *) obj->shape));
+		DUK_HOBJECT_CLEAR_SHAPED(obj);
+		duk_hshape_decref(thr->heap, obj->shape);
+		obj->shape = NULL;
+	}
+#endif
 
 	DUK_DDD(DUK_DDDPRINT("resize result: %!O", (duk_heaphdr *) obj));
 
@@ -457,6 +499,66 @@ alloc_failed:
 	DUK_WO_NORETURN(return;);
 }
 
+DUK_INTERNAL void duk_hobject_realloc_strprops(duk_hthread *thr, duk_hobject *obj, duk_uint32_t new_e_size) {
+#if defined(DUK_USE_HOBJECT_SHAPES)
+	/* Objects growing beyond the maximum shape size get a private
+	 * property table.
+	 */
+	if (DUK_HOBJECT_HAS_SHAPED(obj) && new_e_size <= DUK_HSHAPE_MAX_KEYS) {
+		duk__hobject_realloc_strprops_raw(thr, obj, new_e_size, 1 /*shaped*/);
+		return;
+	}
+#endif
+	duk__hobject_realloc_strprops_raw(thr, obj, new_e_size, 0 /*shaped*/);
+}
+
+#if defined(DUK_USE_HOBJECT_SHAPES)
+/* Make an empty object start from the root shape. */
+DUK_INTERNAL void duk_hobject_init_shape(duk_hthread *thr, duk_hobject *obj) {
+	DUK_ASSERT(thr != NULL);
+	DUK_ASSERT(obj != NULL);
+	DUK_ASSERT(!DUK_HOBJECT_HAS_SHAPED(obj));
+	DUK_ASSERT(duk_hobject_get_strprops(thr->heap, obj) == NULL);
+	DUK_ASSERT(duk_hobject_get_esize(obj) == 0);
+	DUK_ASSERT(duk_hobject_get_enext(obj) == 0);
+
+	obj->shape = &thr->heap->shape_root;
+	DUK_HSHAPE_INCREF(obj->shape);
+	DUK_HOBJECT_SET_SHAPED(obj);
+}
+
+/* Convert a shaped object to use a private property table, e.g. before
+ * modifying key attributes in place.
+ */
+DUK_INTERNAL void duk_hobject_unshape(duk_hthread *thr, duk_hobject *obj) {
+	DUK_ASSERT(thr != NULL);
+	DUK_ASSERT(obj != NULL);
+	DUK_ASSERT(DUK_HOBJECT_HAS_SHAPED(obj));
+
+	duk__hobject_realloc_strprops_raw(thr, obj, duk_hobject_get_esize(obj), 0 /*shaped*/);
+	DUK_ASSERT(!DUK_HOBJECT_HAS_SHAPED(obj));
+}
+
+/* Remove the most recently added key by transitioning back to the parent
+ * shape.  Caller handles the value and DECREFs the key.
+ */
+DUK_INTERNAL void duk_hobject_shape_pop_last(duk_hthread *thr, duk_hobject *obj) {
+	duk_hshape *shape;
+
+	DUK_ASSERT(thr != NULL);
+	DUK_ASSERT(obj != NULL);
+	DUK_ASSERT(DUK_HOBJECT_HAS_SHAPED(obj));
+	DUK_ASSERT(duk_hobject_get_enext(obj) > 0);
+
+	shape = obj->shape;
+	DUK_ASSERT(shape->parent != NULL);
+	obj->shape = shape->parent;
+	DUK_HSHAPE_INCREF(obj->shape);
+	duk_hshape_decref(thr->heap, shape);
+	duk_hobject_set_enext(obj, duk_hobject_get_enext(obj) - 1);
+}
+#endif /* DUK_USE_HOBJECT_SHAPES */
+
 /* Abandon array items, moving array entries into entries part.  This requires a
  * props resize, which is a heavy operation.  We also compact the entries part
  * while we're at it, although this is not strictly required.  With a separate
@@ -786,9 +888,11 @@ alloc_failed:
  *  Allocate and initialize a new entry, resizing the properties allocation
  *  if necessary.  Returns entry index (e_idx) or throws an error if alloc fails.
  *
- *  Sets the key of the entry (increasing the key's refcount), and updates
- *  the hash part if it exists.  Caller must set value and flags, and update
- *  the entry value refcount.  A decref for the previous value is not necessary.
+ *  Sets the key and attributes of the entry (increasing the key's refcount),
+ *  and updates the hash part if it exists.  Attributes are set here because
+ *  they're part of the shape for shaped objects.  Caller must set the value
+ *  and update the entry value refcount.  A decref for the previous value is
+ *  not necessary.
  */
 
 DUK_LOCAL DUK_NOINLINE void duk__grow_strprops_for_new_entry_item(duk_hthread *thr, duk_hobject *obj) {
@@ -824,7 +928,10 @@ DUK_LOCAL DUK_NOINLINE void duk__grow_strprops_for_new_entry_item(duk_hthread *t
 	duk_hobject_realloc_strprops(thr, obj, new_e_size);
 }
 
-DUK_INTERNAL duk_int_t duk_hobject_alloc_strentry_checked(duk_hthread *thr, duk_hobject *obj, duk_hstring *key) {
+DUK_INTERNAL duk_int_t duk_hobject_alloc_strentry_checked(duk_hthread *thr,
+                                                          duk_hobject *obj,
+                                                          duk_hstring *key,
+                                                          duk_uint8_t attrs) {
 #if defined(DUK_USE_HOBJECT_HASH_PART)
 	duk_uint32_t *h_base;
 #endif
@@ -842,10 +949,33 @@ DUK_INTERNAL duk_int_t duk_hobject_alloc_strentry_checked(duk_hthread *thr, duk_
 		duk__grow_strprops_for_new_entry_item(thr, obj);
 	}
 	DUK_ASSERT(duk_hobject_get_enext(obj) < duk_hobject_get_esize(obj));
+
+#if defined(DUK_USE_HOBJECT_SHAPES)
+	/* The grow above may have dropped the shape.  The transition is
+	 * looked up last so that a failed allocation never leaves an
+	 * unreferenced shape behind.
+	 */
+	if (DUK_HOBJECT_HAS_SHAPED(obj)) {
+		duk_hshape *old_shape;
+		duk_hshape *new_shape;
+
+		old_shape = obj->shape;
+		new_shape = duk_hshape_transition(thr, old_shape, key, attrs);
+		DUK_HSHAPE_INCREF(new_shape);
+		obj->shape = new_shape;
+		duk_hshape_decref(thr->heap, old_shape); /* never frees, 'new_shape' is a child */
+		idx = duk_hobject_postinc_enext(obj);
+		DUK_ASSERT(idx + 1 == new_shape->nkeys);
+		DUK_HSTRING_INCREF(thr, key);
+		return (duk_int_t) idx;
+	}
+#endif
+
 	idx = duk_hobject_postinc_enext(obj);
 
 	/* previous value is assumed to be garbage, so don't touch it */
 	DUK_HOBJECT_E_SET_KEY(thr->heap, obj, idx, key);
+	DUK_HOBJECT_E_GET_FLAGS(thr->heap, obj, idx) = attrs;
 	DUK_HSTRING_INCREF(thr, key);
 
 #if defined(DUK_USE_HOBJECT_HASH_PART)
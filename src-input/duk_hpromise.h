@@ -0,0 +1,93 @@
+/*
+ *  Promise object representation.
+ *
+ *  Reactions registered with then() and the jobs queued when a Promise
+ *  settles use the same record type: when a Promise settles, each of its
+ *  pending reaction records is given the settled value and moved as is to
+ *  the heap level job queue, without allocating anything.  Records are
+ *  plain allocations which hold counted references to their values; they
+ *  are reachable through their Promise or through the job queue only.
+ *
+ *  Built-in then() and the internal Promise.all() and Promise.race()
+ *  plumbing use records directly instead of creating resolve/reject
+ *  function objects and handler closures.  Resolve/reject function pairs
+ *  are only needed when they're visible to calling code, i.e. for the
+ *  Promise executor and for user thenables.
+ */
+
+#if !defined(DUK_HPROMISE_H_INCLUDED)
+#define DUK_HPROMISE_H_INCLUDED
+
+#if defined(DUK_USE_PROMISE_BUILTIN)
+
+#if defined(DUK_USE_ASSERTIONS)
+DUK_INTERNAL_DECL void duk_hpromise_assert_valid(duk_hpromise *h);
+#define DUK_HPROMISE_ASSERT_VALID(h) \
+	do { \
+		duk_hpromise_assert_valid((h)); \
+	} while (0)
+#else
+#define DUK_HPROMISE_ASSERT_VALID(h) \
+	do { \
+	} while (0)
+#endif
+
+#define DUK_HPROMISE_STATE_PENDING   0
+#define DUK_HPROMISE_STATE_FULFILLED 1
+#define DUK_HPROMISE_STATE_REJECTED  2
+
+/* Job record types. */
+#define DUK_PROMISE_JOB_REACTION    0 /* then() reaction or plain forwarding to 'target' */
+#define DUK_PROMISE_JOB_ALL_ELEMENT 1 /* Promise.all() element */
+#define DUK_PROMISE_JOB_THENABLE    2 /* PromiseResolveThenableJob */
+
+struct duk_promise_job {
+	duk_promise_job *next;
+
+	/* Promise to settle with the job result, NULL if none. */
+	duk_hpromise *target;
+
+	/* REACTION: onFulfilled and onRejected handlers, undefined for
+	 * pass-through.  ALL_ELEMENT: values array in 'handler_f'.
+	 * THENABLE: then() function in 'handler_f'.
+	 */
+	duk_tval handler_f;
+	duk_tval handler_r;
+
+	/* Settled value once queued.  THENABLE: the thenable. */
+	duk_tval value;
+
+	/* ALL_ELEMENT: index into values array. */
+	duk_uint32_t index;
+
+	duk_uint8_t type;
+	duk_uint8_t rejected;
+};
+
+struct duk_hpromise {
+	/* Shared object part. */
+	duk_hobject obj;
+
+	/* Fulfillment value or rejection reason once settled. */
+	duk_tval value;
+
+	/* Pending reactions, newest first.  Always NULL once settled. */
+	duk_promise_job *reactions;
+
+	/* Resolve/reject function pairs record the current generation when
+	 * created; calling a function of the pair bumps the generation which
+	 * neutralizes the pair (ES2015 [[AlreadyResolved]]).  At most the
+	 * newest pair is live at any time.
+	 */
+	duk_uint32_t resolve_gen;
+
+	/* Promise.all() result: number of elements not yet fulfilled. */
+	duk_uint32_t all_remaining;
+
+	duk_uint8_t state;
+};
+
+DUK_INTERNAL_DECL duk_bool_t duk_promise_run_job(duk_hthread *thr);
+
+#endif /* DUK_USE_PROMISE_BUILTIN */
+#endif /* DUK_HPROMISE_H_INCLUDED */
@@ -0,0 +1,112 @@
+/*
+ *  Shape transition tree management.
+ */
+
+#include "duk_internal.h"
+
+#if defined(DUK_USE_HOBJECT_SHAPES)
+
+DUK_LOCAL duk_hshape *duk__hshape_alloc_child(duk_hthread *thr, duk_hshape *parent, duk_hstring *key, duk_uint8_t attrs) {
+	duk_small_uint_t prev_ms_base_flags;
+	duk_bool_t prev_error_not_allowed;
+	duk_hshape *res;
+	duk_uint32_t nkeys;
+	duk_hstring **keys;
+	duk_uint8_t *attr_base;
+
+	DUK_ASSERT(parent->nkeys < DUK_HSHAPE_MAX_KEYS);
+
+	/* Allocation may trigger GC which may free other shapes (but not
+	 * 'parent', which is referenced by the caller's object).  Prevent
+	 * finalizers and compaction like for property table resizes.
+	 */
+	nkeys = parent->nkeys + 1;
+	duk_hobject_start_critical(thr, &prev_ms_base_flags, DUK_MS_FLAG_NO_OBJECT_COMPACTION, &prev_error_not_allowed);
+	res = (duk_hshape *) DUK_ALLOC(thr->heap, sizeof(duk_hshape) + nkeys * (sizeof(duk_hstring *) + sizeof(duk_uint8_t)));
+	duk_hobject_end_critical(thr, &prev_ms_base_flags, &prev_error_not_allowed);
+	if (DUK_UNLIKELY(res == NULL)) {
+		DUK_ERROR_ALLOC_FAILED(thr);
+		DUK_WO_NORETURN(return NULL;);
+	}
+
+	res->refcount = 0;
+	res->nkeys = nkeys;
+	res->parent = parent;
+	res->child = NULL;
+
+	keys = DUK_HSHAPE_GET_KEYS(res);
+	attr_base = DUK_HSHAPE_GET_ATTRS(res);
+	duk_memcpy_unsafe((void *) keys, (const void *) DUK_HSHAPE_GET_KEYS(parent), sizeof(duk_hstring *) * parent->nkeys);
+	duk_memcpy_unsafe((void *) attr_base, (const void *) DUK_HSHAPE_GET_ATTRS(parent), sizeof(duk_uint8_t) * parent->nkeys);
+	keys[nkeys - 1] = key;
+	attr_base[nkeys - 1] = attrs;
+
+	res->sibling = parent->child;
+	parent->child = res;
+	DUK_HSHAPE_INCREF(parent);
+
+	DUK_DDD(DUK_DDDPRINT("created shape %p with %ld keys, parent %p", (void *) res, (long) nkeys, (void *) parent));
+	return res;
+}
+
+/* Get the shape resulting from adding (key, attrs) to 'shape', creating
+ * it if necessary.  The result is not INCREF'd.  A found transition is
+ * moved to the front of the child list so that the most common layouts
+ * are found quickly.
+ */
+DUK_INTERNAL duk_hshape *duk_hshape_transition(duk_hthread *thr, duk_hshape *shape, duk_hstring *key, duk_uint8_t attrs) {
+	duk_hshape *prev;
+	duk_hshape *curr;
+
+	DUK_ASSERT(thr != NULL);
+	DUK_ASSERT(shape != NULL);
+	DUK_ASSERT(key != NULL);
+
+	prev = NULL;
+	for (curr = shape->child; curr != NULL; curr = curr->sibling) {
+		DUK_ASSERT(curr->nkeys == shape->nkeys + 1);
+		if (DUK_HSHAPE_GET_KEYS(curr)[shape->nkeys] == key && DUK_HSHAPE_GET_ATTRS(curr)[shape->nkeys] == attrs) {
+			if (prev != NULL) {
+				prev->sibling = curr->sibling;
+				curr->sibling = shape->child;
+				shape->child = curr;
+			}
+			return curr;
+		}
+		prev = curr;
+	}
+
+	return duk__hshape_alloc_child(thr, shape, key, attrs);
+}
+
+/* Release a shape reference, freeing the shape (and possibly its parents)
+ * when the last reference goes away.  The root shape is never freed.
+ */
+DUK_INTERNAL void duk_hshape_decref(duk_heap *heap, duk_hshape *shape) {
+	DUK_ASSERT(heap != NULL);
+
+	for (;;) {
+		duk_hshape *parent;
+		duk_hshape **ptr;
+
+		DUK_ASSERT(shape != NULL);
+		DUK_ASSERT(shape->refcount > 0);
+		if (--shape->refcount > 0 || shape == &heap->shape_root) {
+			return;
+		}
+		DUK_ASSERT(shape->child == NULL);
+
+		parent = shape->parent;
+		DUK_ASSERT(parent != NULL);
+		for (ptr = &parent->child; *ptr != shape; ptr = &(*ptr)->sibling) {
+			DUK_ASSERT(*ptr != NULL);
+		}
+		*ptr = shape->sibling;
+
+		DUK_DDD(DUK_DDDPRINT("free shape %p with %ld keys", (void *) shape, (long) shape->nkeys));
+		DUK_FREE(heap, (void *) shape);
+		shape = parent;
+	}
+}
+
+#endif /* DUK_USE_HOBJECT_SHAPES */
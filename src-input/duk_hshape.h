@@ -0,0 +1,61 @@
+/*
+ *  Shared property layouts (shapes, also known as hidden classes).
+ *
+ *  A shape describes the string keys and attributes of an object's
+ *  entry part: shaped objects only store property values and point to
+ *  a shape holding the keys and attributes.  Shapes form a transition
+ *  tree rooted at heap->shape_root (the empty layout); each child adds
+ *  one (key, attrs) pair to its parent's layout.  Objects built by
+ *  adding the same keys in the same order end up sharing a shape.
+ *
+ *  Shapes are not heap objects: they're reference counted explicitly
+ *  (objects and child shapes referencing a shape) and freed when the
+ *  count drops to zero.  Shapes don't hold references to their keys;
+ *  each shaped object holds key references exactly like an unshaped
+ *  object, which keeps the key lifecycle independent of shapes.
+ */
+
+#if !defined(DUK_HSHAPE_H_INCLUDED)
+#define DUK_HSHAPE_H_INCLUDED
+
+#if defined(DUK_USE_HOBJECT_SHAPES)
+
+/* Maximum number of keys in a shape.  Objects growing larger than this
+ * get a private key/attribute table.
+ */
+#define DUK_HSHAPE_MAX_KEYS 32
+
+/* Key and attribute arrays follow the fixed header. */
+#define DUK_HSHAPE_GET_KEYS(s)  ((duk_hstring **) (void *) ((s) + 1))
+#define DUK_HSHAPE_GET_ATTRS(s) ((duk_uint8_t *) (void *) (DUK_HSHAPE_GET_KEYS((s)) + (s)->nkeys))
+
+#define DUK_HSHAPE_INCREF(s) \
+	do { \
+		(s)->refcount++; \
+	} while (0)
+
+struct duk_hshape {
+	/* Number of objects and child shapes referencing this shape. */
+	duk_uint32_t refcount;
+
+	/* Number of keys in the layout. */
+	duk_uint32_t nkeys;
+
+	/* Transition tree: parent, first child, next sibling. */
+	duk_hshape *parent;
+	duk_hshape *child;
+	duk_hshape *sibling;
+
+	/*
+	 *  Followed by:
+	 *
+	 *    duk_hstring *keys[nkeys];
+	 *    duk_uint8_t attrs[nkeys];
+	 */
+};
+
+DUK_INTERNAL_DECL duk_hshape *duk_hshape_transition(duk_hthread *thr, duk_hshape *shape, duk_hstring *key, duk_uint8_t attrs);
+DUK_INTERNAL_DECL void duk_hshape_decref(duk_heap *heap, duk_hshape *shape);
+
+#endif /* DUK_USE_HOBJECT_SHAPES */
+#endif /* DUK_HSHAPE_H_INCLUDED */
@@ -28,7 +28,7 @@ DUK_INTERNAL void duk_hthread_terminate(duk_hthread *thr) {
 	DUK_REFZERO_CHECK_SLOW(thr);
 }
 
-#if defined(DUK_USE_DEBUGGER_SUPPORT)
+#if defined(DUK_USE_DEBUGGER_SUPPORT) || defined(DUK_USE_PROFILER)
 DUK_INTERNAL duk_uint_fast32_t duk_hthread_get_act_curr_pc(duk_hthread *thr, duk_activation *act) {
 	duk_instr_t *bcode;
 
@@ -43,7 +43,7 @@ DUK_INTERNAL duk_uint_fast32_t duk_hthread_get_act_curr_pc(duk_hthread *thr, duk
 	}
 	return 0;
 }
-#endif /* DUK_USE_DEBUGGER_SUPPORT */
+#endif /* DUK_USE_DEBUGGER_SUPPORT || DUK_USE_PROFILER */
 
 DUK_INTERNAL duk_uint_fast32_t duk_hthread_get_act_prev_pc(duk_hthread *thr, duk_activation *act) {
 	duk_instr_t *bcode;
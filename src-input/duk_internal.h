@@ -63,8 +63,12 @@
 #include "duk_henv.h"
 #include "duk_hbuffer.h"
 #include "duk_hproxy.h"
+#include "duk_hmap.h"
+#include "duk_hpromise.h"
+#include "duk_hshape.h"
 #include "duk_heap.h"
 #include "duk_debugger.h"
+#include "duk_profiler.h"
 #include "duk_debug.h"
 #include "duk_error.h"
 #include "duk_unicode.h"
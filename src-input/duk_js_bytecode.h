@@ -397,30 +397,39 @@ typedef duk_uint32_t duk_instr_t;
 #define DUK_OP_GETPROPC_CR_UNUSED 209
 #define DUK_OP_GETPROPC_RC        210
 #define DUK_OP_GETPROPC_CC_UNUSED 211
-#define DUK_OP_UNUSED212          212
-#define DUK_OP_UNUSED213          213
-#define DUK_OP_UNUSED214          214
-#define DUK_OP_UNUSED215          215
-#define DUK_OP_UNUSED216          216
-#define DUK_OP_UNUSED217          217
-#define DUK_OP_UNUSED218          218
-#define DUK_OP_UNUSED219          219
-#define DUK_OP_UNUSED220          220
-#define DUK_OP_UNUSED221          221
-#define DUK_OP_UNUSED222          222
-#define DUK_OP_UNUSED223          223
-#define DUK_OP_UNUSED224          224
-#define DUK_OP_UNUSED225          225
-#define DUK_OP_UNUSED226          226
-#define DUK_OP_UNUSED227          227
-#define DUK_OP_UNUSED228          228
-#define DUK_OP_UNUSED229          229
-#define DUK_OP_UNUSED230          230
-#define DUK_OP_UNUSED231          231
-#define DUK_OP_UNUSED232          232
-#define DUK_OP_UNUSED233          233
-#define DUK_OP_UNUSED234          234
-#define DUK_OP_UNUSED235          235
+/* Fused compare and conditional skip: skip next instruction if the
+ * comparison result (B op C) equals A (0 or 1).
+ */
+#define DUK_OP_IFLT               212
+#define DUK_OP_IFLT_RR            212
+#define DUK_OP_IFLT_CR            213
+#define DUK_OP_IFLT_RC            214
+#define DUK_OP_IFLT_CC            215
+#define DUK_OP_IFLE               216
+#define DUK_OP_IFLE_RR            216
+#define DUK_OP_IFLE_CR            217
+#define DUK_OP_IFLE_RC            218
+#define DUK_OP_IFLE_CC            219
+#define DUK_OP_IFGT               220
+#define DUK_OP_IFGT_RR            220
+#define DUK_OP_IFGT_CR            221
+#define DUK_OP_IFGT_RC            222
+#define DUK_OP_IFGT_CC            223
+#define DUK_OP_IFGE               224
+#define DUK_OP_IFGE_RR            224
+#define DUK_OP_IFGE_CR            225
+#define DUK_OP_IFGE_RC            226
+#define DUK_OP_IFGE_CC            227
+#define DUK_OP_IFSEQ              228
+#define DUK_OP_IFSEQ_RR           228
+#define DUK_OP_IFSEQ_CR           229
+#define DUK_OP_IFSEQ_RC           230
+#define DUK_OP_IFSEQ_CC           231
+#define DUK_OP_IFEQ               232
+#define DUK_OP_IFEQ_RR            232
+#define DUK_OP_IFEQ_CR            233
+#define DUK_OP_IFEQ_RC            234
+#define DUK_OP_IFEQ_CC            235
 #define DUK_OP_UNUSED236          236
 #define DUK_OP_UNUSED237          237
 #define DUK_OP_UNUSED238          238
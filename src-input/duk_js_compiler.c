@@ -185,6 +185,7 @@ DUK_LOCAL_DECL duk_regconst_t duk__ivalue_totemp(duk_compiler_ctx *comp_ctx, duk
 DUK_LOCAL_DECL void duk__ivalue_toforcedreg(duk_compiler_ctx *comp_ctx, duk_ivalue *x, duk_int_t forced_reg);
 DUK_LOCAL_DECL duk_regconst_t duk__ivalue_toregconst(duk_compiler_ctx *comp_ctx, duk_ivalue *x);
 DUK_LOCAL_DECL duk_regconst_t duk__ivalue_totempconst(duk_compiler_ctx *comp_ctx, duk_ivalue *x);
+DUK_LOCAL_DECL void duk__ivalue_emit_if_skip(duk_compiler_ctx *comp_ctx, duk_ivalue *x, duk_bool_t skip_if_true);
 
 /* identifier handling */
 DUK_LOCAL_DECL duk_regconst_t duk__lookup_active_register_binding(duk_compiler_ctx *comp_ctx);
@@ -2592,6 +2593,83 @@ DUK_LOCAL duk_regconst_t duk__ivalue_totempconst(duk_compiler_ctx *comp_ctx, duk
 	return duk__ivalue_toregconst_raw(comp_ctx, x, -1, DUK__IVAL_FLAG_ALLOW_CONST | DUK__IVAL_FLAG_REQUIRE_TEMP /*flags*/);
 }
 
+/* Emit a conditional skip of the next instruction based on the truth value
+ * of 'x'.  When 'x' is a pending comparison, emit a fused compare-and-skip
+ * opcode so that the result never needs to be written to a register.
+ */
+DUK_LOCAL void duk__ivalue_emit_if_skip(duk_compiler_ctx *comp_ctx, duk_ivalue *x, duk_bool_t skip_if_true) {
+	duk_regconst_t rc;
+
+#if defined(DUK_USE_COMPILER_FUSED_COMPARE)
+	if (x->t == DUK_IVAL_ARITH) {
+		duk_small_uint_t op;
+		duk_regconst_t arg1;
+		duk_regconst_t arg2;
+
+		switch (x->op) {
+		case DUK_OP_LT:
+			op = DUK_OP_IFLT;
+			break;
+		case DUK_OP_LE:
+			op = DUK_OP_IFLE;
+			break;
+		case DUK_OP_GT:
+			op = DUK_OP_IFGT;
+			break;
+		case DUK_OP_GE:
+			op = DUK_OP_IFGE;
+			break;
+		case DUK_OP_SEQ:
+			op = DUK_OP_IFSEQ;
+			break;
+		case DUK_OP_SNEQ:
+			op = DUK_OP_IFSEQ;
+			skip_if_true ^= 1;
+			break;
+		case DUK_OP_EQ:
+			op = DUK_OP_IFEQ;
+			break;
+		case DUK_OP_NEQ:
+			op = DUK_OP_IFEQ;
+			skip_if_true ^= 1;
+			break;
+		default:
+			op = DUK_OP_NONE;
+			break;
+		}
+
+		if (op != DUK_OP_NONE) {
+			/* Same argument coercion order as arith-to-plain
+			 * conversion.  Slot A holds the skip condition and
+			 * must not be shuffled: an output shuffle would be
+			 * emitted between the opcode and the skipped jump.
+			 */
+			arg1 = duk__ispec_toregconst_raw(comp_ctx,
+			                                 &x->x1,
+			                                 -1,
+			                                 DUK__IVAL_FLAG_ALLOW_CONST | DUK__IVAL_FLAG_REQUIRE_SHORT /*flags*/);
+			arg2 = duk__ispec_toregconst_raw(comp_ctx,
+			                                 &x->x2,
+			                                 -1,
+			                                 DUK__IVAL_FLAG_ALLOW_CONST | DUK__IVAL_FLAG_REQUIRE_SHORT /*flags*/);
+			duk__emit_a_b_c(comp_ctx,
+			                op | DUK__EMIT_FLAG_BC_REGCONST | DUK__EMIT_FLAG_NO_SHUFFLE_A | DUK__EMIT_FLAG_A_IS_SOURCE,
+			                (duk_regconst_t) skip_if_true,
+			                arg1,
+			                arg2);
+			return;
+		}
+	}
+#endif /* DUK_USE_COMPILER_FUSED_COMPARE */
+
+	rc = duk__ivalue_toregconst(comp_ctx, x);
+	if (skip_if_true) {
+		duk__emit_if_true_skip(comp_ctx, rc);
+	} else {
+		duk__emit_if_false_skip(comp_ctx, rc);
+	}
+}
+
 /* The issues below can be solved with better flags */
 
 /* XXX: many operations actually want toforcedtemp() -- brand new temp? */
@@ -4277,8 +4355,7 @@ DUK_LOCAL void duk__expr_led(duk_compiler_ctx *comp_ctx, duk_ivalue *left, duk_i
 		duk_int_t pc_jump2;
 
 		reg_temp = DUK__ALLOCTEMP(comp_ctx);
-		duk__ivalue_toforcedreg(comp_ctx, left, reg_temp);
-		duk__emit_if_true_skip(comp_ctx, reg_temp);
+		duk__ivalue_emit_if_skip(comp_ctx, left, 1 /*skip_if_true*/);
 		pc_jump1 = duk__emit_jump_empty(comp_ctx); /* jump to false */
 		duk__expr_toforcedreg(comp_ctx,
 		                      res,
@@ -5480,7 +5557,6 @@ parse_1_or_2:
 	 *  reg_temps + 1: unused
 	 */
 	{
-		duk_regconst_t rc_cond;
 		duk_int_t pc_l1, pc_l2, pc_l3, pc_l4;
 		duk_int_t pc_jumpto_l3, pc_jumpto_l4;
 		duk_bool_t expr_c_empty;
@@ -5500,8 +5576,7 @@ parse_1_or_2:
 			pc_jumpto_l3 = duk__emit_jump_empty(comp_ctx); /* to body */
 			pc_jumpto_l4 = -1; /* omitted */
 		} else {
-			rc_cond = duk__ivalue_toregconst(comp_ctx, res);
-			duk__emit_if_false_skip(comp_ctx, rc_cond);
+			duk__ivalue_emit_if_skip(comp_ctx, res, 0 /*skip_if_true*/);
 			pc_jumpto_l3 = duk__emit_jump_empty(comp_ctx); /* to body */
 			pc_jumpto_l4 = duk__emit_jump_empty(comp_ctx); /* to exit */
 		}
@@ -5680,7 +5755,9 @@ DUK_LOCAL void duk__parse_switch_stmt(duk_compiler_ctx *comp_ctx, duk_ivalue *re
 	duk_regconst_t temp_at_loop;
 	duk_regconst_t rc_switch; /* reg/const for switch value */
 	duk_regconst_t rc_case; /* reg/const for case value */
+#if !defined(DUK_USE_COMPILER_FUSED_COMPARE)
 	duk_regconst_t reg_temp; /* general temp register */
+#endif
 	duk_int_t pc_prevcase = -1;
 	duk_int_t pc_prevstmt = -1;
 	duk_int_t pc_default = -1; /* -1 == not set, -2 == pending (next statement list) */
@@ -5752,9 +5829,18 @@ DUK_LOCAL void duk__parse_switch_stmt(duk_compiler_ctx *comp_ctx, duk_ivalue *re
 			rc_case = duk__exprtop_toregconst(comp_ctx, res, DUK__BP_FOR_EXPR /*rbp_flags*/);
 			duk__advance_expect(comp_ctx, DUK_TOK_COLON);
 
+#if defined(DUK_USE_COMPILER_FUSED_COMPARE)
+			duk__emit_a_b_c(comp_ctx,
+			                DUK_OP_IFSEQ | DUK__EMIT_FLAG_BC_REGCONST | DUK__EMIT_FLAG_NO_SHUFFLE_A |
+			                    DUK__EMIT_FLAG_A_IS_SOURCE,
+			                1 /*skip_if_true*/,
+			                rc_switch,
+			                rc_case);
+#else
 			reg_temp = DUK__ALLOCTEMP(comp_ctx);
 			duk__emit_a_b_c(comp_ctx, DUK_OP_SEQ | DUK__EMIT_FLAG_BC_REGCONST, reg_temp, rc_switch, rc_case);
 			duk__emit_if_true_skip(comp_ctx, reg_temp);
+#endif
 
 			/* jump to next case clause */
 			pc_prevcase = duk__emit_jump_empty(comp_ctx); /* no match, next case */
@@ -5873,7 +5959,6 @@ syntax_error:
 
 DUK_LOCAL void duk__parse_if_stmt(duk_compiler_ctx *comp_ctx, duk_ivalue *res) {
 	duk_regconst_t temp_reset;
-	duk_regconst_t rc_cond;
 	duk_int_t pc_jump_false;
 
 	DUK_DDD(DUK_DDDPRINT("begin parsing if statement"));
@@ -5883,8 +5968,8 @@ DUK_LOCAL void duk__parse_if_stmt(duk_compiler_ctx *comp_ctx, duk_ivalue *res) {
 	duk__advance(comp_ctx); /* eat 'if' */
 	duk__advance_expect(comp_ctx, DUK_TOK_LPAREN);
 
-	rc_cond = duk__exprtop_toregconst(comp_ctx, res, DUK__BP_FOR_EXPR /*rbp_flags*/);
-	duk__emit_if_true_skip(comp_ctx, rc_cond);
+	duk__exprtop(comp_ctx, res, DUK__BP_FOR_EXPR /*rbp_flags*/);
+	duk__ivalue_emit_if_skip(comp_ctx, res, 1 /*skip_if_true*/);
 	pc_jump_false = duk__emit_jump_empty(comp_ctx); /* jump to end or else part */
 	DUK__SETTEMP(comp_ctx, temp_reset);
 
@@ -5920,7 +6005,6 @@ DUK_LOCAL void duk__parse_if_stmt(duk_compiler_ctx *comp_ctx, duk_ivalue *res) {
 }
 
 DUK_LOCAL void duk__parse_do_stmt(duk_compiler_ctx *comp_ctx, duk_ivalue *res, duk_int_t pc_label_site) {
-	duk_regconst_t rc_cond;
 	duk_int_t pc_start;
 
 	DUK_DDD(DUK_DDDPRINT("begin parsing do statement"));
@@ -5934,8 +6018,8 @@ DUK_LOCAL void duk__parse_do_stmt(duk_compiler_ctx *comp_ctx, duk_ivalue *res, d
 	duk__advance_expect(comp_ctx, DUK_TOK_WHILE);
 	duk__advance_expect(comp_ctx, DUK_TOK_LPAREN);
 
-	rc_cond = duk__exprtop_toregconst(comp_ctx, res, DUK__BP_FOR_EXPR /*rbp_flags*/);
-	duk__emit_if_false_skip(comp_ctx, rc_cond);
+	duk__exprtop(comp_ctx, res, DUK__BP_FOR_EXPR /*rbp_flags*/);
+	duk__ivalue_emit_if_skip(comp_ctx, res, 0 /*skip_if_true*/);
 	duk__emit_jump(comp_ctx, pc_start);
 	/* no need to reset temps, as we're finished emitting code */
 
@@ -5949,7 +6033,6 @@ DUK_LOCAL void duk__parse_do_stmt(duk_compiler_ctx *comp_ctx, duk_ivalue *res, d
 
 DUK_LOCAL void duk__parse_while_stmt(duk_compiler_ctx *comp_ctx, duk_ivalue *res, duk_int_t pc_label_site) {
 	duk_regconst_t temp_reset;
-	duk_regconst_t rc_cond;
 	duk_int_t pc_start;
 	duk_int_t pc_jump_false;
 
@@ -5964,8 +6047,8 @@ DUK_LOCAL void duk__parse_while_stmt(duk_compiler_ctx *comp_ctx, duk_ivalue *res
 	pc_start = duk__get_current_pc(comp_ctx);
 	duk__patch_jump_here(comp_ctx, pc_label_site + 2); /* continue jump */
 
-	rc_cond = duk__exprtop_toregconst(comp_ctx, res, DUK__BP_FOR_EXPR /*rbp_flags*/);
-	duk__emit_if_true_skip(comp_ctx, rc_cond);
+	duk__exprtop(comp_ctx, res, DUK__BP_FOR_EXPR /*rbp_flags*/);
+	duk__ivalue_emit_if_skip(comp_ctx, res, 1 /*skip_if_true*/);
 	pc_jump_false = duk__emit_jump_empty(comp_ctx);
 	DUK__SETTEMP(comp_ctx, temp_reset);
 
@@ -629,6 +629,71 @@ DUK_LOCAL DUK_EXEC_ALWAYS_INLINE_PERF void duk__vm_logical_not(duk_hthread *thr,
 	DUK_TVAL_SET_BOOLEAN_UPDREF(thr, tv, res); /* side effects */
 }
 
+/* Comparison for the fused IFxx opcodes.  Number operands are compared
+ * inline, other types use the same helpers and coercion order as the
+ * plain comparison opcodes.  'op' is the base opcode, so the switches
+ * fold away when inlined.
+ */
+DUK_LOCAL DUK_EXEC_ALWAYS_INLINE_PERF duk_bool_t duk__vm_ifcmp(duk_hthread *thr,
+                                                              duk_small_uint_fast_t op,
+                                                              duk_tval *tv_b,
+                                                              duk_tval *tv_c) {
+#if defined(DUK_USE_FASTINT)
+	if (DUK_LIKELY(DUK_TVAL_IS_FASTINT(tv_b) && DUK_TVAL_IS_FASTINT(tv_c))) {
+		duk_int64_t v1 = DUK_TVAL_GET_FASTINT(tv_b);
+		duk_int64_t v2 = DUK_TVAL_GET_FASTINT(tv_c);
+
+		switch (op) {
+		case DUK_OP_IFLT:
+			return v1 < v2;
+		case DUK_OP_IFLE:
+			return v1 <= v2;
+		case DUK_OP_IFGT:
+			return v1 > v2;
+		case DUK_OP_IFGE:
+			return v1 >= v2;
+		default: /* IFSEQ, IFEQ */
+			return v1 == v2;
+		}
+	}
+#endif
+	if (DUK_LIKELY(DUK_TVAL_IS_NUMBER(tv_b) && DUK_TVAL_IS_NUMBER(tv_c))) {
+		/* C comparison semantics match ECMAScript for numbers,
+		 * including NaN (always false) and signed zeroes.
+		 */
+		duk_double_t d1 = DUK_TVAL_GET_NUMBER(tv_b);
+		duk_double_t d2 = DUK_TVAL_GET_NUMBER(tv_c);
+
+		switch (op) {
+		case DUK_OP_IFLT:
+			return d1 < d2;
+		case DUK_OP_IFLE:
+			return d1 <= d2;
+		case DUK_OP_IFGT:
+			return d1 > d2;
+		case DUK_OP_IFGE:
+			return d1 >= d2;
+		default: /* IFSEQ, IFEQ */
+			return d1 == d2;
+		}
+	}
+
+	switch (op) {
+	case DUK_OP_IFLT:
+		return duk_js_compare_helper(thr, tv_b, tv_c, DUK_COMPARE_FLAG_EVAL_LEFT_FIRST);
+	case DUK_OP_IFLE:
+		return duk_js_compare_helper(thr, tv_c, tv_b, DUK_COMPARE_FLAG_NEGATE);
+	case DUK_OP_IFGT:
+		return duk_js_compare_helper(thr, tv_c, tv_b, 0);
+	case DUK_OP_IFGE:
+		return duk_js_compare_helper(thr, tv_b, tv_c, DUK_COMPARE_FLAG_EVAL_LEFT_FIRST | DUK_COMPARE_FLAG_NEGATE);
+	case DUK_OP_IFSEQ:
+		return duk_js_strict_equals(tv_b, tv_c);
+	default: /* IFEQ */
+		return duk_js_equals(thr, tv_b, tv_c);
+	}
+}
+
 /* XXX: size optimized variant */
 DUK_LOCAL DUK_EXEC_ALWAYS_INLINE_PERF void duk__prepost_incdec_reg_helper(duk_hthread *thr,
                                                                           duk_tval *tv_dst,
@@ -2054,6 +2119,16 @@ DUK_LOCAL DUK_EXEC_NOINLINE_PERF DUK_COLD duk_small_uint_t duk__executor_interru
 	}
 #endif /* DUK_USE_EXEC_TIMEOUT_CHECK */
 
+#if defined(DUK_USE_PROFILER)
+	if (thr->heap->prof_interval > 0) {
+		duk_profiler_sample(thr);
+		DUK_ASSERT(act == thr->callstack_curr);
+		if (ctr > (duk_int_t) thr->heap->prof_interval) {
+			ctr = (duk_int_t) thr->heap->prof_interval;
+		}
+	}
+#endif /* DUK_USE_PROFILER */
+
 #if defined(DUK_USE_DEBUGGER_SUPPORT)
 	if (!thr->heap->dbg_processing && (thr->heap->dbg_read_cb != NULL || thr->heap->dbg_detaching)) {
 		/* Avoid recursive re-entry; enter when we're attached or
@@ -2854,6 +2929,48 @@ DUK_LOCAL duk_bool_t duk__executor_handle_call(duk_hthread *thr, duk_idx_t idx,
 	} while (0)
 #endif
 
+/* Threaded dispatch (labels as values).  Each opcode handler also gets a
+ * 'duk__op_<name>' label and a handler finishes with DUK__NEXT(), which
+ * fetches the next instruction and jumps to its handler through a label
+ * table, giving each handler its own indirect jump.  The loop top (reached
+ * with 'break') remains the slow path: interrupts, and all instructions in
+ * debug and assert builds so that the per-instruction checks still run.
+ */
+#if defined(DUK_USE_EXEC_COMPUTED_GOTO)
+#define DUK__OPCASE(name) \
+	case DUK_OP_##name: \
+	duk__op_##name
+#define DUK__OPLABEL(name) &&duk__op_##name
+#else
+#define DUK__OPCASE(name) case DUK_OP_##name
+#endif
+
+#if defined(DUK_USE_EXEC_COMPUTED_GOTO) && !defined(DUK_USE_ASSERTIONS) && !defined(DUK_USE_DEBUG)
+#if defined(DUK_USE_INTERRUPT_COUNTER)
+#define DUK__NEXT() \
+	{ \
+		if (DUK_LIKELY(thr->interrupt_counter > 0)) { \
+			thr->interrupt_counter--; \
+			ins = *curr_pc++; \
+			DUK_STATS_INC(thr->heap, stats_exec_opcodes); \
+			op = (duk_uint8_t) DUK_DEC_OP(ins); \
+			goto *duk__optab[op]; \
+		} \
+		break; \
+	}
+#else
+#define DUK__NEXT() \
+	{ \
+		ins = *curr_pc++; \
+		DUK_STATS_INC(thr->heap, stats_exec_opcodes); \
+		op = (duk_uint8_t) DUK_DEC_OP(ins); \
+		goto *duk__optab[op]; \
+	}
+#endif
+#else
+#define DUK__NEXT() break
+#endif
+
 #define DUK__SYNC_CURR_PC() \
 	do { \
 		duk_activation *duk__act; \
@@ -3081,6 +3198,15 @@ DUK_INTERNAL void duk_js_execute_bytecode(duk_hthread *exec_thr) {
 }
 
 /* Inner executor, performance critical. */
+#if defined(DUK_USE_EXEC_COMPUTED_GOTO)
+#if defined(DUK_USE_GCC_PRAGMAS)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpedantic"
+#elif defined(DUK_USE_CLANG_PRAGMAS)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wgnu-label-as-value"
+#endif
+#endif
 DUK_LOCAL DUK_NOINLINE DUK_HOT void duk__js_execute_bytecode_inner(duk_hthread *entry_thread, duk_activation *entry_act) {
 	/* Current PC, accessed by other functions through thr->ptr_to_curr_pc.
 	 * Critical for performance.  It would be safest to make this volatile,
@@ -3112,6 +3238,69 @@ DUK_LOCAL DUK_NOINLINE DUK_HOT void duk__js_execute_bytecode_inner(duk_hthread *
 	duk_size_t valstack_top_base; /* valstack top, should match before interpreting each op (no leftovers) */
 #endif
 
+#if defined(DUK_USE_EXEC_COMPUTED_GOTO)
+	/* Handler label for each opcode, in opcode order. */
+	static const void *const duk__optab[256] = {
+		DUK__OPLABEL(LDREG), DUK__OPLABEL(STREG), DUK__OPLABEL(JUMP), DUK__OPLABEL(LDCONST), DUK__OPLABEL(LDINT),
+		DUK__OPLABEL(LDINTX), DUK__OPLABEL(LDTHIS), DUK__OPLABEL(LDUNDEF), DUK__OPLABEL(LDNULL), DUK__OPLABEL(LDTRUE),
+		DUK__OPLABEL(LDFALSE), DUK__OPLABEL(GETVAR), DUK__OPLABEL(BNOT), DUK__OPLABEL(LNOT), DUK__OPLABEL(UNM),
+		DUK__OPLABEL(UNP), DUK__OPLABEL(EQ_RR), DUK__OPLABEL(EQ_CR), DUK__OPLABEL(EQ_RC), DUK__OPLABEL(EQ_CC),
+		DUK__OPLABEL(NEQ_RR), DUK__OPLABEL(NEQ_CR), DUK__OPLABEL(NEQ_RC), DUK__OPLABEL(NEQ_CC), DUK__OPLABEL(SEQ_RR),
+		DUK__OPLABEL(SEQ_CR), DUK__OPLABEL(SEQ_RC), DUK__OPLABEL(SEQ_CC), DUK__OPLABEL(SNEQ_RR), DUK__OPLABEL(SNEQ_CR),
+		DUK__OPLABEL(SNEQ_RC), DUK__OPLABEL(SNEQ_CC), DUK__OPLABEL(GT_RR), DUK__OPLABEL(GT_CR), DUK__OPLABEL(GT_RC),
+		DUK__OPLABEL(GT_CC), DUK__OPLABEL(GE_RR), DUK__OPLABEL(GE_CR), DUK__OPLABEL(GE_RC), DUK__OPLABEL(GE_CC),
+		DUK__OPLABEL(LT_RR), DUK__OPLABEL(LT_CR), DUK__OPLABEL(LT_RC), DUK__OPLABEL(LT_CC), DUK__OPLABEL(LE_RR),
+		DUK__OPLABEL(LE_CR), DUK__OPLABEL(LE_RC), DUK__OPLABEL(LE_CC), DUK__OPLABEL(IFTRUE_R), DUK__OPLABEL(IFTRUE_C),
+		DUK__OPLABEL(IFFALSE_R), DUK__OPLABEL(IFFALSE_C), DUK__OPLABEL(ADD_RR), DUK__OPLABEL(ADD_CR), DUK__OPLABEL(ADD_RC),
+		DUK__OPLABEL(ADD_CC), DUK__OPLABEL(SUB_RR), DUK__OPLABEL(SUB_CR), DUK__OPLABEL(SUB_RC), DUK__OPLABEL(SUB_CC),
+		DUK__OPLABEL(MUL_RR), DUK__OPLABEL(MUL_CR), DUK__OPLABEL(MUL_RC), DUK__OPLABEL(MUL_CC), DUK__OPLABEL(DIV_RR),
+		DUK__OPLABEL(DIV_CR), DUK__OPLABEL(DIV_RC), DUK__OPLABEL(DIV_CC), DUK__OPLABEL(MOD_RR), DUK__OPLABEL(MOD_CR),
+		DUK__OPLABEL(MOD_RC), DUK__OPLABEL(MOD_CC), DUK__OPLABEL(EXP_RR), DUK__OPLABEL(EXP_CR), DUK__OPLABEL(EXP_RC),
+		DUK__OPLABEL(EXP_CC), DUK__OPLABEL(BAND_RR), DUK__OPLABEL(BAND_CR), DUK__OPLABEL(BAND_RC), DUK__OPLABEL(BAND_CC),
+		DUK__OPLABEL(BOR_RR), DUK__OPLABEL(BOR_CR), DUK__OPLABEL(BOR_RC), DUK__OPLABEL(BOR_CC), DUK__OPLABEL(BXOR_RR),
+		DUK__OPLABEL(BXOR_CR), DUK__OPLABEL(BXOR_RC), DUK__OPLABEL(BXOR_CC), DUK__OPLABEL(BASL_RR), DUK__OPLABEL(BASL_CR),
+		DUK__OPLABEL(BASL_RC), DUK__OPLABEL(BASL_CC), DUK__OPLABEL(BLSR_RR), DUK__OPLABEL(BLSR_CR), DUK__OPLABEL(BLSR_RC),
+		DUK__OPLABEL(BLSR_CC), DUK__OPLABEL(BASR_RR), DUK__OPLABEL(BASR_CR), DUK__OPLABEL(BASR_RC), DUK__OPLABEL(BASR_CC),
+		DUK__OPLABEL(INSTOF_RR), DUK__OPLABEL(INSTOF_CR), DUK__OPLABEL(INSTOF_RC), DUK__OPLABEL(INSTOF_CC),
+		DUK__OPLABEL(IN_RR), DUK__OPLABEL(IN_CR), DUK__OPLABEL(IN_RC), DUK__OPLABEL(IN_CC), DUK__OPLABEL(GETPROP_RR),
+		DUK__OPLABEL(GETPROP_CR_UNUSED), DUK__OPLABEL(GETPROP_RC), DUK__OPLABEL(GETPROP_CC_UNUSED),
+		DUK__OPLABEL(PUTPROP_RR), DUK__OPLABEL(PUTPROP_CR), DUK__OPLABEL(PUTPROP_RC), DUK__OPLABEL(PUTPROP_CC),
+		DUK__OPLABEL(DELPROP_RR), DUK__OPLABEL(DELPROP_CR_UNUSED), DUK__OPLABEL(DELPROP_RC),
+		DUK__OPLABEL(DELPROP_CC_UNUSED), DUK__OPLABEL(PREINCR), DUK__OPLABEL(PREDECR), DUK__OPLABEL(POSTINCR),
+		DUK__OPLABEL(POSTDECR), DUK__OPLABEL(PREINCV), DUK__OPLABEL(PREDECV), DUK__OPLABEL(POSTINCV),
+		DUK__OPLABEL(POSTDECV), DUK__OPLABEL(PREINCP_RR), DUK__OPLABEL(PREINCP_CR), DUK__OPLABEL(PREINCP_RC),
+		DUK__OPLABEL(PREINCP_CC), DUK__OPLABEL(PREDECP_RR), DUK__OPLABEL(PREDECP_CR), DUK__OPLABEL(PREDECP_RC),
+		DUK__OPLABEL(PREDECP_CC), DUK__OPLABEL(POSTINCP_RR), DUK__OPLABEL(POSTINCP_CR), DUK__OPLABEL(POSTINCP_RC),
+		DUK__OPLABEL(POSTINCP_CC), DUK__OPLABEL(POSTDECP_RR), DUK__OPLABEL(POSTDECP_CR), DUK__OPLABEL(POSTDECP_RC),
+		DUK__OPLABEL(POSTDECP_CC), DUK__OPLABEL(DECLVAR_RR), DUK__OPLABEL(DECLVAR_CR), DUK__OPLABEL(DECLVAR_RC),
+		DUK__OPLABEL(DECLVAR_CC), DUK__OPLABEL(REGEXP_RR), DUK__OPLABEL(REGEXP_CR), DUK__OPLABEL(REGEXP_RC),
+		DUK__OPLABEL(REGEXP_CC), DUK__OPLABEL(CLOSURE), DUK__OPLABEL(TYPEOF), DUK__OPLABEL(TYPEOFID), DUK__OPLABEL(PUTVAR),
+		DUK__OPLABEL(DELVAR), DUK__OPLABEL(RETREG), DUK__OPLABEL(RETUNDEF), DUK__OPLABEL(RETCONST), DUK__OPLABEL(RETCONSTN),
+		DUK__OPLABEL(LABEL), DUK__OPLABEL(ENDLABEL), DUK__OPLABEL(BREAK), DUK__OPLABEL(CONTINUE), DUK__OPLABEL(TRYCATCH),
+		DUK__OPLABEL(ENDTRY), DUK__OPLABEL(ENDCATCH), DUK__OPLABEL(ENDFIN), DUK__OPLABEL(THROW), DUK__OPLABEL(INVLHS),
+		DUK__OPLABEL(CSREG), DUK__OPLABEL(CSVAR_RR), DUK__OPLABEL(CSVAR_CR), DUK__OPLABEL(CSVAR_RC), DUK__OPLABEL(CSVAR_CC),
+		DUK__OPLABEL(CALL0), DUK__OPLABEL(CALL1), DUK__OPLABEL(CALL2), DUK__OPLABEL(CALL3), DUK__OPLABEL(CALL4),
+		DUK__OPLABEL(CALL5), DUK__OPLABEL(CALL6), DUK__OPLABEL(CALL7), DUK__OPLABEL(CALL8), DUK__OPLABEL(CALL9),
+		DUK__OPLABEL(CALL10), DUK__OPLABEL(CALL11), DUK__OPLABEL(CALL12), DUK__OPLABEL(CALL13), DUK__OPLABEL(CALL14),
+		DUK__OPLABEL(CALL15), DUK__OPLABEL(NEWOBJ), DUK__OPLABEL(NEWARR), DUK__OPLABEL(MPUTOBJ), DUK__OPLABEL(MPUTOBJI),
+		DUK__OPLABEL(INITSET), DUK__OPLABEL(INITGET), DUK__OPLABEL(MPUTARR), DUK__OPLABEL(MPUTARRI), DUK__OPLABEL(SETALEN),
+		DUK__OPLABEL(INITENUM), DUK__OPLABEL(NEXTENUM), DUK__OPLABEL(NEWTARGET), DUK__OPLABEL(DEBUGGER), DUK__OPLABEL(NOP),
+		DUK__OPLABEL(INVALID), DUK__OPLABEL(UNUSED207), DUK__OPLABEL(GETPROPC_RR), DUK__OPLABEL(GETPROPC_CR_UNUSED),
+		DUK__OPLABEL(GETPROPC_RC), DUK__OPLABEL(GETPROPC_CC_UNUSED), DUK__OPLABEL(IFLT_RR), DUK__OPLABEL(IFLT_CR),
+		DUK__OPLABEL(IFLT_RC), DUK__OPLABEL(IFLT_CC), DUK__OPLABEL(IFLE_RR), DUK__OPLABEL(IFLE_CR),
+		DUK__OPLABEL(IFLE_RC), DUK__OPLABEL(IFLE_CC), DUK__OPLABEL(IFGT_RR), DUK__OPLABEL(IFGT_CR),
+		DUK__OPLABEL(IFGT_RC), DUK__OPLABEL(IFGT_CC), DUK__OPLABEL(IFGE_RR), DUK__OPLABEL(IFGE_CR),
+		DUK__OPLABEL(IFGE_RC), DUK__OPLABEL(IFGE_CC), DUK__OPLABEL(IFSEQ_RR), DUK__OPLABEL(IFSEQ_CR),
+		DUK__OPLABEL(IFSEQ_RC), DUK__OPLABEL(IFSEQ_CC), DUK__OPLABEL(IFEQ_RR), DUK__OPLABEL(IFEQ_CR),
+		DUK__OPLABEL(IFEQ_RC), DUK__OPLABEL(IFEQ_CC), DUK__OPLABEL(UNUSED236), DUK__OPLABEL(UNUSED237),
+		DUK__OPLABEL(UNUSED238), DUK__OPLABEL(UNUSED239), DUK__OPLABEL(UNUSED240), DUK__OPLABEL(UNUSED241),
+		DUK__OPLABEL(UNUSED242), DUK__OPLABEL(UNUSED243), DUK__OPLABEL(UNUSED244), DUK__OPLABEL(UNUSED245),
+		DUK__OPLABEL(UNUSED246), DUK__OPLABEL(UNUSED247), DUK__OPLABEL(UNUSED248), DUK__OPLABEL(UNUSED249),
+		DUK__OPLABEL(UNUSED250), DUK__OPLABEL(UNUSED251), DUK__OPLABEL(UNUSED252), DUK__OPLABEL(UNUSED253),
+		DUK__OPLABEL(UNUSED254), DUK__OPLABEL(UNUSED255)
+	};
+#endif
+
 	/* Optimized reg/const access macros assume sizeof(duk_tval) to be
 	 * either 8 or 16.  Heap allocation checks this even without asserts
 	 * enabled now because it can't be autodetected in duk_config.h.
@@ -3332,6 +3521,10 @@ restart_execution:
 		DUK_STATS_INC(thr->heap, stats_exec_opcodes);
 #if defined(DUK_USE_DEBUG)
 		thr->heap->stats_exec_opcode[DUK_DEC_OP(ins)]++;
+#if defined(DUK_USE_DEBUG_OPCODE_PAIRS)
+		thr->heap->stats_exec_opcode_pair[thr->heap->stats_exec_prev_opcode][DUK_DEC_OP(ins)]++;
+		thr->heap->stats_exec_prev_opcode = (duk_small_uint_t) DUK_DEC_OP(ins);
+#endif
 #endif
 
 		/* Typing: use duk_small_(u)int_fast_t when decoding small
@@ -3348,6 +3541,9 @@ restart_execution:
 		 * will (at least usually) omit a bounds check.
 		 */
 		op = (duk_uint8_t) DUK_DEC_OP(ins);
+#if defined(DUK_USE_EXEC_COMPUTED_GOTO)
+		goto *duk__optab[op];
+#endif
 		switch (op) {
 			/* Some useful macros.  These access inner executor variables
 			 * directly so they only apply within the executor.
@@ -3369,12 +3565,12 @@ restart_execution:
 #define DUK__REPLACE_TOP_A_BREAK() \
 	{ \
 		DUK__REPLACE_TO_TVPTR(thr, DUK__REGP_A(ins)); \
-		break; \
+		DUK__NEXT(); \
 	}
 #define DUK__REPLACE_TOP_BC_BREAK() \
 	{ \
 		DUK__REPLACE_TO_TVPTR(thr, DUK__REGP_BC(ins)); \
-		break; \
+		DUK__NEXT(); \
 	}
 #define DUK__REPLACE_BOOL_A_BREAK(bval) \
 	{ \
@@ -3384,7 +3580,7 @@ restart_execution:
 		DUK_ASSERT(duk__bval == 0 || duk__bval == 1); \
 		duk__tvdst = DUK__REGP_A(ins); \
 		DUK_TVAL_SET_BOOLEAN_UPDREF(thr, duk__tvdst, duk__bval); \
-		break; \
+		DUK__NEXT(); \
 	}
 #endif
 
@@ -3396,31 +3592,31 @@ restart_execution:
 		 * duk_dup() + duk_replace(), but because they're used quite a lot
 		 * they're currently intentionally not size optimized.
 		 */
-		case DUK_OP_LDREG: {
+		DUK__OPCASE(LDREG): {
 			duk_tval *tv1, *tv2;
 
 			tv1 = DUK__REGP_A(ins);
 			tv2 = DUK__REGP_BC(ins);
 			DUK_TVAL_SET_TVAL_UPDREF_FAST(thr, tv1, tv2); /* side effects */
-			break;
+			DUK__NEXT();
 		}
 
-		case DUK_OP_STREG: {
+		DUK__OPCASE(STREG): {
 			duk_tval *tv1, *tv2;
 
 			tv1 = DUK__REGP_A(ins);
 			tv2 = DUK__REGP_BC(ins);
 			DUK_TVAL_SET_TVAL_UPDREF_FAST(thr, tv2, tv1); /* side effects */
-			break;
+			DUK__NEXT();
 		}
 
-		case DUK_OP_LDCONST: {
+		DUK__OPCASE(LDCONST): {
 			duk_tval *tv1, *tv2;
 
 			tv1 = DUK__REGP_A(ins);
 			tv2 = DUK__CONSTP_BC(ins);
 			DUK_TVAL_SET_TVAL_UPDREF_FAST(thr, tv1, tv2); /* side effects */
-			break;
+			DUK__NEXT();
 		}
 
 		/* LDINT and LDINTX are intended to load an arbitrary signed
@@ -3428,14 +3624,14 @@ restart_execution:
 		 * This also guarantees all values remain fastints.
 		 */
 #if defined(DUK_USE_EXEC_PREFER_SIZE)
-		case DUK_OP_LDINT: {
+		DUK__OPCASE(LDINT): {
 			duk_int32_t val;
 
 			val = (duk_int32_t) DUK_DEC_BC(ins) - (duk_int32_t) DUK_BC_LDINT_BIAS;
 			duk_push_int(thr, val);
 			DUK__REPLACE_TOP_A_BREAK();
 		}
-		case DUK_OP_LDINTX: {
+		DUK__OPCASE(LDINTX): {
 			duk_int32_t val;
 
 			val = (duk_int32_t) duk_get_int(thr, DUK_DEC_A(ins));
@@ -3444,16 +3640,16 @@ restart_execution:
 			DUK__REPLACE_TOP_A_BREAK();
 		}
 #else /* DUK_USE_EXEC_PREFER_SIZE */
-		case DUK_OP_LDINT: {
+		DUK__OPCASE(LDINT): {
 			duk_tval *tv1;
 			duk_int32_t val;
 
 			val = (duk_int32_t) DUK_DEC_BC(ins) - (duk_int32_t) DUK_BC_LDINT_BIAS;
 			tv1 = DUK__REGP_A(ins);
 			DUK_TVAL_SET_I32_UPDREF(thr, tv1, val); /* side effects */
-			break;
+			DUK__NEXT();
 		}
-		case DUK_OP_LDINTX: {
+		DUK__OPCASE(LDINTX): {
 			duk_tval *tv1;
 			duk_int32_t val;
 
@@ -3469,33 +3665,33 @@ restart_execution:
 			val =
 			    (duk_int32_t) ((duk_uint32_t) val << DUK_BC_LDINTX_SHIFT) + (duk_int32_t) DUK_DEC_BC(ins); /* no bias */
 			DUK_TVAL_SET_I32_UPDREF(thr, tv1, val); /* side effects */
-			break;
+			DUK__NEXT();
 		}
 #endif /* DUK_USE_EXEC_PREFER_SIZE */
 
 #if defined(DUK_USE_EXEC_PREFER_SIZE)
-		case DUK_OP_LDTHIS: {
+		DUK__OPCASE(LDTHIS): {
 			duk_push_this(thr);
 			DUK__REPLACE_TOP_BC_BREAK();
 		}
-		case DUK_OP_LDUNDEF: {
+		DUK__OPCASE(LDUNDEF): {
 			duk_to_undefined(thr, (duk_idx_t) DUK_DEC_BC(ins));
-			break;
+			DUK__NEXT();
 		}
-		case DUK_OP_LDNULL: {
+		DUK__OPCASE(LDNULL): {
 			duk_to_null(thr, (duk_idx_t) DUK_DEC_BC(ins));
-			break;
+			DUK__NEXT();
 		}
-		case DUK_OP_LDTRUE: {
+		DUK__OPCASE(LDTRUE): {
 			duk_push_true(thr);
 			DUK__REPLACE_TOP_BC_BREAK();
 		}
-		case DUK_OP_LDFALSE: {
+		DUK__OPCASE(LDFALSE): {
 			duk_push_false(thr);
 			DUK__REPLACE_TOP_BC_BREAK();
 		}
 #else /* DUK_USE_EXEC_PREFER_SIZE */
-		case DUK_OP_LDTHIS: {
+		DUK__OPCASE(LDTHIS): {
 			/* Note: 'this' may be bound to any value, not just an object */
 			duk_tval *tv1, *tv2;
 
@@ -3503,67 +3699,67 @@ restart_execution:
 			tv2 = thr->valstack_bottom - 1; /* 'this binding' is just under bottom */
 			DUK_ASSERT(tv2 >= thr->valstack);
 			DUK_TVAL_SET_TVAL_UPDREF_FAST(thr, tv1, tv2); /* side effects */
-			break;
+			DUK__NEXT();
 		}
-		case DUK_OP_LDUNDEF: {
+		DUK__OPCASE(LDUNDEF): {
 			duk_tval *tv1;
 
 			tv1 = DUK__REGP_BC(ins);
 			DUK_TVAL_SET_UNDEFINED_UPDREF(thr, tv1); /* side effects */
-			break;
+			DUK__NEXT();
 		}
-		case DUK_OP_LDNULL: {
+		DUK__OPCASE(LDNULL): {
 			duk_tval *tv1;
 
 			tv1 = DUK__REGP_BC(ins);
 			DUK_TVAL_SET_NULL_UPDREF(thr, tv1); /* side effects */
-			break;
+			DUK__NEXT();
 		}
-		case DUK_OP_LDTRUE: {
+		DUK__OPCASE(LDTRUE): {
 			duk_tval *tv1;
 
 			tv1 = DUK__REGP_BC(ins);
 			DUK_TVAL_SET_BOOLEAN_UPDREF(thr, tv1, 1); /* side effects */
-			break;
+			DUK__NEXT();
 		}
-		case DUK_OP_LDFALSE: {
+		DUK__OPCASE(LDFALSE): {
 			duk_tval *tv1;
 
 			tv1 = DUK__REGP_BC(ins);
 			DUK_TVAL_SET_BOOLEAN_UPDREF(thr, tv1, 0); /* side effects */
-			break;
+			DUK__NEXT();
 		}
 #endif /* DUK_USE_EXEC_PREFER_SIZE */
 
-		case DUK_OP_BNOT: {
+		DUK__OPCASE(BNOT): {
 			duk__vm_bitwise_not(thr, DUK_DEC_BC(ins), DUK_DEC_A(ins));
-			break;
+			DUK__NEXT();
 		}
 
-		case DUK_OP_LNOT: {
+		DUK__OPCASE(LNOT): {
 			duk__vm_logical_not(thr, DUK_DEC_BC(ins), DUK_DEC_A(ins));
-			break;
+			DUK__NEXT();
 		}
 
 #if defined(DUK_USE_EXEC_PREFER_SIZE)
-		case DUK_OP_UNM:
-		case DUK_OP_UNP: {
+		DUK__OPCASE(UNM):
+		DUK__OPCASE(UNP): {
 			duk__vm_arith_unary_op(thr, DUK_DEC_BC(ins), DUK_DEC_A(ins), op);
-			break;
+			DUK__NEXT();
 		}
 #else /* DUK_USE_EXEC_PREFER_SIZE */
-		case DUK_OP_UNM: {
+		DUK__OPCASE(UNM): {
 			duk__vm_arith_unary_op(thr, DUK_DEC_BC(ins), DUK_DEC_A(ins), DUK_OP_UNM);
-			break;
+			DUK__NEXT();
 		}
-		case DUK_OP_UNP: {
+		DUK__OPCASE(UNP): {
 			duk__vm_arith_unary_op(thr, DUK_DEC_BC(ins), DUK_DEC_A(ins), DUK_OP_UNP);
-			break;
+			DUK__NEXT();
 		}
 #endif /* DUK_USE_EXEC_PREFER_SIZE */
 
 #if defined(DUK_USE_EXEC_PREFER_SIZE)
-		case DUK_OP_TYPEOF: {
+		DUK__OPCASE(TYPEOF): {
 			duk_small_uint_t stridx;
 
 			stridx = duk_js_typeof_stridx(DUK__REGP_BC(ins));
@@ -3572,7 +3768,7 @@ restart_execution:
 			DUK__REPLACE_TOP_A_BREAK();
 		}
 #else /* DUK_USE_EXEC_PREFER_SIZE */
-		case DUK_OP_TYPEOF: {
+		DUK__OPCASE(TYPEOF): {
 			duk_tval *tv;
 			duk_small_uint_t stridx;
 			duk_hstring *h_str;
@@ -3583,11 +3779,11 @@ restart_execution:
 			h_str = DUK_HTHREAD_GET_STRING(thr, stridx);
 			tv = DUK__REGP_A(ins);
 			DUK_TVAL_SET_STRING_UPDREF(thr, tv, h_str);
-			break;
+			DUK__NEXT();
 		}
 #endif /* DUK_USE_EXEC_PREFER_SIZE */
 
-		case DUK_OP_TYPEOFID: {
+		DUK__OPCASE(TYPEOFID): {
 			duk_small_uint_t stridx;
 #if !defined(DUK_USE_EXEC_PREFER_SIZE)
 			duk_hstring *h_str;
@@ -3623,7 +3819,7 @@ restart_execution:
 			h_str = DUK_HTHREAD_GET_STRING(thr, stridx);
 			tv = DUK__REGP_A(ins);
 			DUK_TVAL_SET_STRING_UPDREF(thr, tv, h_str);
-			break;
+			DUK__NEXT();
 #endif /* DUK_USE_EXEC_PREFER_SIZE */
 		}
 
@@ -3660,58 +3856,58 @@ restart_execution:
 		DUK__REPLACE_BOOL_A_BREAK(tmp); \
 	}
 #if defined(DUK_USE_EXEC_PREFER_SIZE)
-		case DUK_OP_EQ_RR:
-		case DUK_OP_EQ_CR:
-		case DUK_OP_EQ_RC:
-		case DUK_OP_EQ_CC:
+		DUK__OPCASE(EQ_RR):
+		DUK__OPCASE(EQ_CR):
+		DUK__OPCASE(EQ_RC):
+		DUK__OPCASE(EQ_CC):
 			DUK__EQ_BODY(DUK__REGCONSTP_B(ins), DUK__REGCONSTP_C(ins));
-		case DUK_OP_NEQ_RR:
-		case DUK_OP_NEQ_CR:
-		case DUK_OP_NEQ_RC:
-		case DUK_OP_NEQ_CC:
+		DUK__OPCASE(NEQ_RR):
+		DUK__OPCASE(NEQ_CR):
+		DUK__OPCASE(NEQ_RC):
+		DUK__OPCASE(NEQ_CC):
 			DUK__NEQ_BODY(DUK__REGCONSTP_B(ins), DUK__REGCONSTP_C(ins));
-		case DUK_OP_SEQ_RR:
-		case DUK_OP_SEQ_CR:
-		case DUK_OP_SEQ_RC:
-		case DUK_OP_SEQ_CC:
+		DUK__OPCASE(SEQ_RR):
+		DUK__OPCASE(SEQ_CR):
+		DUK__OPCASE(SEQ_RC):
+		DUK__OPCASE(SEQ_CC):
 			DUK__SEQ_BODY(DUK__REGCONSTP_B(ins), DUK__REGCONSTP_C(ins));
-		case DUK_OP_SNEQ_RR:
-		case DUK_OP_SNEQ_CR:
-		case DUK_OP_SNEQ_RC:
-		case DUK_OP_SNEQ_CC:
+		DUK__OPCASE(SNEQ_RR):
+		DUK__OPCASE(SNEQ_CR):
+		DUK__OPCASE(SNEQ_RC):
+		DUK__OPCASE(SNEQ_CC):
 			DUK__SNEQ_BODY(DUK__REGCONSTP_B(ins), DUK__REGCONSTP_C(ins));
 #else /* DUK_USE_EXEC_PREFER_SIZE */
-		case DUK_OP_EQ_RR:
+		DUK__OPCASE(EQ_RR):
 			DUK__EQ_BODY(DUK__REGP_B(ins), DUK__REGP_C(ins));
-		case DUK_OP_EQ_CR:
+		DUK__OPCASE(EQ_CR):
 			DUK__EQ_BODY(DUK__CONSTP_B(ins), DUK__REGP_C(ins));
-		case DUK_OP_EQ_RC:
+		DUK__OPCASE(EQ_RC):
 			DUK__EQ_BODY(DUK__REGP_B(ins), DUK__CONSTP_C(ins));
-		case DUK_OP_EQ_CC:
+		DUK__OPCASE(EQ_CC):
 			DUK__EQ_BODY(DUK__CONSTP_B(ins), DUK__CONSTP_C(ins));
-		case DUK_OP_NEQ_RR:
+		DUK__OPCASE(NEQ_RR):
 			DUK__NEQ_BODY(DUK__REGP_B(ins), DUK__REGP_C(ins));
-		case DUK_OP_NEQ_CR:
+		DUK__OPCASE(NEQ_CR):
 			DUK__NEQ_BODY(DUK__CONSTP_B(ins), DUK__REGP_C(ins));
-		case DUK_OP_NEQ_RC:
+		DUK__OPCASE(NEQ_RC):
 			DUK__NEQ_BODY(DUK__REGP_B(ins), DUK__CONSTP_C(ins));
-		case DUK_OP_NEQ_CC:
+		DUK__OPCASE(NEQ_CC):
 			DUK__NEQ_BODY(DUK__CONSTP_B(ins), DUK__CONSTP_C(ins));
-		case DUK_OP_SEQ_RR:
+		DUK__OPCASE(SEQ_RR):
 			DUK__SEQ_BODY(DUK__REGP_B(ins), DUK__REGP_C(ins));
-		case DUK_OP_SEQ_CR:
+		DUK__OPCASE(SEQ_CR):
 			DUK__SEQ_BODY(DUK__CONSTP_B(ins), DUK__REGP_C(ins));
-		case DUK_OP_SEQ_RC:
+		DUK__OPCASE(SEQ_RC):
 			DUK__SEQ_BODY(DUK__REGP_B(ins), DUK__CONSTP_C(ins));
-		case DUK_OP_SEQ_CC:
+		DUK__OPCASE(SEQ_CC):
 			DUK__SEQ_BODY(DUK__CONSTP_B(ins), DUK__CONSTP_C(ins));
-		case DUK_OP_SNEQ_RR:
+		DUK__OPCASE(SNEQ_RR):
 			DUK__SNEQ_BODY(DUK__REGP_B(ins), DUK__REGP_C(ins));
-		case DUK_OP_SNEQ_CR:
+		DUK__OPCASE(SNEQ_CR):
 			DUK__SNEQ_BODY(DUK__CONSTP_B(ins), DUK__REGP_C(ins));
-		case DUK_OP_SNEQ_RC:
+		DUK__OPCASE(SNEQ_RC):
 			DUK__SNEQ_BODY(DUK__REGP_B(ins), DUK__CONSTP_C(ins));
-		case DUK_OP_SNEQ_CC:
+		DUK__OPCASE(SNEQ_CC):
 			DUK__SNEQ_BODY(DUK__CONSTP_B(ins), DUK__CONSTP_C(ins));
 #endif /* DUK_USE_EXEC_PREFER_SIZE */
 
@@ -3727,353 +3923,448 @@ restart_execution:
 #define DUK__LT_BODY(barg, carg) DUK__COMPARE_BODY((barg), (carg), DUK_COMPARE_FLAG_EVAL_LEFT_FIRST)
 #define DUK__LE_BODY(barg, carg) DUK__COMPARE_BODY((carg), (barg), DUK_COMPARE_FLAG_NEGATE)
 #if defined(DUK_USE_EXEC_PREFER_SIZE)
-		case DUK_OP_GT_RR:
-		case DUK_OP_GT_CR:
-		case DUK_OP_GT_RC:
-		case DUK_OP_GT_CC:
+		DUK__OPCASE(GT_RR):
+		DUK__OPCASE(GT_CR):
+		DUK__OPCASE(GT_RC):
+		DUK__OPCASE(GT_CC):
 			DUK__GT_BODY(DUK__REGCONSTP_B(ins), DUK__REGCONSTP_C(ins));
-		case DUK_OP_GE_RR:
-		case DUK_OP_GE_CR:
-		case DUK_OP_GE_RC:
-		case DUK_OP_GE_CC:
+		DUK__OPCASE(GE_RR):
+		DUK__OPCASE(GE_CR):
+		DUK__OPCASE(GE_RC):
+		DUK__OPCASE(GE_CC):
 			DUK__GE_BODY(DUK__REGCONSTP_B(ins), DUK__REGCONSTP_C(ins));
-		case DUK_OP_LT_RR:
-		case DUK_OP_LT_CR:
-		case DUK_OP_LT_RC:
-		case DUK_OP_LT_CC:
+		DUK__OPCASE(LT_RR):
+		DUK__OPCASE(LT_CR):
+		DUK__OPCASE(LT_RC):
+		DUK__OPCASE(LT_CC):
 			DUK__LT_BODY(DUK__REGCONSTP_B(ins), DUK__REGCONSTP_C(ins));
-		case DUK_OP_LE_RR:
-		case DUK_OP_LE_CR:
-		case DUK_OP_LE_RC:
-		case DUK_OP_LE_CC:
+		DUK__OPCASE(LE_RR):
+		DUK__OPCASE(LE_CR):
+		DUK__OPCASE(LE_RC):
+		DUK__OPCASE(LE_CC):
 			DUK__LE_BODY(DUK__REGCONSTP_B(ins), DUK__REGCONSTP_C(ins));
 #else /* DUK_USE_EXEC_PREFER_SIZE */
-		case DUK_OP_GT_RR:
+		DUK__OPCASE(GT_RR):
 			DUK__GT_BODY(DUK__REGP_B(ins), DUK__REGP_C(ins));
-		case DUK_OP_GT_CR:
+		DUK__OPCASE(GT_CR):
 			DUK__GT_BODY(DUK__CONSTP_B(ins), DUK__REGP_C(ins));
-		case DUK_OP_GT_RC:
+		DUK__OPCASE(GT_RC):
 			DUK__GT_BODY(DUK__REGP_B(ins), DUK__CONSTP_C(ins));
-		case DUK_OP_GT_CC:
+		DUK__OPCASE(GT_CC):
 			DUK__GT_BODY(DUK__CONSTP_B(ins), DUK__CONSTP_C(ins));
-		case DUK_OP_GE_RR:
+		DUK__OPCASE(GE_RR):
 			DUK__GE_BODY(DUK__REGP_B(ins), DUK__REGP_C(ins));
-		case DUK_OP_GE_CR:
+		DUK__OPCASE(GE_CR):
 			DUK__GE_BODY(DUK__CONSTP_B(ins), DUK__REGP_C(ins));
-		case DUK_OP_GE_RC:
+		DUK__OPCASE(GE_RC):
 			DUK__GE_BODY(DUK__REGP_B(ins), DUK__CONSTP_C(ins));
-		case DUK_OP_GE_CC:
+		DUK__OPCASE(GE_CC):
 			DUK__GE_BODY(DUK__CONSTP_B(ins), DUK__CONSTP_C(ins));
-		case DUK_OP_LT_RR:
+		DUK__OPCASE(LT_RR):
 			DUK__LT_BODY(DUK__REGP_B(ins), DUK__REGP_C(ins));
-		case DUK_OP_LT_CR:
+		DUK__OPCASE(LT_CR):
 			DUK__LT_BODY(DUK__CONSTP_B(ins), DUK__REGP_C(ins));
-		case DUK_OP_LT_RC:
+		DUK__OPCASE(LT_RC):
 			DUK__LT_BODY(DUK__REGP_B(ins), DUK__CONSTP_C(ins));
-		case DUK_OP_LT_CC:
+		DUK__OPCASE(LT_CC):
 			DUK__LT_BODY(DUK__CONSTP_B(ins), DUK__CONSTP_C(ins));
-		case DUK_OP_LE_RR:
+		DUK__OPCASE(LE_RR):
 			DUK__LE_BODY(DUK__REGP_B(ins), DUK__REGP_C(ins));
-		case DUK_OP_LE_CR:
+		DUK__OPCASE(LE_CR):
 			DUK__LE_BODY(DUK__CONSTP_B(ins), DUK__REGP_C(ins));
-		case DUK_OP_LE_RC:
+		DUK__OPCASE(LE_RC):
 			DUK__LE_BODY(DUK__REGP_B(ins), DUK__CONSTP_C(ins));
-		case DUK_OP_LE_CC:
+		DUK__OPCASE(LE_CC):
 			DUK__LE_BODY(DUK__CONSTP_B(ins), DUK__CONSTP_C(ins));
 #endif /* DUK_USE_EXEC_PREFER_SIZE */
 
 		/* No size optimized variant at present for IF. */
-		case DUK_OP_IFTRUE_R: {
+		DUK__OPCASE(IFTRUE_R): {
 			if (duk_js_toboolean(DUK__REGP_BC(ins)) != 0) {
 				curr_pc++;
 			}
-			break;
+			DUK__NEXT();
 		}
-		case DUK_OP_IFTRUE_C: {
+		DUK__OPCASE(IFTRUE_C): {
 			if (duk_js_toboolean(DUK__CONSTP_BC(ins)) != 0) {
 				curr_pc++;
 			}
-			break;
+			DUK__NEXT();
 		}
-		case DUK_OP_IFFALSE_R: {
+		DUK__OPCASE(IFFALSE_R): {
 			if (duk_js_toboolean(DUK__REGP_BC(ins)) == 0) {
 				curr_pc++;
 			}
-			break;
+			DUK__NEXT();
 		}
-		case DUK_OP_IFFALSE_C: {
+		DUK__OPCASE(IFFALSE_C): {
 			if (duk_js_toboolean(DUK__CONSTP_BC(ins)) == 0) {
 				curr_pc++;
 			}
-			break;
+			DUK__NEXT();
 		}
 
+		/* Fused compare and conditional skip, emitted by the compiler
+		 * for comparisons used directly as a condition.
+		 */
+#define DUK__IFCMP_BODY(cop, barg, carg) \
+	{ \
+		duk_bool_t tmp; \
+		tmp = duk__vm_ifcmp(thr, (cop), (barg), (carg)); \
+		DUK_ASSERT(tmp == 0 || tmp == 1); \
+		if (tmp == (duk_bool_t) DUK_DEC_A(ins)) { \
+			curr_pc++; \
+		} \
+		DUK__NEXT(); \
+	}
 #if defined(DUK_USE_EXEC_PREFER_SIZE)
-		case DUK_OP_ADD_RR:
-		case DUK_OP_ADD_CR:
-		case DUK_OP_ADD_RC:
-		case DUK_OP_ADD_CC: {
+		DUK__OPCASE(IFLT_RR):
+		DUK__OPCASE(IFLT_CR):
+		DUK__OPCASE(IFLT_RC):
+		DUK__OPCASE(IFLT_CC):
+			DUK__IFCMP_BODY(DUK_OP_IFLT, DUK__REGCONSTP_B(ins), DUK__REGCONSTP_C(ins));
+		DUK__OPCASE(IFLE_RR):
+		DUK__OPCASE(IFLE_CR):
+		DUK__OPCASE(IFLE_RC):
+		DUK__OPCASE(IFLE_CC):
+			DUK__IFCMP_BODY(DUK_OP_IFLE, DUK__REGCONSTP_B(ins), DUK__REGCONSTP_C(ins));
+		DUK__OPCASE(IFGT_RR):
+		DUK__OPCASE(IFGT_CR):
+		DUK__OPCASE(IFGT_RC):
+		DUK__OPCASE(IFGT_CC):
+			DUK__IFCMP_BODY(DUK_OP_IFGT, DUK__REGCONSTP_B(ins), DUK__REGCONSTP_C(ins));
+		DUK__OPCASE(IFGE_RR):
+		DUK__OPCASE(IFGE_CR):
+		DUK__OPCASE(IFGE_RC):
+		DUK__OPCASE(IFGE_CC):
+			DUK__IFCMP_BODY(DUK_OP_IFGE, DUK__REGCONSTP_B(ins), DUK__REGCONSTP_C(ins));
+		DUK__OPCASE(IFSEQ_RR):
+		DUK__OPCASE(IFSEQ_CR):
+		DUK__OPCASE(IFSEQ_RC):
+		DUK__OPCASE(IFSEQ_CC):
+			DUK__IFCMP_BODY(DUK_OP_IFSEQ, DUK__REGCONSTP_B(ins), DUK__REGCONSTP_C(ins));
+		DUK__OPCASE(IFEQ_RR):
+		DUK__OPCASE(IFEQ_CR):
+		DUK__OPCASE(IFEQ_RC):
+		DUK__OPCASE(IFEQ_CC):
+			DUK__IFCMP_BODY(DUK_OP_IFEQ, DUK__REGCONSTP_B(ins), DUK__REGCONSTP_C(ins));
+#else /* DUK_USE_EXEC_PREFER_SIZE */
+		DUK__OPCASE(IFLT_RR):
+			DUK__IFCMP_BODY(DUK_OP_IFLT, DUK__REGP_B(ins), DUK__REGP_C(ins));
+		DUK__OPCASE(IFLT_CR):
+			DUK__IFCMP_BODY(DUK_OP_IFLT, DUK__CONSTP_B(ins), DUK__REGP_C(ins));
+		DUK__OPCASE(IFLT_RC):
+			DUK__IFCMP_BODY(DUK_OP_IFLT, DUK__REGP_B(ins), DUK__CONSTP_C(ins));
+		DUK__OPCASE(IFLT_CC):
+			DUK__IFCMP_BODY(DUK_OP_IFLT, DUK__CONSTP_B(ins), DUK__CONSTP_C(ins));
+		DUK__OPCASE(IFLE_RR):
+			DUK__IFCMP_BODY(DUK_OP_IFLE, DUK__REGP_B(ins), DUK__REGP_C(ins));
+		DUK__OPCASE(IFLE_CR):
+			DUK__IFCMP_BODY(DUK_OP_IFLE, DUK__CONSTP_B(ins), DUK__REGP_C(ins));
+		DUK__OPCASE(IFLE_RC):
+			DUK__IFCMP_BODY(DUK_OP_IFLE, DUK__REGP_B(ins), DUK__CONSTP_C(ins));
+		DUK__OPCASE(IFLE_CC):
+			DUK__IFCMP_BODY(DUK_OP_IFLE, DUK__CONSTP_B(ins), DUK__CONSTP_C(ins));
+		DUK__OPCASE(IFGT_RR):
+			DUK__IFCMP_BODY(DUK_OP_IFGT, DUK__REGP_B(ins), DUK__REGP_C(ins));
+		DUK__OPCASE(IFGT_CR):
+			DUK__IFCMP_BODY(DUK_OP_IFGT, DUK__CONSTP_B(ins), DUK__REGP_C(ins));
+		DUK__OPCASE(IFGT_RC):
+			DUK__IFCMP_BODY(DUK_OP_IFGT, DUK__REGP_B(ins), DUK__CONSTP_C(ins));
+		DUK__OPCASE(IFGT_CC):
+			DUK__IFCMP_BODY(DUK_OP_IFGT, DUK__CONSTP_B(ins), DUK__CONSTP_C(ins));
+		DUK__OPCASE(IFGE_RR):
+			DUK__IFCMP_BODY(DUK_OP_IFGE, DUK__REGP_B(ins), DUK__REGP_C(ins));
+		DUK__OPCASE(IFGE_CR):
+			DUK__IFCMP_BODY(DUK_OP_IFGE, DUK__CONSTP_B(ins), DUK__REGP_C(ins));
+		DUK__OPCASE(IFGE_RC):
+			DUK__IFCMP_BODY(DUK_OP_IFGE, DUK__REGP_B(ins), DUK__CONSTP_C(ins));
+		DUK__OPCASE(IFGE_CC):
+			DUK__IFCMP_BODY(DUK_OP_IFGE, DUK__CONSTP_B(ins), DUK__CONSTP_C(ins));
+		DUK__OPCASE(IFSEQ_RR):
+			DUK__IFCMP_BODY(DUK_OP_IFSEQ, DUK__REGP_B(ins), DUK__REGP_C(ins));
+		DUK__OPCASE(IFSEQ_CR):
+			DUK__IFCMP_BODY(DUK_OP_IFSEQ, DUK__CONSTP_B(ins), DUK__REGP_C(ins));
+		DUK__OPCASE(IFSEQ_RC):
+			DUK__IFCMP_BODY(DUK_OP_IFSEQ, DUK__REGP_B(ins), DUK__CONSTP_C(ins));
+		DUK__OPCASE(IFSEQ_CC):
+			DUK__IFCMP_BODY(DUK_OP_IFSEQ, DUK__CONSTP_B(ins), DUK__CONSTP_C(ins));
+		DUK__OPCASE(IFEQ_RR):
+			DUK__IFCMP_BODY(DUK_OP_IFEQ, DUK__REGP_B(ins), DUK__REGP_C(ins));
+		DUK__OPCASE(IFEQ_CR):
+			DUK__IFCMP_BODY(DUK_OP_IFEQ, DUK__CONSTP_B(ins), DUK__REGP_C(ins));
+		DUK__OPCASE(IFEQ_RC):
+			DUK__IFCMP_BODY(DUK_OP_IFEQ, DUK__REGP_B(ins), DUK__CONSTP_C(ins));
+		DUK__OPCASE(IFEQ_CC):
+			DUK__IFCMP_BODY(DUK_OP_IFEQ, DUK__CONSTP_B(ins), DUK__CONSTP_C(ins));
+#endif /* DUK_USE_EXEC_PREFER_SIZE */
+
+#if defined(DUK_USE_EXEC_PREFER_SIZE)
+		DUK__OPCASE(ADD_RR):
+		DUK__OPCASE(ADD_CR):
+		DUK__OPCASE(ADD_RC):
+		DUK__OPCASE(ADD_CC): {
 			/* XXX: could leave value on stack top and goto replace_top_a; */
 			duk__vm_arith_add(thr, DUK__REGCONSTP_B(ins), DUK__REGCONSTP_C(ins), DUK_DEC_A(ins));
-			break;
+			DUK__NEXT();
 		}
 #else /* DUK_USE_EXEC_PREFER_SIZE */
-		case DUK_OP_ADD_RR: {
+		DUK__OPCASE(ADD_RR): {
 			duk__vm_arith_add(thr, DUK__REGP_B(ins), DUK__REGP_C(ins), DUK_DEC_A(ins));
-			break;
+			DUK__NEXT();
 		}
-		case DUK_OP_ADD_CR: {
+		DUK__OPCASE(ADD_CR): {
 			duk__vm_arith_add(thr, DUK__CONSTP_B(ins), DUK__REGP_C(ins), DUK_DEC_A(ins));
-			break;
+			DUK__NEXT();
 		}
-		case DUK_OP_ADD_RC: {
+		DUK__OPCASE(ADD_RC): {
 			duk__vm_arith_add(thr, DUK__REGP_B(ins), DUK__CONSTP_C(ins), DUK_DEC_A(ins));
-			break;
+			DUK__NEXT();
 		}
-		case DUK_OP_ADD_CC: {
+		DUK__OPCASE(ADD_CC): {
 			duk__vm_arith_add(thr, DUK__CONSTP_B(ins), DUK__CONSTP_C(ins), DUK_DEC_A(ins));
-			break;
+			DUK__NEXT();
 		}
 #endif /* DUK_USE_EXEC_PREFER_SIZE */
 
 #if defined(DUK_USE_EXEC_PREFER_SIZE)
-		case DUK_OP_SUB_RR:
-		case DUK_OP_SUB_CR:
-		case DUK_OP_SUB_RC:
-		case DUK_OP_SUB_CC:
-		case DUK_OP_MUL_RR:
-		case DUK_OP_MUL_CR:
-		case DUK_OP_MUL_RC:
-		case DUK_OP_MUL_CC:
-		case DUK_OP_DIV_RR:
-		case DUK_OP_DIV_CR:
-		case DUK_OP_DIV_RC:
-		case DUK_OP_DIV_CC:
-		case DUK_OP_MOD_RR:
-		case DUK_OP_MOD_CR:
-		case DUK_OP_MOD_RC:
-		case DUK_OP_MOD_CC:
+		DUK__OPCASE(SUB_RR):
+		DUK__OPCASE(SUB_CR):
+		DUK__OPCASE(SUB_RC):
+		DUK__OPCASE(SUB_CC):
+		DUK__OPCASE(MUL_RR):
+		DUK__OPCASE(MUL_CR):
+		DUK__OPCASE(MUL_RC):
+		DUK__OPCASE(MUL_CC):
+		DUK__OPCASE(DIV_RR):
+		DUK__OPCASE(DIV_CR):
+		DUK__OPCASE(DIV_RC):
+		DUK__OPCASE(DIV_CC):
+		DUK__OPCASE(MOD_RR):
+		DUK__OPCASE(MOD_CR):
+		DUK__OPCASE(MOD_RC):
+		DUK__OPCASE(MOD_CC):
 #if defined(DUK_USE_ES7_EXP_OPERATOR)
-		case DUK_OP_EXP_RR:
-		case DUK_OP_EXP_CR:
-		case DUK_OP_EXP_RC:
-		case DUK_OP_EXP_CC:
+		DUK__OPCASE(EXP_RR):
+		DUK__OPCASE(EXP_CR):
+		DUK__OPCASE(EXP_RC):
+		DUK__OPCASE(EXP_CC):
 #endif /* DUK_USE_ES7_EXP_OPERATOR */
 		{
 			/* XXX: could leave value on stack top and goto replace_top_a; */
 			duk__vm_arith_binary_op(thr, DUK__REGCONSTP_B(ins), DUK__REGCONSTP_C(ins), DUK_DEC_A(ins), op);
-			break;
+			DUK__NEXT();
 		}
 #else /* DUK_USE_EXEC_PREFER_SIZE */
-		case DUK_OP_SUB_RR: {
+		DUK__OPCASE(SUB_RR): {
 			duk__vm_arith_binary_op(thr, DUK__REGP_B(ins), DUK__REGP_C(ins), DUK_DEC_A(ins), DUK_OP_SUB);
-			break;
+			DUK__NEXT();
 		}
-		case DUK_OP_SUB_CR: {
+		DUK__OPCASE(SUB_CR): {
 			duk__vm_arith_binary_op(thr, DUK__CONSTP_B(ins), DUK__REGP_C(ins), DUK_DEC_A(ins), DUK_OP_SUB);
-			break;
+			DUK__NEXT();
 		}
-		case DUK_OP_SUB_RC: {
+		DUK__OPCASE(SUB_RC): {
 			duk__vm_arith_binary_op(thr, DUK__REGP_B(ins), DUK__CONSTP_C(ins), DUK_DEC_A(ins), DUK_OP_SUB);
-			break;
+			DUK__NEXT();
 		}
-		case DUK_OP_SUB_CC: {
+		DUK__OPCASE(SUB_CC): {
 			duk__vm_arith_binary_op(thr, DUK__CONSTP_B(ins), DUK__CONSTP_C(ins), DUK_DEC_A(ins), DUK_OP_SUB);
-			break;
+			DUK__NEXT();
 		}
-		case DUK_OP_MUL_RR: {
+		DUK__OPCASE(MUL_RR): {
 			duk__vm_arith_binary_op(thr, DUK__REGP_B(ins), DUK__REGP_C(ins), DUK_DEC_A(ins), DUK_OP_MUL);
-			break;
+			DUK__NEXT();
 		}
-		case DUK_OP_MUL_CR: {
+		DUK__OPCASE(MUL_CR): {
 			duk__vm_arith_binary_op(thr, DUK__CONSTP_B(ins), DUK__REGP_C(ins), DUK_DEC_A(ins), DUK_OP_MUL);
-			break;
+			DUK__NEXT();
 		}
-		case DUK_OP_MUL_RC: {
+		DUK__OPCASE(MUL_RC): {
 			duk__vm_arith_binary_op(thr, DUK__REGP_B(ins), DUK__CONSTP_C(ins), DUK_DEC_A(ins), DUK_OP_MUL);
-			break;
+			DUK__NEXT();
 		}
-		case DUK_OP_MUL_CC: {
+		DUK__OPCASE(MUL_CC): {
 			duk__vm_arith_binary_op(thr, DUK__CONSTP_B(ins), DUK__CONSTP_C(ins), DUK_DEC_A(ins), DUK_OP_MUL);
-			break;
+			DUK__NEXT();
 		}
-		case DUK_OP_DIV_RR: {
+		DUK__OPCASE(DIV_RR): {
 			duk__vm_arith_binary_op(thr, DUK__REGP_B(ins), DUK__REGP_C(ins), DUK_DEC_A(ins), DUK_OP_DIV);
-			break;
+			DUK__NEXT();
 		}
-		case DUK_OP_DIV_CR: {
+		DUK__OPCASE(DIV_CR): {
 			duk__vm_arith_binary_op(thr, DUK__CONSTP_B(ins), DUK__REGP_C(ins), DUK_DEC_A(ins), DUK_OP_DIV);
-			break;
+			DUK__NEXT();
 		}
-		case DUK_OP_DIV_RC: {
+		DUK__OPCASE(DIV_RC): {
 			duk__vm_arith_binary_op(thr, DUK__REGP_B(ins), DUK__CONSTP_C(ins), DUK_DEC_A(ins), DUK_OP_DIV);
-			break;
+			DUK__NEXT();
 		}
-		case DUK_OP_DIV_CC: {
+		DUK__OPCASE(DIV_CC): {
 			duk__vm_arith_binary_op(thr, DUK__CONSTP_B(ins), DUK__CONSTP_C(ins), DUK_DEC_A(ins), DUK_OP_DIV);
-			break;
+			DUK__NEXT();
 		}
-		case DUK_OP_MOD_RR: {
+		DUK__OPCASE(MOD_RR): {
 			duk__vm_arith_binary_op(thr, DUK__REGP_B(ins), DUK__REGP_C(ins), DUK_DEC_A(ins), DUK_OP_MOD);
-			break;
+			DUK__NEXT();
 		}
-		case DUK_OP_MOD_CR: {
+		DUK__OPCASE(MOD_CR): {
 			duk__vm_arith_binary_op(thr, DUK__CONSTP_B(ins), DUK__REGP_C(ins), DUK_DEC_A(ins), DUK_OP_MOD);
-			break;
+			DUK__NEXT();
 		}
-		case DUK_OP_MOD_RC: {
+		DUK__OPCASE(MOD_RC): {
 			duk__vm_arith_binary_op(thr, DUK__REGP_B(ins), DUK__CONSTP_C(ins), DUK_DEC_A(ins), DUK_OP_MOD);
-			break;
+			DUK__NEXT();
 		}
-		case DUK_OP_MOD_CC: {
+		DUK__OPCASE(MOD_CC): {
 			duk__vm_arith_binary_op(thr, DUK__CONSTP_B(ins), DUK__CONSTP_C(ins), DUK_DEC_A(ins), DUK_OP_MOD);
-			break;
+			DUK__NEXT();
 		}
 #if defined(DUK_USE_ES7_EXP_OPERATOR)
-		case DUK_OP_EXP_RR: {
+		DUK__OPCASE(EXP_RR): {
 			duk__vm_arith_binary_op(thr, DUK__REGP_B(ins), DUK__REGP_C(ins), DUK_DEC_A(ins), DUK_OP_EXP);
-			break;
+			DUK__NEXT();
 		}
-		case DUK_OP_EXP_CR: {
+		DUK__OPCASE(EXP_CR): {
 			duk__vm_arith_binary_op(thr, DUK__CONSTP_B(ins), DUK__REGP_C(ins), DUK_DEC_A(ins), DUK_OP_EXP);
-			break;
+			DUK__NEXT();
 		}
-		case DUK_OP_EXP_RC: {
+		DUK__OPCASE(EXP_RC): {
 			duk__vm_arith_binary_op(thr, DUK__REGP_B(ins), DUK__CONSTP_C(ins), DUK_DEC_A(ins), DUK_OP_EXP);
-			break;
+			DUK__NEXT();
 		}
-		case DUK_OP_EXP_CC: {
+		DUK__OPCASE(EXP_CC): {
 			duk__vm_arith_binary_op(thr, DUK__CONSTP_B(ins), DUK__CONSTP_C(ins), DUK_DEC_A(ins), DUK_OP_EXP);
-			break;
+			DUK__NEXT();
 		}
 #endif /* DUK_USE_ES7_EXP_OPERATOR */
 #endif /* DUK_USE_EXEC_PREFER_SIZE */
 
 #if defined(DUK_USE_EXEC_PREFER_SIZE)
-		case DUK_OP_BAND_RR:
-		case DUK_OP_BAND_CR:
-		case DUK_OP_BAND_RC:
-		case DUK_OP_BAND_CC:
-		case DUK_OP_BOR_RR:
-		case DUK_OP_BOR_CR:
-		case DUK_OP_BOR_RC:
-		case DUK_OP_BOR_CC:
-		case DUK_OP_BXOR_RR:
-		case DUK_OP_BXOR_CR:
-		case DUK_OP_BXOR_RC:
-		case DUK_OP_BXOR_CC:
-		case DUK_OP_BASL_RR:
-		case DUK_OP_BASL_CR:
-		case DUK_OP_BASL_RC:
-		case DUK_OP_BASL_CC:
-		case DUK_OP_BLSR_RR:
-		case DUK_OP_BLSR_CR:
-		case DUK_OP_BLSR_RC:
-		case DUK_OP_BLSR_CC:
-		case DUK_OP_BASR_RR:
-		case DUK_OP_BASR_CR:
-		case DUK_OP_BASR_RC:
-		case DUK_OP_BASR_CC: {
+		DUK__OPCASE(BAND_RR):
+		DUK__OPCASE(BAND_CR):
+		DUK__OPCASE(BAND_RC):
+		DUK__OPCASE(BAND_CC):
+		DUK__OPCASE(BOR_RR):
+		DUK__OPCASE(BOR_CR):
+		DUK__OPCASE(BOR_RC):
+		DUK__OPCASE(BOR_CC):
+		DUK__OPCASE(BXOR_RR):
+		DUK__OPCASE(BXOR_CR):
+		DUK__OPCASE(BXOR_RC):
+		DUK__OPCASE(BXOR_CC):
+		DUK__OPCASE(BASL_RR):
+		DUK__OPCASE(BASL_CR):
+		DUK__OPCASE(BASL_RC):
+		DUK__OPCASE(BASL_CC):
+		DUK__OPCASE(BLSR_RR):
+		DUK__OPCASE(BLSR_CR):
+		DUK__OPCASE(BLSR_RC):
+		DUK__OPCASE(BLSR_CC):
+		DUK__OPCASE(BASR_RR):
+		DUK__OPCASE(BASR_CR):
+		DUK__OPCASE(BASR_RC):
+		DUK__OPCASE(BASR_CC): {
 			/* XXX: could leave value on stack top and goto replace_top_a; */
 			duk__vm_bitwise_binary_op(thr, DUK__REGCONSTP_B(ins), DUK__REGCONSTP_C(ins), DUK_DEC_A(ins), op);
-			break;
+			DUK__NEXT();
 		}
 #else /* DUK_USE_EXEC_PREFER_SIZE */
-		case DUK_OP_BAND_RR: {
+		DUK__OPCASE(BAND_RR): {
 			duk__vm_bitwise_binary_op(thr, DUK__REGP_B(ins), DUK__REGP_C(ins), DUK_DEC_A(ins), DUK_OP_BAND);
-			break;
+			DUK__NEXT();
 		}
-		case DUK_OP_BAND_CR: {
+		DUK__OPCASE(BAND_CR): {
 			duk__vm_bitwise_binary_op(thr, DUK__CONSTP_B(ins), DUK__REGP_C(ins), DUK_DEC_A(ins), DUK_OP_BAND);
-			break;
+			DUK__NEXT();
 		}
-		case DUK_OP_BAND_RC: {
+		DUK__OPCASE(BAND_RC): {
 			duk__vm_bitwise_binary_op(thr, DUK__REGP_B(ins), DUK__CONSTP_C(ins), DUK_DEC_A(ins), DUK_OP_BAND);
-			break;
+			DUK__NEXT();
 		}
-		case DUK_OP_BAND_CC: {
+		DUK__OPCASE(BAND_CC): {
 			duk__vm_bitwise_binary_op(thr, DUK__CONSTP_B(ins), DUK__CONSTP_C(ins), DUK_DEC_A(ins), DUK_OP_BAND);
-			break;
+			DUK__NEXT();
 		}
-		case DUK_OP_BOR_RR: {
+		DUK__OPCASE(BOR_RR): {
 			duk__vm_bitwise_binary_op(thr, DUK__REGP_B(ins), DUK__REGP_C(ins), DUK_DEC_A(ins), DUK_OP_BOR);
-			break;
+			DUK__NEXT();
 		}
-		case DUK_OP_BOR_CR: {
+		DUK__OPCASE(BOR_CR): {
 			duk__vm_bitwise_binary_op(thr, DUK__CONSTP_B(ins), DUK__REGP_C(ins), DUK_DEC_A(ins), DUK_OP_BOR);
-			break;
+			DUK__NEXT();
 		}
-		case DUK_OP_BOR_RC: {
+		DUK__OPCASE(BOR_RC): {
 			duk__vm_bitwise_binary_op(thr, DUK__REGP_B(ins), DUK__CONSTP_C(ins), DUK_DEC_A(ins), DUK_OP_BOR);
-			break;
+			DUK__NEXT();
 		}
-		case DUK_OP_BOR_CC: {
+		DUK__OPCASE(BOR_CC): {
 			duk__vm_bitwise_binary_op(thr, DUK__CONSTP_B(ins), DUK__CONSTP_C(ins), DUK_DEC_A(ins), DUK_OP_BOR);
-			break;
+			DUK__NEXT();
 		}
-		case DUK_OP_BXOR_RR: {
+		DUK__OPCASE(BXOR_RR): {
 			duk__vm_bitwise_binary_op(thr, DUK__REGP_B(ins), DUK__REGP_C(ins), DUK_DEC_A(ins), DUK_OP_BXOR);
-			break;
+			DUK__NEXT();
 		}
-		case DUK_OP_BXOR_CR: {
+		DUK__OPCASE(BXOR_CR): {
 			duk__vm_bitwise_binary_op(thr, DUK__CONSTP_B(ins), DUK__REGP_C(ins), DUK_DEC_A(ins), DUK_OP_BXOR);
-			break;
+			DUK__NEXT();
 		}
-		case DUK_OP_BXOR_RC: {
+		DUK__OPCASE(BXOR_RC): {
 			duk__vm_bitwise_binary_op(thr, DUK__REGP_B(ins), DUK__CONSTP_C(ins), DUK_DEC_A(ins), DUK_OP_BXOR);
-			break;
+			DUK__NEXT();
 		}
-		case DUK_OP_BXOR_CC: {
+		DUK__OPCASE(BXOR_CC): {
 			duk__vm_bitwise_binary_op(thr, DUK__CONSTP_B(ins), DUK__CONSTP_C(ins), DUK_DEC_A(ins), DUK_OP_BXOR);
-			break;
+			DUK__NEXT();
 		}
-		case DUK_OP_BASL_RR: {
+		DUK__OPCASE(BASL_RR): {
 			duk__vm_bitwise_binary_op(thr, DUK__REGP_B(ins), DUK__REGP_C(ins), DUK_DEC_A(ins), DUK_OP_BASL);
-			break;
+			DUK__NEXT();
 		}
-		case DUK_OP_BASL_CR: {
+		DUK__OPCASE(BASL_CR): {
 			duk__vm_bitwise_binary_op(thr, DUK__CONSTP_B(ins), DUK__REGP_C(ins), DUK_DEC_A(ins), DUK_OP_BASL);
-			break;
+			DUK__NEXT();
 		}
-		case DUK_OP_BASL_RC: {
+		DUK__OPCASE(BASL_RC): {
 			duk__vm_bitwise_binary_op(thr, DUK__REGP_B(ins), DUK__CONSTP_C(ins), DUK_DEC_A(ins), DUK_OP_BASL);
-			break;
+			DUK__NEXT();
 		}
-		case DUK_OP_BASL_CC: {
+		DUK__OPCASE(BASL_CC): {
 			duk__vm_bitwise_binary_op(thr, DUK__CONSTP_B(ins), DUK__CONSTP_C(ins), DUK_DEC_A(ins), DUK_OP_BASL);
-			break;
+			DUK__NEXT();
 		}
-		case DUK_OP_BLSR_RR: {
+		DUK__OPCASE(BLSR_RR): {
 			duk__vm_bitwise_binary_op(thr, DUK__REGP_B(ins), DUK__REGP_C(ins), DUK_DEC_A(ins), DUK_OP_BLSR);
-			break;
+			DUK__NEXT();
 		}
-		case DUK_OP_BLSR_CR: {
+		DUK__OPCASE(BLSR_CR): {
 			duk__vm_bitwise_binary_op(thr, DUK__CONSTP_B(ins), DUK__REGP_C(ins), DUK_DEC_A(ins), DUK_OP_BLSR);
-			break;
+			DUK__NEXT();
 		}
-		case DUK_OP_BLSR_RC: {
+		DUK__OPCASE(BLSR_RC): {
 			duk__vm_bitwise_binary_op(thr, DUK__REGP_B(ins), DUK__CONSTP_C(ins), DUK_DEC_A(ins), DUK_OP_BLSR);
-			break;
+			DUK__NEXT();
 		}
-		case DUK_OP_BLSR_CC: {
+		DUK__OPCASE(BLSR_CC): {
 			duk__vm_bitwise_binary_op(thr, DUK__CONSTP_B(ins), DUK__CONSTP_C(ins), DUK_DEC_A(ins), DUK_OP_BLSR);
-			break;
+			DUK__NEXT();
 		}
-		case DUK_OP_BASR_RR: {
+		DUK__OPCASE(BASR_RR): {
 			duk__vm_bitwise_binary_op(thr, DUK__REGP_B(ins), DUK__REGP_C(ins), DUK_DEC_A(ins), DUK_OP_BASR);
-			break;
+			DUK__NEXT();
 		}
-		case DUK_OP_BASR_CR: {
+		DUK__OPCASE(BASR_CR): {
 			duk__vm_bitwise_binary_op(thr, DUK__CONSTP_B(ins), DUK__REGP_C(ins), DUK_DEC_A(ins), DUK_OP_BASR);
-			break;
+			DUK__NEXT();
 		}
-		case DUK_OP_BASR_RC: {
+		DUK__OPCASE(BASR_RC): {
 			duk__vm_bitwise_binary_op(thr, DUK__REGP_B(ins), DUK__CONSTP_C(ins), DUK_DEC_A(ins), DUK_OP_BASR);
-			break;
+			DUK__NEXT();
 		}
-		case DUK_OP_BASR_CC: {
+		DUK__OPCASE(BASR_CC): {
 			duk__vm_bitwise_binary_op(thr, DUK__CONSTP_B(ins), DUK__CONSTP_C(ins), DUK_DEC_A(ins), DUK_OP_BASR);
-			break;
+			DUK__NEXT();
 		}
 #endif /* DUK_USE_EXEC_PREFER_SIZE */
 
@@ -4093,104 +4384,104 @@ restart_execution:
 		DUK__REPLACE_BOOL_A_BREAK(tmp); \
 	}
 #if defined(DUK_USE_EXEC_PREFER_SIZE)
-		case DUK_OP_INSTOF_RR:
-		case DUK_OP_INSTOF_CR:
-		case DUK_OP_INSTOF_RC:
-		case DUK_OP_INSTOF_CC:
+		DUK__OPCASE(INSTOF_RR):
+		DUK__OPCASE(INSTOF_CR):
+		DUK__OPCASE(INSTOF_RC):
+		DUK__OPCASE(INSTOF_CC):
 			DUK__INSTOF_BODY(DUK__REGCONSTP_B(ins), DUK__REGCONSTP_C(ins));
-		case DUK_OP_IN_RR:
-		case DUK_OP_IN_CR:
-		case DUK_OP_IN_RC:
-		case DUK_OP_IN_CC:
+		DUK__OPCASE(IN_RR):
+		DUK__OPCASE(IN_CR):
+		DUK__OPCASE(IN_RC):
+		DUK__OPCASE(IN_CC):
 			DUK__IN_BODY(DUK__REGCONSTP_B(ins), DUK__REGCONSTP_C(ins));
 #else /* DUK_USE_EXEC_PREFER_SIZE */
-		case DUK_OP_INSTOF_RR:
+		DUK__OPCASE(INSTOF_RR):
 			DUK__INSTOF_BODY(DUK__REGP_B(ins), DUK__REGP_C(ins));
-		case DUK_OP_INSTOF_CR:
+		DUK__OPCASE(INSTOF_CR):
 			DUK__INSTOF_BODY(DUK__CONSTP_B(ins), DUK__REGP_C(ins));
-		case DUK_OP_INSTOF_RC:
+		DUK__OPCASE(INSTOF_RC):
 			DUK__INSTOF_BODY(DUK__REGP_B(ins), DUK__CONSTP_C(ins));
-		case DUK_OP_INSTOF_CC:
+		DUK__OPCASE(INSTOF_CC):
 			DUK__INSTOF_BODY(DUK__CONSTP_B(ins), DUK__CONSTP_C(ins));
-		case DUK_OP_IN_RR:
+		DUK__OPCASE(IN_RR):
 			DUK__IN_BODY(DUK__REGP_B(ins), DUK__REGP_C(ins));
-		case DUK_OP_IN_CR:
+		DUK__OPCASE(IN_CR):
 			DUK__IN_BODY(DUK__CONSTP_B(ins), DUK__REGP_C(ins));
-		case DUK_OP_IN_RC:
+		DUK__OPCASE(IN_RC):
 			DUK__IN_BODY(DUK__REGP_B(ins), DUK__CONSTP_C(ins));
-		case DUK_OP_IN_CC:
+		DUK__OPCASE(IN_CC):
 			DUK__IN_BODY(DUK__CONSTP_B(ins), DUK__CONSTP_C(ins));
 #endif /* DUK_USE_EXEC_PREFER_SIZE */
 
 			/* Pre/post inc/dec for register variables, important for loops. */
 #if defined(DUK_USE_EXEC_PREFER_SIZE)
-		case DUK_OP_PREINCR:
-		case DUK_OP_PREDECR:
-		case DUK_OP_POSTINCR:
-		case DUK_OP_POSTDECR: {
+		DUK__OPCASE(PREINCR):
+		DUK__OPCASE(PREDECR):
+		DUK__OPCASE(POSTINCR):
+		DUK__OPCASE(POSTDECR): {
 			duk__prepost_incdec_reg_helper(thr, DUK__REGP_A(ins), DUK__REGP_BC(ins), op);
-			break;
+			DUK__NEXT();
 		}
-		case DUK_OP_PREINCV:
-		case DUK_OP_PREDECV:
-		case DUK_OP_POSTINCV:
-		case DUK_OP_POSTDECV: {
+		DUK__OPCASE(PREINCV):
+		DUK__OPCASE(PREDECV):
+		DUK__OPCASE(POSTINCV):
+		DUK__OPCASE(POSTDECV): {
 			duk__prepost_incdec_var_helper(thr, DUK_DEC_A(ins), DUK__CONSTP_BC(ins), op, DUK__STRICT());
-			break;
+			DUK__NEXT();
 		}
 #else /* DUK_USE_EXEC_PREFER_SIZE */
-		case DUK_OP_PREINCR: {
+		DUK__OPCASE(PREINCR): {
 			duk__prepost_incdec_reg_helper(thr, DUK__REGP_A(ins), DUK__REGP_BC(ins), DUK_OP_PREINCR);
-			break;
+			DUK__NEXT();
 		}
-		case DUK_OP_PREDECR: {
+		DUK__OPCASE(PREDECR): {
 			duk__prepost_incdec_reg_helper(thr, DUK__REGP_A(ins), DUK__REGP_BC(ins), DUK_OP_PREDECR);
-			break;
+			DUK__NEXT();
 		}
-		case DUK_OP_POSTINCR: {
+		DUK__OPCASE(POSTINCR): {
 			duk__prepost_incdec_reg_helper(thr, DUK__REGP_A(ins), DUK__REGP_BC(ins), DUK_OP_POSTINCR);
-			break;
+			DUK__NEXT();
 		}
-		case DUK_OP_POSTDECR: {
+		DUK__OPCASE(POSTDECR): {
 			duk__prepost_incdec_reg_helper(thr, DUK__REGP_A(ins), DUK__REGP_BC(ins), DUK_OP_POSTDECR);
-			break;
+			DUK__NEXT();
 		}
-		case DUK_OP_PREINCV: {
+		DUK__OPCASE(PREINCV): {
 			duk__prepost_incdec_var_helper(thr, DUK_DEC_A(ins), DUK__CONSTP_BC(ins), DUK_OP_PREINCV, DUK__STRICT());
-			break;
+			DUK__NEXT();
 		}
-		case DUK_OP_PREDECV: {
+		DUK__OPCASE(PREDECV): {
 			duk__prepost_incdec_var_helper(thr, DUK_DEC_A(ins), DUK__CONSTP_BC(ins), DUK_OP_PREDECV, DUK__STRICT());
-			break;
+			DUK__NEXT();
 		}
-		case DUK_OP_POSTINCV: {
+		DUK__OPCASE(POSTINCV): {
 			duk__prepost_incdec_var_helper(thr, DUK_DEC_A(ins), DUK__CONSTP_BC(ins), DUK_OP_POSTINCV, DUK__STRICT());
-			break;
+			DUK__NEXT();
 		}
-		case DUK_OP_POSTDECV: {
+		DUK__OPCASE(POSTDECV): {
 			duk__prepost_incdec_var_helper(thr, DUK_DEC_A(ins), DUK__CONSTP_BC(ins), DUK_OP_POSTDECV, DUK__STRICT());
-			break;
+			DUK__NEXT();
 		}
 #endif /* DUK_USE_EXEC_PREFER_SIZE */
 
 		/* XXX: Move to separate helper, optimize for perf/size separately. */
 		/* Preinc/predec for object properties. */
-		case DUK_OP_PREINCP_RR:
-		case DUK_OP_PREINCP_CR:
-		case DUK_OP_PREINCP_RC:
-		case DUK_OP_PREINCP_CC:
-		case DUK_OP_PREDECP_RR:
-		case DUK_OP_PREDECP_CR:
-		case DUK_OP_PREDECP_RC:
-		case DUK_OP_PREDECP_CC:
-		case DUK_OP_POSTINCP_RR:
-		case DUK_OP_POSTINCP_CR:
-		case DUK_OP_POSTINCP_RC:
-		case DUK_OP_POSTINCP_CC:
-		case DUK_OP_POSTDECP_RR:
-		case DUK_OP_POSTDECP_CR:
-		case DUK_OP_POSTDECP_RC:
-		case DUK_OP_POSTDECP_CC: {
+		DUK__OPCASE(PREINCP_RR):
+		DUK__OPCASE(PREINCP_CR):
+		DUK__OPCASE(PREINCP_RC):
+		DUK__OPCASE(PREINCP_CC):
+		DUK__OPCASE(PREDECP_RR):
+		DUK__OPCASE(PREDECP_CR):
+		DUK__OPCASE(PREDECP_RC):
+		DUK__OPCASE(PREDECP_CC):
+		DUK__OPCASE(POSTINCP_RR):
+		DUK__OPCASE(POSTINCP_CR):
+		DUK__OPCASE(POSTINCP_RC):
+		DUK__OPCASE(POSTINCP_CC):
+		DUK__OPCASE(POSTDECP_RR):
+		DUK__OPCASE(POSTDECP_CR):
+		DUK__OPCASE(POSTDECP_RC):
+		DUK__OPCASE(POSTDECP_CC): {
 			duk_tval *tv_obj;
 			duk_tval *tv_key;
 			duk_tval *tv_val;
@@ -4257,7 +4548,7 @@ restart_execution:
 #else
 			tv_dst = DUK__REGP_A(ins);
 			DUK_TVAL_SET_NUMBER_UPDREF(thr, tv_dst, z);
-			break;
+			DUK__NEXT();
 #endif
 		}
 
@@ -4272,7 +4563,7 @@ restart_execution:
 		 * C -> key reg/const \
 		 */ \
 		(void) duk_prop_getvalue_outidx(thr, (bidx), (carg), DUK_DEC_A(ins)); \
-		break; \
+		DUK__NEXT(); \
 	}
 #define DUK__GETPROP_CX_BODY(barg, carg) \
 	{ \
@@ -4283,7 +4574,7 @@ restart_execution:
 		duk_push_tval_unsafe(thr, (barg)); \
 		(void) duk_prop_getvalue_outidx(thr, thr->valstack_top - thr->valstack_bottom - 1, (carg), DUK_DEC_A(ins)); \
 		duk_pop_known(thr); \
-		break; \
+		DUK__NEXT(); \
 	}
 #define DUK__GETPROPC_BODY(barg, carg) \
 	{ \
@@ -4315,7 +4606,7 @@ restart_execution:
 			 */ \
 			duk__vm_getpropc_setup_error(thr, ins, (carg)); \
 		} \
-		break; \
+		DUK__NEXT(); \
 	}
 #define DUK__PUTPROP_XR_BODY(aidx, barg, cidx) \
 	{ \
@@ -4327,7 +4618,7 @@ restart_execution:
 		 * of e.g. GETPROP; 'A' must contain a register-only value. \
 		 */ \
 		(void) duk_prop_putvalue_inidx(thr, (aidx), (barg), (cidx), DUK__STRICT()); \
-		break; \
+		DUK__NEXT(); \
 	}
 #define DUK__PUTPROP_XC_BODY(aidx, barg, carg) \
 	{ \
@@ -4341,7 +4632,7 @@ restart_execution:
 		duk_push_tval_unsafe(thr, (carg)); \
 		(void) duk_prop_putvalue_inidx(thr, (aidx), (barg), duk_get_top(thr) - 1, DUK__STRICT()); \
 		duk_pop_known(thr); \
-		break; \
+		DUK__NEXT(); \
 	}
 #define DUK__DELPROP_BODY(bidx, carg) \
 	{ \
@@ -4355,86 +4646,149 @@ restart_execution:
 		DUK__REPLACE_BOOL_A_BREAK(rc); \
 	}
 #if defined(DUK_USE_EXEC_PREFER_SIZE)
-		case DUK_OP_GETPROP_RR:
-		case DUK_OP_GETPROP_RC:
+		DUK__OPCASE(GETPROP_RR):
+		DUK__OPCASE(GETPROP_RC):
 			DUK__GETPROP_RX_BODY(DUK_DEC_B(ins), DUK__REGCONSTP_C(ins));
 #if 0
-		case DUK_OP_GETPROP_CR:
-		case DUK_OP_GETPROP_CC:
+		DUK__OPCASE(GETPROP_CR):
+		DUK__OPCASE(GETPROP_CC):
 			DUK__GETPROP_CX_BODY(DUK__CONSTP_B(ins), DUK__REGCONSTP_C(ins));
 #endif
 #if defined(DUK_USE_VERBOSE_ERRORS)
-		case DUK_OP_GETPROPC_RR:
-		case DUK_OP_GETPROPC_RC:
+		DUK__OPCASE(GETPROPC_RR):
+		DUK__OPCASE(GETPROPC_RC):
 			DUK__GETPROPC_RX_BODY(DUK_DEC_B(ins), DUK__REGCONSTP_C(ins));
 #if 0
-		case DUK_OP_GETPROPC_CR:
-		case DUK_OP_GETPROPC_CC:
+		DUK__OPCASE(GETPROPC_CR):
+		DUK__OPCASE(GETPROPC_CC):
 			DUK__GETPROPC_BODY(DUK__REGCONSTP_B(ins), DUK__REGCONSTP_C(ins));
 #endif
 #endif
-		case DUK_OP_PUTPROP_RR:
-		case DUK_OP_PUTPROP_CR:
+		DUK__OPCASE(PUTPROP_RR):
+		DUK__OPCASE(PUTPROP_CR):
 			DUK__PUTPROP_XR_BODY(DUK_DEC_A(ins), DUK__REGCONSTP_B(ins), DUK_DEC_C(ins));
-		case DUK_OP_PUTPROP_RC:
-		case DUK_OP_PUTPROP_CC:
+		DUK__OPCASE(PUTPROP_RC):
+		DUK__OPCASE(PUTPROP_CC):
 			DUK__PUTPROP_XC_BODY(DUK_DEC_A(ins), DUK__REGCONSTP_B(ins), DUK__CONSTP_C(ins));
-		case DUK_OP_DELPROP_RR:
-		case DUK_OP_DELPROP_RC: /* B is always reg */
+		DUK__OPCASE(DELPROP_RR):
+		DUK__OPCASE(DELPROP_RC): /* B is always reg */
 			DUK__DELPROP_BODY(DUK_DEC_B(ins), DUK__REGCONSTP_C(ins));
 #else /* DUK_USE_EXEC_PREFER_SIZE */
-		case DUK_OP_GETPROP_RR:
+		DUK__OPCASE(GETPROP_RR):
 			DUK__GETPROP_RX_BODY(DUK_DEC_B(ins), DUK__REGP_C(ins));
-		case DUK_OP_GETPROP_RC: {
+		DUK__OPCASE(GETPROP_RC): {
 			duk_tval *tv_c = DUK__CONSTP_C(ins);
 			if (DUK_LIKELY(DUK_TVAL_IS_STRING(tv_c))) {
+#if defined(DUK_USE_INLINE_CACHE_SIZE)
+				(void) duk_prop_icache_getvalue_strkey_outidx(thr,
+				                                              DUK_DEC_B(ins),
+				                                              DUK_TVAL_GET_STRING(tv_c),
+				                                              DUK_DEC_A(ins),
+				                                              curr_pc);
+#else
 				(void)
 				    duk_prop_getvalue_strkey_outidx(thr, DUK_DEC_B(ins), DUK_TVAL_GET_STRING(tv_c), DUK_DEC_A(ins));
+#endif
 			} else {
 				(void) duk_prop_getvalue_outidx(thr, DUK_DEC_B(ins), tv_c, DUK_DEC_A(ins));
 			}
-			break;
+			DUK__NEXT();
 		}
 #if 0
 			DUK__GETPROP_RX_BODY(DUK_DEC_B(ins), DUK__CONSTP_C(ins));
 #endif
 #if 0
-		case DUK_OP_GETPROP_CR:
+		DUK__OPCASE(GETPROP_CR):
 			DUK__GETPROP_CX_BODY(DUK__CONSTP_B(ins), DUK__REGP_C(ins));
-		case DUK_OP_GETPROP_CC:
+		DUK__OPCASE(GETPROP_CC):
 			DUK__GETPROP_CX_BODY(DUK__CONSTP_B(ins), DUK__CONSTP_C(ins));
 #endif
 #if defined(DUK_USE_VERBOSE_ERRORS)
-		case DUK_OP_GETPROPC_RR:
+		DUK__OPCASE(GETPROPC_RR):
 			DUK__GETPROPC_RX_BODY(DUK_DEC_B(ins), DUK__REGP_C(ins));
-		case DUK_OP_GETPROPC_RC:
+		DUK__OPCASE(GETPROPC_RC):
+#if defined(DUK_USE_INLINE_CACHE_SIZE)
+		{
+			duk_tval *tv_c = DUK__CONSTP_C(ins);
+			duk_tval *tv_targ;
+			if (DUK_LIKELY(DUK_TVAL_IS_STRING(tv_c))) {
+				(void) duk_prop_icache_getvalue_strkey_outidx(thr,
+				                                              DUK_DEC_B(ins),
+				                                              DUK_TVAL_GET_STRING(tv_c),
+				                                              DUK_DEC_A(ins),
+				                                              curr_pc);
+			} else {
+				(void) duk_prop_getvalue_outidx(thr, DUK_DEC_B(ins), tv_c, DUK_DEC_A(ins));
+			}
+			DUK_GC_TORTURE(thr->heap);
+			tv_targ = DUK_GET_TVAL_POSIDX(thr, DUK_DEC_A(ins));
+			if (DUK_UNLIKELY(!duk_is_callable_tval(thr, tv_targ))) {
+				duk__vm_getpropc_setup_error(thr, ins, DUK__CONSTP_C(ins));
+			}
+			DUK__NEXT();
+		}
+#else
 			DUK__GETPROPC_RX_BODY(DUK_DEC_B(ins), DUK__CONSTP_C(ins));
+#endif
 #if 0
-		case DUK_OP_GETPROPC_CR:
+		DUK__OPCASE(GETPROPC_CR):
 			DUK__GETPROPC_BODY(DUK__CONSTP_B(ins), DUK__REGP_C(ins));
-		case DUK_OP_GETPROPC_CC:
+		DUK__OPCASE(GETPROPC_CC):
 			DUK__GETPROPC_BODY(DUK__CONSTP_B(ins), DUK__CONSTP_C(ins));
 #endif
 #endif
-		case DUK_OP_PUTPROP_RR:
+		DUK__OPCASE(PUTPROP_RR):
 			DUK__PUTPROP_XR_BODY(DUK_DEC_A(ins), DUK__REGP_B(ins), DUK_DEC_C(ins));
-		case DUK_OP_PUTPROP_CR:
+		DUK__OPCASE(PUTPROP_CR):
+#if defined(DUK_USE_INLINE_CACHE_SIZE)
+		{
+			duk_tval *tv_b = DUK__CONSTP_B(ins);
+			if (DUK_LIKELY(DUK_TVAL_IS_STRING(tv_b))) {
+				(void) duk_prop_icache_putvalue_strkey_inidx(thr,
+				                                             DUK_DEC_A(ins),
+				                                             DUK_TVAL_GET_STRING(tv_b),
+				                                             DUK_DEC_C(ins),
+				                                             DUK__STRICT(),
+				                                             curr_pc);
+			} else {
+				(void) duk_prop_putvalue_inidx(thr, DUK_DEC_A(ins), tv_b, DUK_DEC_C(ins), DUK__STRICT());
+			}
+			DUK__NEXT();
+		}
+#else
 			DUK__PUTPROP_XR_BODY(DUK_DEC_A(ins), DUK__CONSTP_B(ins), DUK_DEC_C(ins));
-		case DUK_OP_PUTPROP_RC:
+#endif
+		DUK__OPCASE(PUTPROP_RC):
 			DUK__PUTPROP_XC_BODY(DUK_DEC_A(ins), DUK__REGP_B(ins), DUK__CONSTP_C(ins));
-		case DUK_OP_PUTPROP_CC:
+		DUK__OPCASE(PUTPROP_CC):
+#if defined(DUK_USE_INLINE_CACHE_SIZE)
+		{
+			duk_tval *tv_b = DUK__CONSTP_B(ins);
+			if (DUK_LIKELY(DUK_TVAL_IS_STRING(tv_b))) {
+				duk_push_tval_unsafe(thr, DUK__CONSTP_C(ins));
+				(void) duk_prop_icache_putvalue_strkey_inidx(thr,
+				                                             DUK_DEC_A(ins),
+				                                             DUK_TVAL_GET_STRING(tv_b),
+				                                             duk_get_top(thr) - 1,
+				                                             DUK__STRICT(),
+				                                             curr_pc);
+				duk_pop_known(thr);
+				DUK__NEXT();
+			}
+		}
+#endif
 			DUK__PUTPROP_XC_BODY(DUK_DEC_A(ins), DUK__CONSTP_B(ins), DUK__CONSTP_C(ins));
-		case DUK_OP_DELPROP_RR: /* B is always reg */
+		DUK__OPCASE(DELPROP_RR): /* B is always reg */
 			DUK__DELPROP_BODY(DUK_DEC_B(ins), DUK__REGP_C(ins));
-		case DUK_OP_DELPROP_RC:
+		DUK__OPCASE(DELPROP_RC):
 			DUK__DELPROP_BODY(DUK_DEC_B(ins), DUK__CONSTP_C(ins));
 #endif /* DUK_USE_EXEC_PREFER_SIZE */
 
 		/* No fast path for DECLVAR now, it's quite a rare instruction. */
-		case DUK_OP_DECLVAR_RR:
-		case DUK_OP_DECLVAR_CR:
-		case DUK_OP_DECLVAR_RC:
-		case DUK_OP_DECLVAR_CC: {
+		DUK__OPCASE(DECLVAR_RR):
+		DUK__OPCASE(DECLVAR_CR):
+		DUK__OPCASE(DECLVAR_RC):
+		DUK__OPCASE(DECLVAR_CC): {
 			duk_activation *act;
 			duk_small_uint_fast_t a = DUK_DEC_A(ins);
 			duk_tval *tv1;
@@ -4480,17 +4834,17 @@ restart_execution:
 			}
 
 			duk_pop_known(thr);
-			break;
+			DUK__NEXT();
 		}
 
 #if defined(DUK_USE_REGEXP_SUPPORT)
 		/* The compiler should never emit DUK_OP_REGEXP if there is no
 		 * regexp support.
 		 */
-		case DUK_OP_REGEXP_RR:
-		case DUK_OP_REGEXP_CR:
-		case DUK_OP_REGEXP_RC:
-		case DUK_OP_REGEXP_CC: {
+		DUK__OPCASE(REGEXP_RR):
+		DUK__OPCASE(REGEXP_CR):
+		DUK__OPCASE(REGEXP_RC):
+		DUK__OPCASE(REGEXP_CC): {
 			/* A -> target register
 			 * B -> bytecode (also contains flags)
 			 * C -> escaped source
@@ -4504,10 +4858,10 @@ restart_execution:
 #endif /* DUK_USE_REGEXP_SUPPORT */
 
 		/* XXX: 'c' is unused, use whole BC, etc. */
-		case DUK_OP_CSVAR_RR:
-		case DUK_OP_CSVAR_CR:
-		case DUK_OP_CSVAR_RC:
-		case DUK_OP_CSVAR_CC: {
+		DUK__OPCASE(CSVAR_RR):
+		DUK__OPCASE(CSVAR_CR):
+		DUK__OPCASE(CSVAR_RC):
+		DUK__OPCASE(CSVAR_CC): {
 			/* The speciality of calling through a variable binding is that the
 			 * 'this' value may be provided by the variable lookup: E5 Section 6.b.i.
 			 *
@@ -4537,10 +4891,10 @@ restart_execution:
 			/* Could add direct value stack handling. */
 			duk_replace(thr, (duk_idx_t) (idx + 1)); /* 'this' binding */
 			duk_replace(thr, (duk_idx_t) idx); /* variable value (function, we hope, not checked here) */
-			break;
+			DUK__NEXT();
 		}
 
-		case DUK_OP_CLOSURE: {
+		DUK__OPCASE(CLOSURE): {
 			duk_activation *act;
 			duk_hcompfunc *fun_act;
 			duk_small_uint_fast_t bc = DUK_DEC_BC(ins);
@@ -4583,7 +4937,7 @@ restart_execution:
 			DUK__REPLACE_TOP_A_BREAK();
 		}
 
-		case DUK_OP_GETVAR: {
+		DUK__OPCASE(GETVAR): {
 			duk_activation *act;
 			duk_tval *tv1;
 			duk_hstring *name;
@@ -4599,7 +4953,7 @@ restart_execution:
 			DUK__REPLACE_TOP_A_BREAK();
 		}
 
-		case DUK_OP_PUTVAR: {
+		DUK__OPCASE(PUTVAR): {
 			duk_activation *act;
 			duk_tval *tv1;
 			duk_hstring *name;
@@ -4616,10 +4970,10 @@ restart_execution:
 			tv1 = DUK__REGP_A(ins); /* val */
 			act = thr->callstack_curr;
 			duk_js_putvar_activation(thr, act, name, tv1, DUK__STRICT());
-			break;
+			DUK__NEXT();
 		}
 
-		case DUK_OP_DELVAR: {
+		DUK__OPCASE(DELVAR): {
 			duk_activation *act;
 			duk_tval *tv1;
 			duk_hstring *name;
@@ -4634,13 +4988,13 @@ restart_execution:
 			DUK__REPLACE_BOOL_A_BREAK(rc);
 		}
 
-		case DUK_OP_JUMP: {
+		DUK__OPCASE(JUMP): {
 			/* Note: without explicit cast to signed, MSVC will
 			 * apparently generate a large positive jump when the
 			 * bias-corrected value would normally be negative.
 			 */
 			curr_pc += (duk_int_fast_t) DUK_DEC_ABC(ins) - (duk_int_fast_t) DUK_BC_JUMP_BIAS;
-			break;
+			DUK__NEXT();
 		}
 
 #define DUK__RETURN_SHARED() \
@@ -4659,10 +5013,10 @@ restart_execution:
 		return; \
 	} while (0)
 #if defined(DUK_USE_EXEC_PREFER_SIZE)
-		case DUK_OP_RETREG:
-		case DUK_OP_RETCONST:
-		case DUK_OP_RETCONSTN:
-		case DUK_OP_RETUNDEF: {
+		DUK__OPCASE(RETREG):
+		DUK__OPCASE(RETCONST):
+		DUK__OPCASE(RETCONSTN):
+		DUK__OPCASE(RETUNDEF): {
 			/* BC -> return value reg/const */
 
 			DUK__SYNC_AND_NULL_CURR_PC();
@@ -4680,7 +5034,7 @@ restart_execution:
 			DUK__RETURN_SHARED();
 		}
 #else /* DUK_USE_EXEC_PREFER_SIZE */
-		case DUK_OP_RETREG: {
+		DUK__OPCASE(RETREG): {
 			duk_tval *tv;
 
 			DUK__SYNC_AND_NULL_CURR_PC();
@@ -4689,7 +5043,7 @@ restart_execution:
 			DUK__RETURN_SHARED();
 		}
 		/* This will be unused without refcounting. */
-		case DUK_OP_RETCONST: {
+		DUK__OPCASE(RETCONST): {
 			duk_tval *tv;
 
 			DUK__SYNC_AND_NULL_CURR_PC();
@@ -4697,7 +5051,7 @@ restart_execution:
 			duk_push_tval_unsafe(thr, tv);
 			DUK__RETURN_SHARED();
 		}
-		case DUK_OP_RETCONSTN: {
+		DUK__OPCASE(RETCONSTN): {
 			duk_tval *tv;
 
 			DUK__SYNC_AND_NULL_CURR_PC();
@@ -4709,7 +5063,7 @@ restart_execution:
 			duk_push_tval_unsafe_noincref(thr, tv);
 			DUK__RETURN_SHARED();
 		}
-		case DUK_OP_RETUNDEF: {
+		DUK__OPCASE(RETUNDEF): {
 			DUK__SYNC_AND_NULL_CURR_PC();
 			DUK_ASSERT(DUK_TVAL_IS_UNDEFINED(thr->valstack_top));
 			duk_push_undefined_unsafe(thr);
@@ -4717,7 +5071,7 @@ restart_execution:
 		}
 #endif /* DUK_USE_EXEC_PREFER_SIZE */
 
-		case DUK_OP_LABEL: {
+		DUK__OPCASE(LABEL): {
 			duk_activation *act;
 			duk_catcher *cat;
 			duk_small_uint_fast_t bc = DUK_DEC_BC(ins);
@@ -4746,10 +5100,10 @@ restart_execution:
 			                     (long) DUK_CAT_GET_LABEL(cat)));
 
 			curr_pc += 2; /* skip jump slots */
-			break;
+			DUK__NEXT();
 		}
 
-		case DUK_OP_ENDLABEL: {
+		DUK__OPCASE(ENDLABEL): {
 			duk_activation *act;
 #if (defined(DUK_USE_DEBUG_LEVEL) && (DUK_USE_DEBUG_LEVEL >= 2)) || defined(DUK_USE_ASSERTIONS)
 			duk_small_uint_fast_t bc = DUK_DEC_BC(ins);
@@ -4765,10 +5119,10 @@ restart_execution:
 			duk_hthread_catcher_unwind_nolexenv_norz(thr, act);
 
 			/* no need to unwind callstack */
-			break;
+			DUK__NEXT();
 		}
 
-		case DUK_OP_BREAK: {
+		DUK__OPCASE(BREAK): {
 			duk_small_uint_fast_t bc = DUK_DEC_BC(ins);
 
 			DUK__SYNC_AND_NULL_CURR_PC();
@@ -4776,7 +5130,7 @@ restart_execution:
 			goto restart_execution;
 		}
 
-		case DUK_OP_CONTINUE: {
+		DUK__OPCASE(CONTINUE): {
 			duk_small_uint_fast_t bc = DUK_DEC_BC(ins);
 
 			DUK__SYNC_AND_NULL_CURR_PC();
@@ -4785,23 +5139,23 @@ restart_execution:
 		}
 
 		/* XXX: move to helper, too large to be inline here */
-		case DUK_OP_TRYCATCH: {
+		DUK__OPCASE(TRYCATCH): {
 			duk__handle_op_trycatch(thr, ins, curr_pc);
 			curr_pc += 2; /* skip jump slots */
-			break;
+			DUK__NEXT();
 		}
 
-		case DUK_OP_ENDTRY: {
+		DUK__OPCASE(ENDTRY): {
 			curr_pc = duk__handle_op_endtry(thr, ins);
-			break;
+			DUK__NEXT();
 		}
 
-		case DUK_OP_ENDCATCH: {
+		DUK__OPCASE(ENDCATCH): {
 			duk__handle_op_endcatch(thr, ins);
-			break;
+			DUK__NEXT();
 		}
 
-		case DUK_OP_ENDFIN: {
+		DUK__OPCASE(ENDFIN): {
 			/* Sync and NULL early. */
 			DUK__SYNC_AND_NULL_CURR_PC();
 
@@ -4813,7 +5167,7 @@ restart_execution:
 			goto restart_execution;
 		}
 
-		case DUK_OP_THROW: {
+		DUK__OPCASE(THROW): {
 			duk_small_uint_fast_t bc = DUK_DEC_BC(ins);
 
 			/* Note: errors are augmented when they are created, not
@@ -4844,10 +5198,10 @@ restart_execution:
 			DUK_ASSERT(thr->heap->lj.jmpbuf_ptr != NULL); /* always in executor */
 			duk_err_longjmp(thr);
 			DUK_UNREACHABLE();
-			break;
+			DUK__NEXT();
 		}
 
-		case DUK_OP_CSREG: {
+		DUK__OPCASE(CSREG): {
 			/*
 			 *  Assuming a register binds to a variable declared within this
 			 *  function (a declarative binding), the 'this' for the call
@@ -4882,7 +5236,7 @@ restart_execution:
 			DUK_TVAL_DECREF(thr, &tv_tmp1);
 			DUK_TVAL_DECREF(thr, &tv_tmp2);
 #endif
-			break;
+			DUK__NEXT();
 		}
 
 			/* XXX: in some cases it's faster NOT to reuse the value
@@ -4891,14 +5245,14 @@ restart_execution:
 			 * stack resize would be large).
 			 */
 
-		case DUK_OP_CALL0:
-		case DUK_OP_CALL1:
-		case DUK_OP_CALL2:
-		case DUK_OP_CALL3:
-		case DUK_OP_CALL4:
-		case DUK_OP_CALL5:
-		case DUK_OP_CALL6:
-		case DUK_OP_CALL7: {
+		DUK__OPCASE(CALL0):
+		DUK__OPCASE(CALL1):
+		DUK__OPCASE(CALL2):
+		DUK__OPCASE(CALL3):
+		DUK__OPCASE(CALL4):
+		DUK__OPCASE(CALL5):
+		DUK__OPCASE(CALL6):
+		DUK__OPCASE(CALL7): {
 			/* Opcode packs 4 flag bits: 1 for indirect, 3 map
 			 * 1:1 to three lowest call handling flags.
 			 *
@@ -4942,17 +5296,17 @@ restart_execution:
 			 * status after returning.  This is now handled by call handling
 			 * and heap->dbg_force_restart.
 			 */
-			break;
+			DUK__NEXT();
 		}
 
-		case DUK_OP_CALL8:
-		case DUK_OP_CALL9:
-		case DUK_OP_CALL10:
-		case DUK_OP_CALL11:
-		case DUK_OP_CALL12:
-		case DUK_OP_CALL13:
-		case DUK_OP_CALL14:
-		case DUK_OP_CALL15: {
+		DUK__OPCASE(CALL8):
+		DUK__OPCASE(CALL9):
+		DUK__OPCASE(CALL10):
+		DUK__OPCASE(CALL11):
+		DUK__OPCASE(CALL12):
+		DUK__OPCASE(CALL13):
+		DUK__OPCASE(CALL14):
+		DUK__OPCASE(CALL15): {
 			/* Indirect variant. */
 			duk_uint_fast_t nargs;
 			duk_idx_t idx;
@@ -4979,10 +5333,10 @@ restart_execution:
 			fun = DUK__FUN();
 #endif
 			duk_set_top_unsafe(thr, (duk_idx_t) fun->nregs);
-			break;
+			DUK__NEXT();
 		}
 
-		case DUK_OP_NEWOBJ: {
+		DUK__OPCASE(NEWOBJ): {
 			duk_push_object(thr);
 #if defined(DUK_USE_ASSERTIONS)
 			{
@@ -4993,6 +5347,10 @@ restart_execution:
 				DUK_ASSERT(duk_hobject_get_hsize(thr->heap, h) == 0);
 			}
 #endif
+#if defined(DUK_USE_HOBJECT_SHAPES)
+			/* Object literals and default instances share layouts. */
+			duk_hobject_init_shape(thr, duk_known_hobject(thr, -1));
+#endif
 #if !defined(DUK_USE_PREFER_SIZE)
 			/* Best guess is that properties will be string properties
 			 * (not index properties).  This could be improved if compiler
@@ -5003,7 +5361,7 @@ restart_execution:
 			DUK__REPLACE_TOP_BC_BREAK();
 		}
 
-		case DUK_OP_NEWARR: {
+		DUK__OPCASE(NEWARR): {
 			duk_small_uint_t arrsize = DUK_DEC_A(ins);
 			duk_harray *h_arr;
 
@@ -5021,8 +5379,8 @@ restart_execution:
 			DUK__REPLACE_TOP_BC_BREAK();
 		}
 
-		case DUK_OP_MPUTOBJ:
-		case DUK_OP_MPUTOBJI: {
+		DUK__OPCASE(MPUTOBJ):
+		DUK__OPCASE(MPUTOBJI): {
 			duk_idx_t obj_idx;
 			duk_uint_fast_t idx, idx_end;
 			duk_small_uint_fast_t count;
@@ -5072,17 +5430,17 @@ restart_execution:
 				                 DUK_DEFPROP_SET_ENUMERABLE | DUK_DEFPROP_SET_CONFIGURABLE);
 				idx += 2;
 			} while (idx < idx_end);
-			break;
+			DUK__NEXT();
 		}
 
-		case DUK_OP_INITSET:
-		case DUK_OP_INITGET: {
+		DUK__OPCASE(INITSET):
+		DUK__OPCASE(INITGET): {
 			duk__handle_op_initset_initget(thr, ins);
-			break;
+			DUK__NEXT();
 		}
 
-		case DUK_OP_MPUTARR:
-		case DUK_OP_MPUTARRI: {
+		DUK__OPCASE(MPUTARR):
+		DUK__OPCASE(MPUTARRI): {
 			duk_idx_t obj_idx;
 			duk_uint_fast_t idx, idx_end;
 			duk_small_uint_fast_t count;
@@ -5138,10 +5496,10 @@ restart_execution:
 				arr_idx++;
 			} while (idx < idx_end);
 
-			break;
+			DUK__NEXT();
 		}
 
-		case DUK_OP_SETALEN: {
+		DUK__OPCASE(SETALEN): {
 			duk_tval *tv1;
 			duk_hobject *h;
 			duk_uint32_t len;
@@ -5163,26 +5521,26 @@ restart_execution:
 			DUK_ASSERT(len >= DUK_HARRAY_GET_LENGTH((duk_harray *) h));
 			DUK_HARRAY_SET_LENGTH((duk_harray *) h, len);
 			DUK_HARRAY_ASSERT_VALID(thr->heap, (duk_harray *) h);
-			break;
+			DUK__NEXT();
 		}
 
-		case DUK_OP_INITENUM: {
+		DUK__OPCASE(INITENUM): {
 			duk__handle_op_initenum(thr, ins);
-			break;
+			DUK__NEXT();
 		}
 
-		case DUK_OP_NEXTENUM: {
+		DUK__OPCASE(NEXTENUM): {
 			curr_pc += duk__handle_op_nextenum(thr, ins);
-			break;
+			DUK__NEXT();
 		}
 
-		case DUK_OP_INVLHS: {
+		DUK__OPCASE(INVLHS): {
 			DUK_ERROR_REFERENCE(thr, DUK_STR_INVALID_LVALUE);
 			DUK_WO_NORETURN(return;);
-			break;
+			DUK__NEXT();
 		}
 
-		case DUK_OP_DEBUGGER: {
+		DUK__OPCASE(DEBUGGER): {
 			/* Opcode only emitted by compiler when debugger
 			 * support is enabled.  Ignore it silently without
 			 * debugger support, in case it has been loaded
@@ -5201,24 +5559,24 @@ restart_execution:
 #else
 			DUK_D(DUK_DPRINT("DEBUGGER statement ignored, no debugger support"));
 #endif
-			break;
+			DUK__NEXT();
 		}
 
-		case DUK_OP_NOP: {
+		DUK__OPCASE(NOP): {
 			/* Nop, ignored, but ABC fields may carry a value e.g.
 			 * for indirect opcode handling.
 			 */
-			break;
+			DUK__NEXT();
 		}
 
-		case DUK_OP_INVALID: {
+		DUK__OPCASE(INVALID): {
 			DUK_ERROR_FMT1(thr, DUK_ERR_ERROR, "INVALID opcode (%ld)", (long) DUK_DEC_ABC(ins));
 			DUK_WO_NORETURN(return;);
-			break;
+			DUK__NEXT();
 		}
 
 #if defined(DUK_USE_ES6)
-		case DUK_OP_NEWTARGET: {
+		DUK__OPCASE(NEWTARGET): {
 			duk_push_new_target(thr);
 			DUK__REPLACE_TOP_BC_BREAK();
 		}
@@ -5226,67 +5584,49 @@ restart_execution:
 
 #if !defined(DUK_USE_EXEC_PREFER_SIZE)
 #if !defined(DUK_USE_ES7_EXP_OPERATOR)
-		case DUK_OP_EXP_RR:
-		case DUK_OP_EXP_CR:
-		case DUK_OP_EXP_RC:
-		case DUK_OP_EXP_CC:
+		DUK__OPCASE(EXP_RR):
+		DUK__OPCASE(EXP_CR):
+		DUK__OPCASE(EXP_RC):
+		DUK__OPCASE(EXP_CC):
 #endif
 #if !defined(DUK_USE_ES6)
-		case DUK_OP_NEWTARGET:
+		DUK__OPCASE(NEWTARGET):
 #endif
 #if !defined(DUK_USE_VERBOSE_ERRORS)
-		case DUK_OP_GETPROPC_RR:
-		case DUK_OP_GETPROPC_RC:
+		DUK__OPCASE(GETPROPC_RR):
+		DUK__OPCASE(GETPROPC_RC):
 #if 0
-		case DUK_OP_GETPROPC_CR:
-		case DUK_OP_GETPROPC_CC:
+		DUK__OPCASE(GETPROPC_CR):
+		DUK__OPCASE(GETPROPC_CC):
 #endif
 #endif
-		case DUK_OP_UNUSED207:
-		case DUK_OP_UNUSED212:
-		case DUK_OP_UNUSED213:
-		case DUK_OP_UNUSED214:
-		case DUK_OP_UNUSED215:
-		case DUK_OP_UNUSED216:
-		case DUK_OP_UNUSED217:
-		case DUK_OP_UNUSED218:
-		case DUK_OP_UNUSED219:
-		case DUK_OP_UNUSED220:
-		case DUK_OP_UNUSED221:
-		case DUK_OP_UNUSED222:
-		case DUK_OP_UNUSED223:
-		case DUK_OP_UNUSED224:
-		case DUK_OP_UNUSED225:
-		case DUK_OP_UNUSED226:
-		case DUK_OP_UNUSED227:
-		case DUK_OP_UNUSED228:
-		case DUK_OP_UNUSED229:
-		case DUK_OP_UNUSED230:
-		case DUK_OP_UNUSED231:
-		case DUK_OP_UNUSED232:
-		case DUK_OP_UNUSED233:
-		case DUK_OP_UNUSED234:
-		case DUK_OP_UNUSED235:
-		case DUK_OP_UNUSED236:
-		case DUK_OP_UNUSED237:
-		case DUK_OP_UNUSED238:
-		case DUK_OP_UNUSED239:
-		case DUK_OP_UNUSED240:
-		case DUK_OP_UNUSED241:
-		case DUK_OP_UNUSED242:
-		case DUK_OP_UNUSED243:
-		case DUK_OP_UNUSED244:
-		case DUK_OP_UNUSED245:
-		case DUK_OP_UNUSED246:
-		case DUK_OP_UNUSED247:
-		case DUK_OP_UNUSED248:
-		case DUK_OP_UNUSED249:
-		case DUK_OP_UNUSED250:
-		case DUK_OP_UNUSED251:
-		case DUK_OP_UNUSED252:
-		case DUK_OP_UNUSED253:
-		case DUK_OP_UNUSED254:
-		case DUK_OP_UNUSED255:
+		DUK__OPCASE(GETPROP_CR_UNUSED):
+		DUK__OPCASE(GETPROP_CC_UNUSED):
+		DUK__OPCASE(DELPROP_CR_UNUSED):
+		DUK__OPCASE(DELPROP_CC_UNUSED):
+		DUK__OPCASE(UNUSED207):
+		DUK__OPCASE(GETPROPC_CR_UNUSED):
+		DUK__OPCASE(GETPROPC_CC_UNUSED):
+		DUK__OPCASE(UNUSED236):
+		DUK__OPCASE(UNUSED237):
+		DUK__OPCASE(UNUSED238):
+		DUK__OPCASE(UNUSED239):
+		DUK__OPCASE(UNUSED240):
+		DUK__OPCASE(UNUSED241):
+		DUK__OPCASE(UNUSED242):
+		DUK__OPCASE(UNUSED243):
+		DUK__OPCASE(UNUSED244):
+		DUK__OPCASE(UNUSED245):
+		DUK__OPCASE(UNUSED246):
+		DUK__OPCASE(UNUSED247):
+		DUK__OPCASE(UNUSED248):
+		DUK__OPCASE(UNUSED249):
+		DUK__OPCASE(UNUSED250):
+		DUK__OPCASE(UNUSED251):
+		DUK__OPCASE(UNUSED252):
+		DUK__OPCASE(UNUSED253):
+		DUK__OPCASE(UNUSED254):
+		DUK__OPCASE(UNUSED255):
 			/* Force all case clauses to map to an actual handler
 			 * so that the compiler can emit a jump without a bounds
 			 * check: the switch argument is a duk_uint8_t so that
@@ -5301,7 +5641,7 @@ restart_execution:
 			/* Default case catches invalid/unsupported opcodes. */
 			DUK_D(DUK_DPRINT("invalid opcode: %ld - %!I", (long) op, ins));
 			DUK__INTERNAL_ERROR("invalid opcode");
-			break;
+			DUK__NEXT();
 		}
 
 		} /* end switch */
@@ -5331,3 +5671,10 @@ internal_error:
 	DUK_WO_NORETURN(return;);
 #endif
 }
+#if defined(DUK_USE_EXEC_COMPUTED_GOTO)
+#if defined(DUK_USE_GCC_PRAGMAS)
+#pragma GCC diagnostic pop
+#elif defined(DUK_USE_CLANG_PRAGMAS)
+#pragma clang diagnostic pop
+#endif
+#endif
@@ -186,8 +186,11 @@ void duk_js_push_closure(duk_hthread *thr,
 	 * separately if necessary.
 	 */
 
-	/* DUK_HEAPHDR_SET_FLAGS() masks changes to non-duk_heaphdr flags only. */
-	DUK_HEAPHDR_SET_FLAGS((duk_heaphdr *) fun_clos, DUK_HEAPHDR_GET_FLAGS_RAW((duk_heaphdr *) fun_temp));
+	/* Mask out duk_heaphdr owned flags: with DUK_USE_GENERATIONAL_GC
+	 * the template may have a sticky REACHABLE flag.
+	 */
+	DUK_HEAPHDR_SET_FLAGS((duk_heaphdr *) fun_clos,
+	                      DUK_HEAPHDR_GET_FLAGS_RAW((duk_heaphdr *) fun_temp) & DUK_HEAPHDR_FLAGS_USER_MASK);
 	DUK_DD(DUK_DDPRINT("fun_temp heaphdr flags: 0x%08lx, fun_clos heaphdr flags: 0x%08lx",
 	                   (unsigned long) DUK_HEAPHDR_GET_FLAGS_RAW((duk_heaphdr *) fun_temp),
 	                   (unsigned long) DUK_HEAPHDR_GET_FLAGS_RAW((duk_heaphdr *) fun_clos)));
@@ -0,0 +1,272 @@
+/*
+ *  Sampling profiler
+ *
+ *  Samples are taken from the executor interrupt every 'prof_interval'
+ *  executed bytecode instructions.  Each sample resolves the call stack
+ *  into a collapsed stack string, one "name (file:line)" frame per
+ *  activation, outermost first and separated by ';'.  Stack strings are
+ *  counted in a bare object so that nothing refers back to the functions
+ *  involved.  The opcode about to be executed is counted separately.
+ *
+ *  Because sampling is driven by the instruction counter, time spent in
+ *  native code is attributed only through the bytecode which called it.
+ */
+
+#include "duk_internal.h"
+
+#if defined(DUK_USE_DEBUG) || defined(DUK_USE_PROFILER)
+/* Opcode names for debug prints and profiler dumps, must match bytecode
+ * defines now; build autogenerate?
+ */
+DUK_INTERNAL const char * const duk_bc_opcode_names[256] = {
+	"LDREG",       "STREG",       "JUMP",        "LDCONST",     "LDINT",       "LDINTX",      "LDTHIS",      "LDUNDEF",
+	"LDNULL",      "LDTRUE",      "LDFALSE",     "GETVAR",      "BNOT",        "LNOT",        "UNM",         "UNP",
+	"EQ_RR",       "EQ_CR",       "EQ_RC",       "EQ_CC",       "NEQ_RR",      "NEQ_CR",      "NEQ_RC",      "NEQ_CC",
+	"SEQ_RR",      "SEQ_CR",      "SEQ_RC",      "SEQ_CC",      "SNEQ_RR",     "SNEQ_CR",     "SNEQ_RC",     "SNEQ_CC",
+
+	"GT_RR",       "GT_CR",       "GT_RC",       "GT_CC",       "GE_RR",       "GE_CR",       "GE_RC",       "GE_CC",
+	"LT_RR",       "LT_CR",       "LT_RC",       "LT_CC",       "LE_RR",       "LE_CR",       "LE_RC",       "LE_CC",
+	"IFTRUE_R",    "IFTRUE_C",    "IFFALSE_R",   "IFFALSE_C",   "ADD_RR",      "ADD_CR",      "ADD_RC",      "ADD_CC",
+	"SUB_RR",      "SUB_CR",      "SUB_RC",      "SUB_CC",      "MUL_RR",      "MUL_CR",      "MUL_RC",      "MUL_CC",
+
+	"DIV_RR",      "DIV_CR",      "DIV_RC",      "DIV_CC",      "MOD_RR",      "MOD_CR",      "MOD_RC",      "MOD_CC",
+	"EXP_RR",      "EXP_CR",      "EXP_RC",      "EXP_CC",      "BAND_RR",     "BAND_CR",     "BAND_RC",     "BAND_CC",
+	"BOR_RR",      "BOR_CR",      "BOR_RC",      "BOR_CC",      "BXOR_RR",     "BXOR_CR",     "BXOR_RC",     "BXOR_CC",
+	"BASL_RR",     "BASL_CR",     "BASL_RC",     "BASL_CC",     "BLSR_RR",     "BLSR_CR",     "BLSR_RC",     "BLSR_CC",
+
+	"BASR_RR",     "BASR_CR",     "BASR_RC",     "BASR_CC",     "INSTOF_RR",   "INSTOF_CR",   "INSTOF_RC",   "INSTOF_CC",
+	"IN_RR",       "IN_CR",       "IN_RC",       "IN_CC",       "GETPROP_RR",  "GETPROP_CR",  "GETPROP_RC",  "GETPROP_CC",
+	"PUTPROP_RR",  "PUTPROP_CR",  "PUTPROP_RC",  "PUTPROP_CC",  "DELPROP_RR",  "DELPROP_CR",  "DELPROP_RC",  "DELPROP_CC",
+	"PREINCR",     "PREDECR",     "POSTINCR",    "POSTDECR",    "PREINCV",     "PREDECV",     "POSTINCV",    "POSTDECV",
+
+	"PREINCP_RR",  "PREINCP_CR",  "PREINCP_RC",  "PREINCP_CC",  "PREDECP_RR",  "PREDECP_CR",  "PREDECP_RC",  "PREDECP_CC",
+	"POSTINCP_RR", "POSTINCP_CR", "POSTINCP_RC", "POSTINCP_CC", "POSTDECP_RR", "POSTDECP_CR", "POSTDECP_RC", "POSTDECP_CC",
+	"DECLVAR_RR",  "DECLVAR_CR",  "DECLVAR_RC",  "DECLVAR_CC",  "REGEXP_RR",   "REGEXP_RC",   "REGEXP_CR",   "REGEXP_CC",
+	"CLOSURE",     "TYPEOF",      "TYPEOFID",    "PUTVAR",      "DELVAR",      "RETREG",      "RETUNDEF",    "RETCONST",
+
+	"RETCONSTN",   "LABEL",       "ENDLABEL",    "BREAK",       "CONTINUE",    "TRYCATCH",    "ENDTRY",      "ENDCATCH",
+	"ENDFIN",      "THROW",       "INVLHS",      "CSREG",       "CSVAR_RR",    "CSVAR_CR",    "CSVAR_RC",    "CSVAR_CC",
+	"CALL0",       "CALL1",       "CALL2",       "CALL3",       "CALL4",       "CALL5",       "CALL6",       "CALL7",
+	"CALL8",       "CALL9",       "CALL10",      "CALL11",      "CALL12",      "CALL13",      "CALL14",      "CALL15",
+
+	"NEWOBJ",      "NEWARR",      "MPUTOBJ",     "MPUTOBJI",    "INITSET",     "INITGET",     "MPUTARR",     "MPUTARRI",
+	"SETALEN",     "INITENUM",    "NEXTENUM",    "NEWTARGET",   "DEBUGGER",    "NOP",         "INVALID",     "UNUSED207",
+	"GETPROPC_RR", "GETPROPC_CR", "GETPROPC_RC", "GETPROPC_CC", "IFLT_RR",     "IFLT_CR",     "IFLT_RC",     "IFLT_CC",
+	"IFLE_RR",     "IFLE_CR",     "IFLE_RC",     "IFLE_CC",     "IFGT_RR",     "IFGT_CR",     "IFGT_RC",     "IFGT_CC",
+
+	"IFGE_RR",     "IFGE_CR",     "IFGE_RC",     "IFGE_CC",     "IFSEQ_RR",    "IFSEQ_CR",    "IFSEQ_RC",    "IFSEQ_CC",
+	"IFEQ_RR",     "IFEQ_CR",     "IFEQ_RC",     "IFEQ_CC",     "UNUSED236",   "UNUSED237",   "UNUSED238",   "UNUSED239",
+	"UNUSED240",   "UNUSED241",   "UNUSED242",   "UNUSED243",   "UNUSED244",   "UNUSED245",   "UNUSED246",   "UNUSED247",
+	"UNUSED248",   "UNUSED249",   "UNUSED250",   "UNUSED251",   "UNUSED252",   "UNUSED253",   "UNUSED254",   "UNUSED255"
+};
+#endif /* DUK_USE_DEBUG || DUK_USE_PROFILER */
+
+#if defined(DUK_USE_PROFILER)
+
+/* Write string data, replacing characters which would break the collapsed
+ * stack format.  The replaced characters never occur inside UTF-8/CESU-8
+ * multibyte sequences.
+ */
+DUK_LOCAL void duk__prof_write_hstring(duk_hthread *thr, duk_bufwriter_ctx *bw, duk_hstring *h) {
+	duk_uint8_t *p;
+	duk_uint8_t *p_end;
+	duk_size_t off;
+
+	off = DUK_BW_GET_SIZE(thr, bw);
+	DUK_BW_WRITE_ENSURE_HSTRING(thr, bw, h);
+	p = DUK_BW_GET_BASEPTR(thr, bw) + off;
+	p_end = DUK_BW_GET_PTR(thr, bw);
+	while (p < p_end) {
+		if (*p == (duk_uint8_t) ';' || *p == (duk_uint8_t) '\n' || *p == (duk_uint8_t) '\r') {
+			*p = (duk_uint8_t) '_';
+		}
+		p++;
+	}
+}
+
+DUK_LOCAL void duk__prof_write_frame(duk_hthread *thr, duk_bufwriter_ctx *bw, duk_hthread *act_thr, duk_activation *act) {
+	duk_hobject *func;
+	duk_hstring *h;
+	duk_uint_fast32_t pc;
+	duk_uint_fast32_t line;
+	char buf[32];
+
+	func = act->func;
+	if (func == NULL) {
+		DUK_BW_WRITE_ENSURE_CSTRING(thr, bw, "lightfunc (native)");
+		return;
+	}
+
+	/* Own data properties only, so no side effects.  If the property
+	 * is missing, the key is left on the value stack instead.
+	 */
+	duk_push_hobject(thr, func);
+	h = NULL;
+	if (duk_xget_owndataprop_stridx_short(thr, -1, DUK_STRIDX_NAME)) {
+		h = duk_get_hstring(thr, -1);
+	}
+	if (h != NULL && duk_hstring_get_bytelen(h) > 0 && !DUK_HSTRING_HAS_SYMBOL(h)) {
+		duk__prof_write_hstring(thr, bw, h);
+	} else {
+		DUK_BW_WRITE_ENSURE_CSTRING(thr, bw, "anon");
+	}
+	duk_pop(thr);
+
+	if (DUK_HOBJECT_IS_COMPFUNC(func)) {
+		DUK_BW_WRITE_ENSURE_CSTRING(thr, bw, " (");
+		h = NULL;
+		if (duk_xget_owndataprop_stridx_short(thr, -1, DUK_STRIDX_FILE_NAME)) {
+			h = duk_get_hstring(thr, -1);
+		}
+		if (h != NULL && !DUK_HSTRING_HAS_SYMBOL(h)) {
+			duk__prof_write_hstring(thr, bw, h);
+		}
+		duk_pop(thr);
+
+		/* The innermost activation is about to execute the instruction
+		 * at curr_pc, callers are still executing the call at curr_pc-1.
+		 */
+		if (act == act_thr->callstack_curr) {
+			pc = duk_hthread_get_act_curr_pc(act_thr, act);
+		} else {
+			pc = duk_hthread_get_act_prev_pc(act_thr, act);
+		}
+#if defined(DUK_USE_PC2LINE)
+		line = duk_hobject_pc2line_query(thr, -1, pc);
+#else
+		line = 0;
+#endif
+		DUK_UNREF(pc);
+		DUK_SNPRINTF(buf, sizeof(buf), ":%lu)", (unsigned long) line);
+		buf[sizeof(buf) - 1] = (char) 0;
+		DUK_BW_WRITE_ENSURE_CSTRING(thr, bw, buf);
+	} else {
+		DUK_BW_WRITE_ENSURE_CSTRING(thr, bw, " (native)");
+	}
+	duk_pop(thr);
+}
+
+DUK_LOCAL duk_ret_t duk__profiler_sample_raw(duk_hthread *thr, void *udata) {
+	duk_heap *heap;
+	duk_hthread *act_thrs[DUK_PROFILER_MAX_DEPTH];
+	duk_activation *acts[DUK_PROFILER_MAX_DEPTH];
+	duk_hthread *curr_thr;
+	duk_activation *act;
+	duk_small_uint_t n = 0;
+	duk_bool_t truncated = 0;
+	duk_bufwriter_ctx bw_alloc;
+	duk_bufwriter_ctx *bw = &bw_alloc;
+	duk_uint_t count;
+
+	DUK_ASSERT(thr != NULL);
+	DUK_UNREF(udata);
+	heap = thr->heap;
+	DUK_ASSERT(heap->prof_stacks != NULL);
+
+	/* Innermost frames first, including threads which resumed us. */
+	for (curr_thr = thr; curr_thr != NULL; curr_thr = curr_thr->resumer) {
+		for (act = curr_thr->callstack_curr; act != NULL; act = act->parent) {
+			if (n >= DUK_PROFILER_MAX_DEPTH) {
+				truncated = 1;
+				break;
+			}
+			act_thrs[n] = curr_thr;
+			acts[n] = act;
+			n++;
+		}
+	}
+
+	DUK_BW_INIT_PUSHBUF(thr, bw, 128);
+	if (truncated) {
+		DUK_BW_WRITE_ENSURE_CSTRING(thr, bw, "...");
+	}
+	while (n > 0) {
+		n--;
+		if (truncated || DUK_BW_GET_SIZE(thr, bw) > 0) {
+			DUK_BW_WRITE_ENSURE_U8(thr, bw, (duk_uint8_t) ';');
+		}
+		duk__prof_write_frame(thr, bw, act_thrs[n], acts[n]);
+	}
+
+	duk_push_hobject(thr, heap->prof_stacks);
+	DUK_BW_PUSH_AS_STRING(thr, bw); /* [ ... buf stacks key ] */
+	duk_dup_top(thr);
+	duk_get_prop(thr, -3);
+	count = duk_get_uint_default(thr, -1, 0);
+	duk_pop(thr);
+	duk_push_uint(thr, count + 1);
+	duk_put_prop(thr, -3);
+	duk_pop_2(thr);
+	return 0;
+}
+
+DUK_INTERNAL void duk_profiler_sample(duk_hthread *thr) {
+	duk_activation *act;
+
+	DUK_ASSERT(thr != NULL);
+	DUK_ASSERT(thr->heap->prof_interval > 0);
+
+	act = thr->callstack_curr;
+	DUK_ASSERT(act != NULL);
+	DUK_ASSERT(act->func != NULL && DUK_HOBJECT_IS_COMPFUNC(act->func));
+	thr->heap->prof_opcodes[DUK_DEC_OP(*act->curr_pc)]++;
+
+	/* Called from the executor interrupt so errors (out of memory) must
+	 * not propagate: the sample is just dropped.
+	 */
+	(void) duk_safe_call(thr, duk__profiler_sample_raw, NULL, 0 /*nargs*/, 0 /*nrets*/);
+}
+
+DUK_INTERNAL void duk_profiler_reset(duk_hthread *thr) {
+	duk_heap *heap;
+	duk_hobject *h_old;
+
+	heap = thr->heap;
+	h_old = heap->prof_stacks;
+	(void) duk_push_bare_object(thr);
+	heap->prof_stacks = duk_known_hobject(thr, -1);
+	DUK_HOBJECT_INCREF(thr, heap->prof_stacks);
+	duk_pop(thr);
+	DUK_HOBJECT_DECREF_ALLOWNULL(thr, h_old); /* side effects */
+	duk_memzero((void *) heap->prof_opcodes, sizeof(heap->prof_opcodes));
+}
+
+DUK_INTERNAL void duk_profiler_push_dump(duk_hthread *thr, duk_uint_t flags) {
+	duk_heap *heap;
+	duk_bufwriter_ctx bw_alloc;
+	duk_bufwriter_ctx *bw = &bw_alloc;
+	char buf[32];
+
+	heap = thr->heap;
+	DUK_BW_INIT_PUSHBUF(thr, bw, 256);
+
+	if (flags & DUK_PROFILER_DUMP_OPCODES) {
+		duk_uint_t i;
+
+		for (i = 0; i < 256; i++) {
+			if (heap->prof_opcodes[i] == 0) {
+				continue;
+			}
+			DUK_BW_WRITE_ENSURE_CSTRING(thr, bw, duk_bc_opcode_names[i]);
+			DUK_SNPRINTF(buf, sizeof(buf), " %lu\n", (unsigned long) heap->prof_opcodes[i]);
+			buf[sizeof(buf) - 1] = (char) 0;
+			DUK_BW_WRITE_ENSURE_CSTRING(thr, bw, buf);
+		}
+	} else if (heap->prof_stacks != NULL) {
+		duk_push_hobject(thr, heap->prof_stacks);
+		duk_enum(thr, -1, DUK_ENUM_OWN_PROPERTIES_ONLY);
+		while (duk_next(thr, -1, 1 /*get_value*/)) {
+			DUK_BW_WRITE_ENSURE_HSTRING(thr, bw, duk_known_hstring(thr, -2));
+			DUK_SNPRINTF(buf, sizeof(buf), " %lu\n", (unsigned long) duk_get_uint(thr, -1));
+			buf[sizeof(buf) - 1] = (char) 0;
+			DUK_BW_WRITE_ENSURE_CSTRING(thr, bw, buf);
+			duk_pop_2(thr);
+		}
+		duk_pop_2(thr);
+	}
+
+	DUK_BW_PUSH_AS_STRING(thr, bw);
+	duk_remove_m2(thr);
+}
+
+#endif /* DUK_USE_PROFILER */
@@ -0,0 +1,24 @@
+/*
+ *  Sampling profiler
+ */
+
+#if !defined(DUK_PROFILER_H_INCLUDED)
+#define DUK_PROFILER_H_INCLUDED
+
+/* Default sampling interval in executed bytecode instructions. */
+#define DUK_PROFILER_DEFAULT_INTERVAL 1000L
+
+/* Maximum number of innermost call stack frames recorded per sample. */
+#define DUK_PROFILER_MAX_DEPTH 64
+
+#if defined(DUK_USE_DEBUG) || defined(DUK_USE_PROFILER)
+DUK_INTERNAL_DECL const char * const duk_bc_opcode_names[256];
+#endif
+
+#if defined(DUK_USE_PROFILER)
+DUK_INTERNAL_DECL void duk_profiler_sample(duk_hthread *thr);
+DUK_INTERNAL_DECL void duk_profiler_reset(duk_hthread *thr);
+DUK_INTERNAL_DECL void duk_profiler_push_dump(duk_hthread *thr, duk_uint_t flags);
+#endif /* DUK_USE_PROFILER */
+
+#endif /* DUK_PROFILER_H_INCLUDED */
@@ -49,6 +49,20 @@ duk_prop_putvalue_strkey_inidx(duk_hthread *thr, duk_idx_t idx_recv, duk_hstring
 DUK_INTERNAL_DECL duk_bool_t
 duk_prop_putvalue_idxkey_inidx(duk_hthread *thr, duk_idx_t idx_recv, duk_uarridx_t idx, duk_idx_t idx_val, duk_bool_t throw_flag);
 
+#if defined(DUK_USE_INLINE_CACHE_SIZE)
+DUK_INTERNAL_DECL duk_bool_t duk_prop_icache_getvalue_strkey_outidx(duk_hthread *thr,
+                                                                    duk_idx_t idx_recv,
+                                                                    duk_hstring *key,
+                                                                    duk_idx_t idx_out,
+                                                                    const duk_instr_t *pc);
+DUK_INTERNAL_DECL duk_bool_t duk_prop_icache_putvalue_strkey_inidx(duk_hthread *thr,
+                                                                   duk_idx_t idx_recv,
+                                                                   duk_hstring *key,
+                                                                   duk_idx_t idx_val,
+                                                                   duk_bool_t throw_flag,
+                                                                   const duk_instr_t *pc);
+#endif
+
 DUK_INTERNAL_DECL duk_bool_t duk_prop_deleteoper(duk_hthread *thr, duk_idx_t idx_obj, duk_tval *tv_key, duk_bool_t throw_flag);
 DUK_INTERNAL_DECL duk_bool_t duk_prop_delete_strkey(duk_hthread *thr, duk_idx_t idx_obj, duk_hstring *key, duk_bool_t throw_flag);
 DUK_INTERNAL_DECL duk_bool_t duk_prop_delete_obj_strkey(duk_hthread *thr,
@@ -151,17 +151,34 @@ DUK_LOCAL duk_bool_t duk__prop_validate_immutable_data_desc(duk_uint_t immutable
 	return 1;
 }
 
-/* Create new accessor or data property.  Missing attributes default to false,
- * so we can just ignore the HAVE mask (any attribute with no HAVE bit MUST
- * be zero).
+/* Attributes for a new accessor or data property.  Missing attributes
+ * default to false, so we can just ignore the HAVE mask (any attribute with
+ * no HAVE bit MUST be zero).
  */
-DUK_LOCAL duk_bool_t duk__prop_defown_write_new_slot(duk_hthread *thr,
-                                                     duk_idx_t idx_desc,
-                                                     duk_uint_t defprop_flags,
-                                                     duk_propvalue *pv_slot,
-                                                     duk_uint8_t *attr_slot) {
+DUK_LOCAL duk_uint8_t duk__prop_defown_new_slot_attrs(duk_uint_t defprop_flags) {
+	if (DUK_UNLIKELY(defprop_flags & (DUK_DEFPROP_HAVE_GETTER | DUK_DEFPROP_HAVE_SETTER))) {
+		return (duk_uint8_t) ((defprop_flags & DUK_DEFPROP_EC) | DUK_PROPDESC_FLAG_ACCESSOR);
+	} else {
+		/* Default attributes are 'false', overwrite based on
+		 * DUK_DEFPROP_HAVE_xxx flags.
+		 */
+		DUK_ASSERT((DUK_DEFPROP_WRITABLE << DUK_DEFPROP_HAVE_SHIFT_COUNT) == DUK_DEFPROP_HAVE_WRITABLE);
+		DUK_ASSERT((DUK_DEFPROP_ENUMERABLE << DUK_DEFPROP_HAVE_SHIFT_COUNT) == DUK_DEFPROP_HAVE_ENUMERABLE);
+		DUK_ASSERT((DUK_DEFPROP_CONFIGURABLE << DUK_DEFPROP_HAVE_SHIFT_COUNT) == DUK_DEFPROP_HAVE_CONFIGURABLE);
+		DUK_ASSERT((DUK_DEFPROP_WEC & 0x07U) == DUK_DEFPROP_WEC);
+
+		return (duk_uint8_t) ((defprop_flags & (defprop_flags >> DUK_DEFPROP_HAVE_SHIFT_COUNT)) & DUK_DEFPROP_WEC);
+	}
+}
+
+/* Write the value of a new accessor or data property, attributes are
+ * written by the caller.
+ */
+DUK_LOCAL duk_bool_t duk__prop_defown_write_new_value(duk_hthread *thr,
+                                                      duk_idx_t idx_desc,
+                                                      duk_uint_t defprop_flags,
+                                                      duk_propvalue *pv_slot) {
 	if (DUK_UNLIKELY(defprop_flags & (DUK_DEFPROP_HAVE_GETTER | DUK_DEFPROP_HAVE_SETTER))) {
-		*attr_slot = (defprop_flags & DUK_DEFPROP_EC) | DUK_PROPDESC_FLAG_ACCESSOR;
 		if (defprop_flags & DUK_DEFPROP_HAVE_GETTER) {
 			pv_slot->a.get = duk_get_hobject(thr, duk__prop_defown_getter_index(idx_desc, defprop_flags));
 		} else {
@@ -175,18 +192,6 @@ DUK_LOCAL duk_bool_t duk__prop_defown_write_new_slot(duk_hthread *thr,
 		DUK_HOBJECT_INCREF_ALLOWNULL(thr, pv_slot->a.get);
 		DUK_HOBJECT_INCREF_ALLOWNULL(thr, pv_slot->a.set);
 	} else {
-		/* Default attributes are 'false', overwrite based on
-		 * DUK_DEFPROP_HAVE_xxx flags.
-		 */
-		duk_uint8_t new_attrs;
-
-		DUK_ASSERT((DUK_DEFPROP_WRITABLE << DUK_DEFPROP_HAVE_SHIFT_COUNT) == DUK_DEFPROP_HAVE_WRITABLE);
-		DUK_ASSERT((DUK_DEFPROP_ENUMERABLE << DUK_DEFPROP_HAVE_SHIFT_COUNT) == DUK_DEFPROP_HAVE_ENUMERABLE);
-		DUK_ASSERT((DUK_DEFPROP_CONFIGURABLE << DUK_DEFPROP_HAVE_SHIFT_COUNT) == DUK_DEFPROP_HAVE_CONFIGURABLE);
-		DUK_ASSERT((DUK_DEFPROP_WEC & 0x07U) == DUK_DEFPROP_WEC);
-
-		new_attrs = (duk_uint8_t) ((defprop_flags & (defprop_flags >> DUK_DEFPROP_HAVE_SHIFT_COUNT)) & DUK_DEFPROP_WEC);
-		*attr_slot = new_attrs;
 		if (defprop_flags & DUK_DEFPROP_HAVE_VALUE) {
 			duk_tval *tv_src = duk_require_tval(thr, idx_desc);
 			DUK_TVAL_SET_TVAL_INCREF(thr, &pv_slot->v, tv_src);
@@ -198,6 +203,36 @@ DUK_LOCAL duk_bool_t duk__prop_defown_write_new_slot(duk_hthread *thr,
 	return 1;
 }
 
+/* Create new accessor or data property. */
+DUK_LOCAL duk_bool_t duk__prop_defown_write_new_slot(duk_hthread *thr,
+                                                     duk_idx_t idx_desc,
+                                                     duk_uint_t defprop_flags,
+                                                     duk_propvalue *pv_slot,
+                                                     duk_uint8_t *attr_slot) {
+	*attr_slot = duk__prop_defown_new_slot_attrs(defprop_flags);
+	return duk__prop_defown_write_new_value(thr, idx_desc, defprop_flags, pv_slot);
+}
+
+#if defined(DUK_USE_HOBJECT_SHAPES)
+/* Conservative check for whether updating an existing property with
+ * 'defprop_flags' may change its attributes, including conversions between
+ * data and accessor properties.
+ */
+DUK_LOCAL duk_bool_t duk__prop_defown_may_change_attrs(duk_uint_t defprop_flags, duk_uint8_t attrs) {
+	duk_uint_t have_mask;
+
+	have_mask = (defprop_flags >> DUK_DEFPROP_HAVE_SHIFT_COUNT) & DUK_DEFPROP_WEC;
+	if ((defprop_flags ^ (duk_uint_t) attrs) & have_mask) {
+		return 1;
+	}
+	if (attrs & DUK_PROPDESC_FLAG_ACCESSOR) {
+		return (defprop_flags & (DUK_DEFPROP_HAVE_VALUE | DUK_DEFPROP_HAVE_WRITABLE)) != 0;
+	} else {
+		return (defprop_flags & (DUK_DEFPROP_HAVE_GETTER | DUK_DEFPROP_HAVE_SETTER)) != 0;
+	}
+}
+#endif
+
 /* Convert an existing data property into an accessor. */
 DUK_LOCAL duk_bool_t duk__prop_defown_update_convert_to_accessor(duk_hthread *thr,
                                                                  duk_idx_t idx_desc,
@@ -499,25 +534,48 @@ DUK_LOCAL duk_bool_t duk__prop_defown_strkey_ordinary(duk_hthread *thr,
 		pv_slot = val_base + ent_idx;
 		attr_slot = attr_base + ent_idx;
 
+#if defined(DUK_USE_HOBJECT_SHAPES)
+		if (DUK_HOBJECT_HAS_SHAPED(obj)) {
+			/* Attributes live in the shared shape so they can't be
+			 * updated in place.  Values are per object, so the shape
+			 * only needs to be dropped if the attributes may change.
+			 * This must happen before the update because the update
+			 * may have side effects (finalizers) which modify the
+			 * object.
+			 */
+			if (duk__prop_defown_may_change_attrs(defprop_flags, *attr_slot)) {
+				duk_hobject_unshape(thr, obj);
+				duk_hobject_get_strprops_key_attr(thr->heap, obj, &val_base, &key_base, &attr_base);
+				DUK_ASSERT(key_base[ent_idx] == key);
+				pv_slot = val_base + ent_idx;
+				attr_slot = attr_base + ent_idx;
+			} else {
+				duk_uint8_t attrs_copy;
+
+				attrs_copy = *attr_slot;
+				return duk__prop_defown_update_existing_slot(thr, idx_desc, defprop_flags, pv_slot, &attrs_copy);
+			}
+		}
+#endif
+
 		return duk__prop_defown_update_existing_slot(thr, idx_desc, defprop_flags, pv_slot, attr_slot);
 	} else {
 		duk_propvalue *val_base;
-		duk_hstring **key_base;
-		duk_uint8_t *attr_base;
 		duk_propvalue *pv_slot;
-		duk_uint8_t *attr_slot;
 
 		if (DUK_UNLIKELY(!DUK_HOBJECT_HAS_EXTENSIBLE(obj) && !(defprop_flags & DUK_DEFPROP_FORCE))) {
 			goto fail_not_extensible;
 		}
 
-		ent_idx = (duk_uint_fast32_t) duk_hobject_alloc_strentry_checked(thr, obj, key);
-		duk_hobject_get_strprops_key_attr(thr->heap, obj, &val_base, &key_base, &attr_base);
-		DUK_ASSERT(key_base[ent_idx] == key);
+		ent_idx = (duk_uint_fast32_t) duk_hobject_alloc_strentry_checked(thr,
+		                                                                 obj,
+		                                                                 key,
+		                                                                 duk__prop_defown_new_slot_attrs(defprop_flags));
+		val_base = duk_hobject_get_strprops_values(thr->heap, obj);
+		DUK_ASSERT(duk_hobject_get_strprops_keys(thr->heap, obj)[ent_idx] == key);
 		pv_slot = val_base + ent_idx;
-		attr_slot = attr_base + ent_idx;
 
-		return duk__prop_defown_write_new_slot(thr, idx_desc, defprop_flags, pv_slot, attr_slot);
+		return duk__prop_defown_write_new_value(thr, idx_desc, defprop_flags, pv_slot);
 	}
 
 fail_not_extensible:
@@ -341,6 +341,26 @@ DUK_LOCAL duk_bool_t duk__prop_delete_obj_strkey_ordinary(duk_hthread *thr,
 			goto fail_not_configurable;
 		}
 
+#if defined(DUK_USE_HOBJECT_SHAPES)
+		if (DUK_HOBJECT_HAS_SHAPED(obj)) {
+			/* Deleting the most recently added key transitions back
+			 * to the parent shape, which keeps e.g. temporary
+			 * properties cheap.  Other deletes would leave a hole
+			 * in the shared keys so the object loses its shape.
+			 */
+			if (ent_idx + 1U == duk_hobject_get_enext(obj)) {
+				pv_slot = val_base + ent_idx;
+				duk_hobject_shape_pop_last(thr, obj);
+				DUK_HSTRING_DECREF_NORZ(thr, key);
+				duk__prop_delete_ent_shared(thr, pv_slot, attrs);
+				return 1;
+			}
+			duk_hobject_unshape(thr, obj);
+			(void) duk_hobject_lookup_strprop_indices(thr, obj, key, &ent_idx, &hash_idx); /* may now have a hash part */
+			duk_hobject_get_strprops_key_attr(thr->heap, obj, &val_base, &key_base, &attr_base);
+		}
+#endif
+
 		pv_slot = val_base + ent_idx;
 		key_slot = key_base + ent_idx;
 		DUK_ASSERT(*key_slot != NULL);
@@ -1045,8 +1045,8 @@ DUK_LOCAL const duk__get_ownprop_idxkey_htype duk__getown_idxkey_handlers[64] =
 	duk__get_ownprop_idxkey_ordinary,     duk__get_ownprop_idxkey_ordinary,    duk__get_ownprop_idxkey_ordinary,
 	duk__get_ownprop_idxkey_proxy,        duk__get_ownprop_idxkey_error,
 
-	duk__get_ownprop_idxkey_error,        duk__get_ownprop_idxkey_error,       duk__get_ownprop_idxkey_error,
-	duk__get_ownprop_idxkey_error,        duk__get_ownprop_idxkey_error,       duk__get_ownprop_idxkey_error,
+	duk__get_ownprop_idxkey_error,        duk__get_ownprop_idxkey_ordinary,    duk__get_ownprop_idxkey_ordinary,
+	duk__get_ownprop_idxkey_ordinary,     duk__get_ownprop_idxkey_ordinary,    duk__get_ownprop_idxkey_ordinary,
 	duk__get_ownprop_idxkey_error,        duk__get_ownprop_idxkey_error,
 
 	duk__get_ownprop_idxkey_error,        duk__get_ownprop_idxkey_error,       duk__get_ownprop_idxkey_error,
@@ -1172,8 +1172,8 @@ DUK_LOCAL const duk__get_ownprop_strkey_htype duk__getown_strkey_handlers[64] =
 	duk__get_ownprop_strkey_ordinary,   duk__get_ownprop_strkey_ordinary,   duk__get_ownprop_strkey_ordinary,
 	duk__get_ownprop_strkey_proxy,      duk__get_ownprop_strkey_error,
 
-	duk__get_ownprop_strkey_error,      duk__get_ownprop_strkey_error,      duk__get_ownprop_strkey_error,
-	duk__get_ownprop_strkey_error,      duk__get_ownprop_strkey_error,      duk__get_ownprop_strkey_error,
+	duk__get_ownprop_strkey_error,      duk__get_ownprop_strkey_ordinary,   duk__get_ownprop_strkey_ordinary,
+	duk__get_ownprop_strkey_ordinary,   duk__get_ownprop_strkey_ordinary,   duk__get_ownprop_strkey_ordinary,
 	duk__get_ownprop_strkey_error,      duk__get_ownprop_strkey_error,
 
 	duk__get_ownprop_strkey_error,      duk__get_ownprop_strkey_error,      duk__get_ownprop_strkey_error,
@@ -0,0 +1,267 @@
+/*
+ *  Property inline cache for executor GETPROP/GETPROPC/PUTPROP with a
+ *  constant string key.
+ *
+ *  The cache is a heap-wide direct mapped table indexed by instruction
+ *  address.  Each entry remembers up to DUK_HEAP_ICACHE_WAYS (slot index,
+ *  prototype depth) pairs where the property was last found, which
+ *  makes the cache monomorphic or small-polymorphic per instruction.
+ *
+ *  There are no object shapes, so a cached slot is only a guess which is
+ *  validated on every hit: the holder must still have the key in the
+ *  cached entry part slot, and any intermediate prototype objects must
+ *  not have the key.  Because of this the cache never needs explicit
+ *  invalidation: property table resizes and compaction (slots move),
+ *  deletes (key is NULLed), attribute changes, and prototype changes all
+ *  just cause misses.  Only plain data properties are handled; getters,
+ *  setters, Proxies, virtual properties (e.g. Array .length), array index
+ *  keys, and non-object receivers always use the full algorithm.
+ */
+
+#include "duk_internal.h"
+
+#if defined(DUK_USE_INLINE_CACHE_SIZE)
+
+/* Maximum prototype depth cached.  Keep small: intermediate objects are
+ * checked for a shadowing property on every hit.
+ */
+#define DUK__ICACHE_MAX_DEPTH 4
+
+#define DUK__ICACHE_INDEX(pc) ((duk_size_t) ((((duk_uintptr_t) (pc)) >> 2) & (DUK_USE_INLINE_CACHE_SIZE - 1)))
+
+/* Check that [[Get]] and [[Set]] for 'key' on 'obj' only involve the
+ * object's ordinary string keyed properties.  Exotic behaviors for string
+ * keys are limited to Proxies and .length / CanonicalNumericIndexString
+ * keys for Arrays, String objects, and typed arrays.
+ */
+DUK_LOCAL DUK_ALWAYS_INLINE duk_bool_t duk__icache_obj_ordinary(duk_hobject *obj, duk_hstring *key) {
+	if (DUK_LIKELY(!DUK_HOBJECT_HAS_EXOTIC_BEHAVIOR(obj))) {
+		return 1;
+	}
+	if (DUK_HOBJECT_IS_PROXY(obj) || DUK_HSTRING_HAS_LENGTH_OR_CANNUM(key)) {
+		return 0;
+	}
+	return 1;
+}
+
+/* Validate a cached (slot, depth) pair and return the data property value
+ * slot on success, NULL otherwise.
+ */
+DUK_LOCAL duk_tval *duk__icache_probe(duk_hthread *thr, duk_hobject *obj, duk_hstring *key, duk_uint32_t slot, duk_uint_t depth) {
+	duk_propvalue *val_base;
+	duk_hstring **key_base;
+	duk_uint8_t *attr_base;
+
+	while (depth > 0) {
+		duk_uint_fast32_t ent_idx;
+
+		if (!duk__icache_obj_ordinary(obj, key) || duk_hobject_lookup_strprop_index(thr, obj, key, &ent_idx)) {
+			return NULL;
+		}
+		obj = duk_hobject_get_proto_raw(thr->heap, obj);
+		if (obj == NULL) {
+			return NULL;
+		}
+		depth--;
+	}
+
+	if (DUK_UNLIKELY(!duk__icache_obj_ordinary(obj, key))) {
+		return NULL;
+	}
+	if (slot >= duk_hobject_get_enext(obj)) {
+		return NULL;
+	}
+	duk_hobject_get_strprops_key_attr(thr->heap, obj, &val_base, &key_base, &attr_base);
+	if (key_base[slot] != key || (attr_base[slot] & DUK_PROPDESC_FLAG_ACCESSOR) != 0) {
+		return NULL;
+	}
+	return &val_base[slot].v;
+}
+
+/* Full lookup for a miss: find an inherited data property within the
+ * cacheable depth and record it in the entry (most recent way first).
+ */
+DUK_LOCAL duk_tval *duk__icache_fill(duk_hthread *thr, duk_icache_entry *ent, const duk_instr_t *pc, duk_hobject *obj, duk_hstring *key) {
+	duk_uint_t depth;
+
+	for (depth = 0; depth <= DUK__ICACHE_MAX_DEPTH; depth++) {
+		duk_uint_fast32_t ent_idx;
+
+		if (!duk__icache_obj_ordinary(obj, key)) {
+			return NULL;
+		}
+		if (duk_hobject_lookup_strprop_index(thr, obj, key, &ent_idx)) {
+			duk_propvalue *pv;
+			duk_uint8_t attrs;
+
+			attrs = duk_hobject_get_strprops_attrs(thr->heap, obj)[ent_idx];
+			if (attrs & DUK_PROPDESC_FLAG_ACCESSOR) {
+				return NULL;
+			}
+			pv = duk_hobject_get_strprops_values(thr->heap, obj) + ent_idx;
+
+			if (ent->pc == pc && ent->key == key) {
+				ent->slot[1] = ent->slot[0];
+				ent->depth[1] = ent->depth[0];
+			} else {
+				ent->pc = pc;
+				ent->key = key;
+				ent->slot[1] = (duk_uint32_t) ent_idx;
+				ent->depth[1] = (duk_uint8_t) depth;
+			}
+			ent->slot[0] = (duk_uint32_t) ent_idx;
+			ent->depth[0] = (duk_uint8_t) depth;
+			return &pv->v;
+		}
+		obj = duk_hobject_get_proto_raw(thr->heap, obj);
+		if (obj == NULL) {
+			return NULL;
+		}
+	}
+	return NULL;
+}
+
+DUK_INTERNAL duk_bool_t duk_prop_icache_getvalue_strkey_outidx(duk_hthread *thr,
+                                                               duk_idx_t idx_recv,
+                                                               duk_hstring *key,
+                                                               duk_idx_t idx_out,
+                                                               const duk_instr_t *pc) {
+	duk_tval *tv_recv;
+	duk_tval *tv_val;
+	duk_tval *tv_out;
+	duk_hobject *obj;
+	duk_icache_entry *ent;
+
+	DUK_ASSERT(thr != NULL);
+	DUK_ASSERT(duk_is_valid_posidx(thr, idx_recv));
+	DUK_ASSERT(key != NULL);
+	DUK_ASSERT(duk_is_valid_posidx(thr, idx_out));
+	DUK_ASSERT(pc != NULL);
+
+	tv_recv = thr->valstack_bottom + idx_recv;
+	if (DUK_UNLIKELY(!DUK_TVAL_IS_OBJECT(tv_recv) || DUK_HSTRING_HAS_ARRIDX(key))) {
+		goto slow_path;
+	}
+	obj = DUK_TVAL_GET_OBJECT(tv_recv);
+	DUK_ASSERT(obj != NULL);
+
+	ent = thr->heap->icache + DUK__ICACHE_INDEX(pc);
+	if (DUK_LIKELY(ent->pc == pc && ent->key == key)) {
+		tv_val = duk__icache_probe(thr, obj, key, ent->slot[0], (duk_uint_t) ent->depth[0]);
+		if (DUK_LIKELY(tv_val != NULL)) {
+			goto hit;
+		}
+		tv_val = duk__icache_probe(thr, obj, key, ent->slot[1], (duk_uint_t) ent->depth[1]);
+		if (tv_val != NULL) {
+			goto hit;
+		}
+	}
+
+	DUK_STATS_INC(thr->heap, stats_icache_get_miss);
+	tv_val = duk__icache_fill(thr, ent, pc, obj, key);
+	if (tv_val == NULL) {
+		goto slow_path;
+	}
+	goto write_result;
+
+hit:
+	DUK_STATS_INC(thr->heap, stats_icache_get_hit);
+	/* fall through */
+
+write_result:
+	tv_out = thr->valstack_bottom + idx_out;
+	DUK_ASSERT(DUK_HTHREAD_TVAL_IN_VSFRAME(thr, tv_out));
+	DUK_TVAL_SET_TVAL_UPDREF(thr, tv_out, tv_val); /* side effects */
+	return 1;
+
+slow_path:
+	return duk_prop_getvalue_strkey_outidx(thr, idx_recv, key, idx_out);
+}
+
+DUK_INTERNAL duk_bool_t duk_prop_icache_putvalue_strkey_inidx(duk_hthread *thr,
+                                                              duk_idx_t idx_recv,
+                                                              duk_hstring *key,
+                                                              duk_idx_t idx_val,
+                                                              duk_bool_t throw_flag,
+                                                              const duk_instr_t *pc) {
+	duk_tval *tv_recv;
+	duk_tval *tv_val;
+	duk_hobject *obj;
+	duk_icache_entry *ent;
+	duk_propvalue *val_base;
+	duk_hstring **key_base;
+	duk_uint8_t *attr_base;
+	duk_uint32_t slot;
+	duk_uint_fast32_t ent_idx;
+
+	DUK_ASSERT(thr != NULL);
+	DUK_ASSERT(duk_is_valid_posidx(thr, idx_recv));
+	DUK_ASSERT(key != NULL);
+	DUK_ASSERT(duk_is_valid_posidx(thr, idx_val));
+	DUK_ASSERT(throw_flag == 0 || throw_flag == 1);
+	DUK_ASSERT(pc != NULL);
+
+	/* Only own writable data properties are cached: [[Set]] then
+	 * reduces to a plain value update without prototype walk.
+	 */
+	tv_recv = thr->valstack_bottom + idx_recv;
+	if (DUK_UNLIKELY(!DUK_TVAL_IS_OBJECT(tv_recv) || DUK_HSTRING_HAS_ARRIDX(key))) {
+		goto slow_path;
+	}
+	obj = DUK_TVAL_GET_OBJECT(tv_recv);
+	DUK_ASSERT(obj != NULL);
+	if (DUK_UNLIKELY(!duk__icache_obj_ordinary(obj, key))) {
+		goto slow_path;
+	}
+
+	duk_hobject_get_strprops_key_attr(thr->heap, obj, &val_base, &key_base, &attr_base);
+	ent = thr->heap->icache + DUK__ICACHE_INDEX(pc);
+	if (DUK_LIKELY(ent->pc == pc && ent->key == key)) {
+		slot = ent->slot[0];
+		if (DUK_LIKELY(slot < duk_hobject_get_enext(obj) && key_base[slot] == key)) {
+			goto hit;
+		}
+		slot = ent->slot[1];
+		if (slot < duk_hobject_get_enext(obj) && key_base[slot] == key) {
+			goto hit;
+		}
+	}
+
+	DUK_STATS_INC(thr->heap, stats_icache_put_miss);
+	if (!duk_hobject_lookup_strprop_index(thr, obj, key, &ent_idx)) {
+		goto slow_path;
+	}
+	slot = (duk_uint32_t) ent_idx;
+	if ((attr_base[slot] & (DUK_PROPDESC_FLAG_WRITABLE | DUK_PROPDESC_FLAG_ACCESSOR)) != DUK_PROPDESC_FLAG_WRITABLE) {
+		goto slow_path;
+	}
+	if (ent->pc == pc && ent->key == key) {
+		ent->slot[1] = ent->slot[0];
+	} else {
+		ent->pc = pc;
+		ent->key = key;
+		ent->slot[1] = slot;
+	}
+	ent->slot[0] = slot;
+	ent->depth[0] = 0;
+	ent->depth[1] = 0;
+	goto write_value;
+
+hit:
+	if (DUK_UNLIKELY((attr_base[slot] & (DUK_PROPDESC_FLAG_WRITABLE | DUK_PROPDESC_FLAG_ACCESSOR)) !=
+	                 DUK_PROPDESC_FLAG_WRITABLE)) {
+		goto slow_path;
+	}
+	DUK_STATS_INC(thr->heap, stats_icache_put_hit);
+	/* fall through */
+
+write_value:
+	tv_val = thr->valstack_bottom + idx_val;
+	DUK_TVAL_SET_TVAL_UPDREF(thr, &val_base[slot].v, tv_val); /* side effects */
+	return 1;
+
+slow_path:
+	return duk_prop_putvalue_strkey_inidx(thr, idx_recv, key, idx_val, throw_flag);
+}
+
+#endif /* DUK_USE_INLINE_CACHE_SIZE */
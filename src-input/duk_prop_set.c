@@ -1741,8 +1741,8 @@ DUK_LOCAL const duk__setfinal_strkey_htype duk__setfinal_strkey_handlers[64] = {
 	duk__setfinal_strkey_ordinary,   duk__setfinal_strkey_ordinary,   duk__setfinal_strkey_ordinary,
 	duk__setfinal_strkey_proxy,      duk__setfinal_strkey_error,
 
-	duk__setfinal_strkey_error,      duk__setfinal_strkey_error,      duk__setfinal_strkey_error,
-	duk__setfinal_strkey_error,      duk__setfinal_strkey_error,      duk__setfinal_strkey_error,
+	duk__setfinal_strkey_error,      duk__setfinal_strkey_ordinary,   duk__setfinal_strkey_ordinary,
+	duk__setfinal_strkey_ordinary,   duk__setfinal_strkey_ordinary,   duk__setfinal_strkey_ordinary,
 	duk__setfinal_strkey_error,      duk__setfinal_strkey_error,
 
 	duk__setfinal_strkey_error,      duk__setfinal_strkey_error,      duk__setfinal_strkey_error,
@@ -1775,8 +1775,8 @@ DUK_LOCAL const duk__setfinal_idxkey_htype duk__setfinal_idxkey_handlers[64] = {
 	duk__setfinal_idxkey_ordinary,   duk__setfinal_idxkey_ordinary,   duk__setfinal_idxkey_ordinary,
 	duk__setfinal_idxkey_proxy,      duk__setfinal_idxkey_error,
 
-	duk__setfinal_idxkey_error,      duk__setfinal_idxkey_error,      duk__setfinal_idxkey_error,
-	duk__setfinal_idxkey_error,      duk__setfinal_idxkey_error,      duk__setfinal_idxkey_error,
+	duk__setfinal_idxkey_error,      duk__setfinal_idxkey_ordinary,   duk__setfinal_idxkey_ordinary,
+	duk__setfinal_idxkey_ordinary,   duk__setfinal_idxkey_ordinary,   duk__setfinal_idxkey_ordinary,
 	duk__setfinal_idxkey_error,      duk__setfinal_idxkey_error,
 
 	duk__setfinal_idxkey_error,      duk__setfinal_idxkey_error,      duk__setfinal_idxkey_error,
@@ -1809,8 +1809,8 @@ DUK_LOCAL const duk__setcheck_strkey_htype duk__setcheck_strkey_handlers[64] = {
 	duk__setcheck_strkey_ordinary,   duk__setcheck_strkey_ordinary,   duk__setcheck_strkey_ordinary,
 	duk__setcheck_strkey_proxy,      duk__setcheck_strkey_error,
 
-	duk__setcheck_strkey_error,      duk__setcheck_strkey_error,      duk__setcheck_strkey_error,
-	duk__setcheck_strkey_error,      duk__setcheck_strkey_error,      duk__setcheck_strkey_error,
+	duk__setcheck_strkey_error,      duk__setcheck_strkey_ordinary,   duk__setcheck_strkey_ordinary,
+	duk__setcheck_strkey_ordinary,   duk__setcheck_strkey_ordinary,   duk__setcheck_strkey_ordinary,
 	duk__setcheck_strkey_error,      duk__setcheck_strkey_error,
 
 	duk__setcheck_strkey_error,      duk__setcheck_strkey_error,      duk__setcheck_strkey_error,
@@ -1843,8 +1843,8 @@ DUK_LOCAL const duk__setcheck_idxkey_htype duk__setcheck_idxkey_handlers[64] = {
 	duk__setcheck_idxkey_ordinary,   duk__setcheck_idxkey_ordinary,   duk__setcheck_idxkey_ordinary,
 	duk__setcheck_idxkey_proxy,      duk__setcheck_idxkey_error,
 
-	duk__setcheck_idxkey_error,      duk__setcheck_idxkey_error,      duk__setcheck_idxkey_error,
-	duk__setcheck_idxkey_error,      duk__setcheck_idxkey_error,      duk__setcheck_idxkey_error,
+	duk__setcheck_idxkey_error,      duk__setcheck_idxkey_ordinary,   duk__setcheck_idxkey_ordinary,
+	duk__setcheck_idxkey_ordinary,   duk__setcheck_idxkey_ordinary,   duk__setcheck_idxkey_ordinary,
 	duk__setcheck_idxkey_error,      duk__setcheck_idxkey_error,
 
 	duk__setcheck_idxkey_error,      duk__setcheck_idxkey_error,      duk__setcheck_idxkey_error,
@@ -2002,19 +2002,20 @@ DUK_LOCAL duk_bool_t duk__setfinal_strkey_ordinary(duk_hthread *thr, duk_hobject
 		 * refcount; may need a props allocation resize but doesn't
 		 * 'recheck' the valstack and won't have side effects.
 		 */
-		ent_idx = (duk_uint_fast32_t) duk_hobject_alloc_strentry_checked(thr, obj, key);
+		ent_idx = (duk_uint_fast32_t) duk_hobject_alloc_strentry_checked(thr, obj, key, DUK_PROPDESC_FLAGS_WEC);
 		DUK_ASSERT(ent_idx >= 0);
 
 		duk_hobject_get_strprops_key_attr(thr->heap, obj, &val_base, &key_base, &attr_base);
 		DUK_UNREF(key_base);
+		DUK_UNREF(attr_base);
 
 		DUK_ASSERT(key_base[ent_idx] == key);
+		DUK_ASSERT(attr_base[ent_idx] == DUK_PROPDESC_FLAGS_WEC);
 		pv = val_base + ent_idx;
 		tv_dst = &pv->v;
 		tv_val = thr->valstack_bottom + idx_val;
 		/* Previous value is garbage, so no DECREF. */
 		DUK_TVAL_SET_TVAL_INCREF(thr, tv_dst, tv_val);
-		attr_base[ent_idx] = DUK_PROPDESC_FLAGS_WEC;
 	}
 	return 1;
 
@@ -39,6 +39,16 @@
 #define DUK_RE_FLAG_GLOBAL      (1U << 0)
 #define DUK_RE_FLAG_IGNORE_CASE (1U << 1)
 #define DUK_RE_FLAG_MULTILINE   (1U << 2)
+#define DUK_RE_FLAG_PIKEVM      (1U << 3) /* internal: no backreferences or lookaheads, Pike VM can execute */
+#define DUK_RE_FLAG_PREFIX      (1U << 4) /* internal: header has a required literal prefix */
+#define DUK_RE_FLAG_FIRSTSET    (1U << 5) /* internal: header has a first character set */
+
+/* Limits for match start scanning info in the bytecode header.  The literal
+ * prefix contains only BMP non-surrogate codepoints so that it can be matched
+ * as WTF-8 bytes, i.e. at most 3 bytes per codepoint.
+ */
+#define DUK_RE_PREFIX_MAX_CHARS 32
+#define DUK_RE_PREFIX_MAX_BYTES (DUK_RE_PREFIX_MAX_CHARS * 3)
 
 typedef duk_int_t duk_re_sp_t; /* RegExp executor string pointer. */
 
@@ -58,6 +68,18 @@ struct duk_re_matcher_ctx {
 	duk_uint32_t recursion_limit;
 	duk_uint32_t steps_count;
 	duk_uint32_t steps_limit;
+#if defined(DUK_USE_REGEXP_PIKEVM)
+	duk_bool_t pikevm_switch; /* switch to Pike VM when limits are reached */
+#endif
+#if defined(DUK_USE_REGEXP_PREFIX_SCAN)
+	duk_size_t prefix_len; /* required literal prefix as WTF-8, 0 if none */
+	duk_uint8_t prefix[DUK_RE_PREFIX_MAX_BYTES];
+	duk_bool_t has_skip;
+	duk_uint8_t skip[256]; /* Boyer-Moore-Horspool shifts for long prefixes */
+	duk_bool_t has_firstset;
+	duk_bool_t firstset_nonascii; /* any non-ASCII codepoint may start a match */
+	duk_uint32_t firstset[4]; /* ASCII codepoints which may start a match */
+#endif
 };
 
 struct duk_re_compiler_ctx {
@@ -72,6 +94,9 @@ struct duk_re_compiler_ctx {
 	duk_uint32_t recursion_depth;
 	duk_uint32_t recursion_limit;
 	duk_uint32_t nranges; /* internal temporary value, used for char classes */
+#if defined(DUK_USE_REGEXP_PIKEVM)
+	duk_bool_t has_lookahead;
+#endif
 };
 
 /*
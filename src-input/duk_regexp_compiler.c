@@ -796,6 +796,10 @@ DUK_LOCAL void duk__parse_disjunction(duk_re_compiler_ctx *re_ctx, duk_bool_t ex
 			duk_uint32_t opcode =
 			    (re_ctx->curr_token.t == DUK_RETOK_ASSERT_START_POS_LOOKAHEAD) ? DUK_REOP_LOOKPOS : DUK_REOP_LOOKNEG;
 
+#if defined(DUK_USE_REGEXP_PIKEVM)
+			re_ctx->has_lookahead = 1;
+#endif
+
 			offset = (duk_uint32_t) DUK__RE_BUFLEN(re_ctx);
 			duk__parse_disjunction(re_ctx, 0, &tmp_disj);
 			duk__append_reop(re_ctx, DUK_REOP_MATCH);
@@ -1122,6 +1126,355 @@ DUK_LOCAL void duk__create_escaped_source(duk_hthread *thr, int idx_pattern) {
 	/* [ ... escaped_source ] */
 }
 
+/*
+ *  Match start scan info.
+ *
+ *  After compilation, the bytecode is analyzed for a literal prefix which
+ *  every match must start with (e.g. /foo\d+/ -> "foo"), or failing that,
+ *  a set of characters which may start a match (e.g. /[a-c]x|y+/).  The
+ *  executor uses these to skip input offsets which cannot start a match.
+ *  Zero width opcodes (saves, assertions, lookaheads) are skipped because
+ *  they don't change the match start position.  The analysis is bounded
+ *  and conservative: when in doubt, no scan info is emitted.
+ */
+
+#if defined(DUK_USE_REGEXP_PREFIX_SCAN)
+#define DUK__RE_SCAN_MAX_BRANCHES 16
+#define DUK__RE_SCAN_MAX_STEPS    256
+
+typedef struct {
+	duk_uint32_t prefix_len;
+	duk_uint32_t prefix[DUK_RE_PREFIX_MAX_CHARS];
+	duk_uint32_t firstset[4];
+	duk_bool_t firstset_nonascii;
+} duk__re_scan_info;
+
+DUK_LOCAL duk_uint32_t duk__scan_get_u32(duk_re_compiler_ctx *re_ctx, const duk_uint8_t **p) {
+	const duk_uint8_t *base = DUK_BW_GET_BASEPTR(re_ctx->thr, &re_ctx->bw);
+
+	return (duk_uint32_t) duk_unicode_decode_xutf8_checked(re_ctx->thr, p, base, base + DUK__RE_BUFLEN(re_ctx));
+}
+
+DUK_LOCAL duk_int32_t duk__scan_get_i32(duk_re_compiler_ctx *re_ctx, const duk_uint8_t **p) {
+	duk_uint32_t t;
+
+	t = duk__scan_get_u32(re_ctx, p);
+	if (t & 1) {
+		return -((duk_int32_t) (t >> 1));
+	} else {
+		return (duk_int32_t) (t >> 1);
+	}
+}
+
+/* Skip a zero width opcode, return 0 if 'op' consumes input or isn't known. */
+DUK_LOCAL duk_bool_t duk__scan_skip_zero_width(duk_re_compiler_ctx *re_ctx, duk_uint32_t op, const duk_uint8_t **p) {
+	switch (op) {
+	case DUK_REOP_SAVE: {
+		(void) duk__scan_get_u32(re_ctx, p);
+		return 1;
+	}
+	case DUK_REOP_WIPERANGE: {
+		(void) duk__scan_get_u32(re_ctx, p);
+		(void) duk__scan_get_u32(re_ctx, p);
+		return 1;
+	}
+	case DUK_REOP_ASSERT_START:
+	case DUK_REOP_ASSERT_END:
+	case DUK_REOP_ASSERT_WORD_BOUNDARY:
+	case DUK_REOP_ASSERT_NOT_WORD_BOUNDARY: {
+		return 1;
+	}
+	case DUK_REOP_LOOKPOS:
+	case DUK_REOP_LOOKNEG: {
+		duk_int32_t skip;
+
+		skip = duk__scan_get_i32(re_ctx, p);
+		*p += skip;
+		return 1;
+	}
+	default: {
+		return 0;
+	}
+	}
+}
+
+DUK_LOCAL void duk__scan_add_ascii(duk__re_scan_info *info, duk_uint32_t c) {
+	DUK_ASSERT(c < 0x80UL);
+	info->firstset[c >> 5] |= (duk_uint32_t) 1UL << (c & 0x1fUL);
+}
+
+/* Add codepoint range [r1,r2] (as seen by the executor) to the first set. */
+DUK_LOCAL void duk__scan_add_range(duk_re_compiler_ctx *re_ctx,
+                                   duk__re_scan_info *info,
+                                   duk_uint32_t r1,
+                                   duk_uint32_t r2) {
+	duk_uint32_t c;
+
+	if (r2 >= 0x80UL) {
+		/* Non-ASCII input never canonicalizes to ASCII and vice versa. */
+		info->firstset_nonascii = 1;
+	}
+	for (c = r1; c <= r2 && c < 0x80UL; c++) {
+		duk__scan_add_ascii(info, c);
+		if (re_ctx->re_flags & DUK_RE_FLAG_IGNORE_CASE) {
+			/* Input is canonicalized (uppercased) before matching so
+			 * both cases of a letter may match.
+			 */
+			if (c >= (duk_uint32_t) DUK_ASC_UC_A && c <= (duk_uint32_t) DUK_ASC_UC_Z) {
+				duk__scan_add_ascii(info, c + 0x20UL);
+			} else if (c >= (duk_uint32_t) DUK_ASC_LC_A && c <= (duk_uint32_t) DUK_ASC_LC_Z) {
+				duk__scan_add_ascii(info, c - 0x20UL);
+			}
+		}
+	}
+}
+
+DUK_LOCAL void duk__scan_get_prefix(duk_re_compiler_ctx *re_ctx, duk__re_scan_info *info) {
+	const duk_uint8_t *p;
+	const duk_uint8_t *p_end;
+
+	if (re_ctx->re_flags & DUK_RE_FLAG_IGNORE_CASE) {
+		return;
+	}
+
+	p = DUK_BW_GET_BASEPTR(re_ctx->thr, &re_ctx->bw);
+	p_end = p + DUK__RE_BUFLEN(re_ctx);
+	while (p < p_end && info->prefix_len < DUK_RE_PREFIX_MAX_CHARS) {
+		duk_uint32_t op;
+		duk_uint32_t c;
+
+		op = duk__scan_get_u32(re_ctx, &p);
+		if (duk__scan_skip_zero_width(re_ctx, op, &p)) {
+			continue;
+		}
+		if (op != DUK_REOP_CHAR) {
+			break;
+		}
+		c = duk__scan_get_u32(re_ctx, &p);
+		if (c >= 0xd800UL) {
+			/* Surrogates can't be matched as WTF-8 bytes (input may
+			 * have them combined), and the remaining BMP codepoints
+			 * don't matter in practice.
+			 */
+			break;
+		}
+		info->prefix[info->prefix_len++] = c;
+	}
+}
+
+DUK_LOCAL duk_bool_t duk__scan_get_firstset(duk_re_compiler_ctx *re_ctx, duk__re_scan_info *info) {
+	duk_uint32_t branches[DUK__RE_SCAN_MAX_BRANCHES];
+	duk_small_uint_t nbranches;
+	duk_small_uint_t steps = 0;
+	const duk_uint8_t *base;
+	const duk_uint8_t *base_end;
+	const duk_uint8_t *p;
+
+	base = DUK_BW_GET_BASEPTR(re_ctx->thr, &re_ctx->bw);
+	base_end = base + DUK__RE_BUFLEN(re_ctx);
+	branches[0] = 0;
+	nbranches = 1;
+
+	while (nbranches > 0) {
+		p = base + branches[--nbranches];
+		for (;;) {
+			duk_uint32_t op;
+			duk_int32_t skip;
+
+			if (++steps > DUK__RE_SCAN_MAX_STEPS || p < base || p >= base_end) {
+				return 0;
+			}
+			op = duk__scan_get_u32(re_ctx, &p);
+			if (duk__scan_skip_zero_width(re_ctx, op, &p)) {
+				continue;
+			}
+			switch (op) {
+			case DUK_REOP_CHAR: {
+				duk_uint32_t c;
+
+				c = duk__scan_get_u32(re_ctx, &p);
+				duk__scan_add_range(re_ctx, info, c, c);
+				goto next_branch;
+			}
+			case DUK_REOP_RANGES: {
+				duk_uint32_t n;
+
+				n = duk__scan_get_u32(re_ctx, &p);
+				while (n-- > 0) {
+					duk_uint32_t r1, r2;
+
+					r1 = duk__scan_get_u32(re_ctx, &p);
+					r2 = duk__scan_get_u32(re_ctx, &p);
+					duk__scan_add_range(re_ctx, info, r1, r2);
+				}
+				goto next_branch;
+			}
+			case DUK_REOP_JUMP: {
+				skip = duk__scan_get_i32(re_ctx, &p);
+				p += skip;
+				break;
+			}
+			case DUK_REOP_SPLIT1:
+			case DUK_REOP_SPLIT2: {
+				if (nbranches >= DUK__RE_SCAN_MAX_BRANCHES) {
+					return 0;
+				}
+				skip = duk__scan_get_i32(re_ctx, &p);
+				branches[nbranches++] = (duk_uint32_t) ((p + skip) - base);
+				break;
+			}
+			case DUK_REOP_SQMINIMAL:
+			case DUK_REOP_SQGREEDY: {
+				duk_uint32_t qmin;
+
+				qmin = duk__scan_get_u32(re_ctx, &p);
+				(void) duk__scan_get_u32(re_ctx, &p); /* qmax */
+				if (op == DUK_REOP_SQGREEDY) {
+					(void) duk__scan_get_u32(re_ctx, &p); /* atomlen */
+				}
+				skip = duk__scan_get_i32(re_ctx, &p);
+				if (qmin == 0) {
+					if (nbranches >= DUK__RE_SCAN_MAX_BRANCHES) {
+						return 0;
+					}
+					branches[nbranches++] = (duk_uint32_t) ((p + skip) - base);
+				}
+				/* Continue into the atom, whose MATCH (empty atom) fails
+				 * the analysis below.
+				 */
+				break;
+			}
+			default: {
+				/* MATCH (empty match possible), PERIOD and INVRANGES
+				 * (too wide), BACKREFERENCE (may be empty).
+				 */
+				return 0;
+			}
+			}
+		}
+	next_branch:;
+	}
+
+	return 1;
+}
+
+DUK_LOCAL void duk__emit_scan_info(duk_re_compiler_ctx *re_ctx) {
+	duk__re_scan_info info;
+	duk_uint32_t i;
+
+	duk_memzero(&info, sizeof(info));
+
+	duk__scan_get_prefix(re_ctx, &info);
+	if (info.prefix_len > 0) {
+		/* Emitted right after the header, insertion order inverted. */
+		i = info.prefix_len;
+		while (i > 0) {
+			(void) duk__insert_u32(re_ctx, 0, info.prefix[--i]);
+		}
+		(void) duk__insert_u32(re_ctx, 0, info.prefix_len);
+		re_ctx->re_flags |= DUK_RE_FLAG_PREFIX;
+		return;
+	}
+
+	if (duk__scan_get_firstset(re_ctx, &info)) {
+		if (info.firstset_nonascii && (info.firstset[0] & info.firstset[1] & info.firstset[2] & info.firstset[3]) ==
+		                                  0xffffffffUL) {
+			/* Every character may start a match, no use scanning. */
+			return;
+		}
+		(void) duk__insert_u32(re_ctx, 0, (duk_uint32_t) info.firstset_nonascii);
+		i = 4;
+		while (i > 0) {
+			(void) duk__insert_u32(re_ctx, 0, info.firstset[--i]);
+		}
+		re_ctx->re_flags |= DUK_RE_FLAG_FIRSTSET;
+	}
+}
+#endif /* DUK_USE_REGEXP_PREFIX_SCAN */
+
+/*
+ *  Compiled RegExp cache.
+ *
+ *  Dynamic regexps (RegExp constructor, String.prototype.match() etc with a
+ *  string argument) are often created from the same (pattern, flags) pair
+ *  over and over.  Because the compilation result only depends on that pair
+ *  and the bytecode is never modified after compilation, the escaped source
+ *  and the bytecode buffer can be shared by all RegExp instances.  Pattern
+ *  and flags are interned so pointer comparison suffices.
+ */
+
+#if defined(DUK_USE_REGEXP_CACHE_SIZE)
+DUK_LOCAL duk_bool_t duk__re_cache_lookup(duk_hthread *thr, duk_hstring *h_pattern, duk_hstring *h_flags) {
+	duk_heap *heap;
+	duk_re_cache_entry *e;
+	duk_re_cache_entry tmp;
+	duk_small_uint_t i;
+
+	heap = thr->heap;
+	for (i = 0; i < heap->re_cache_count; i++) {
+		e = heap->re_cache + i;
+		if (e->pattern != h_pattern || e->flags != h_flags) {
+			continue;
+		}
+
+		/* [ ... pattern flags ] */
+
+		duk_push_hstring(thr, e->source);
+		duk_push_hbuffer(thr, e->bytecode);
+
+		/* [ ... pattern flags escaped_source bytecode ] */
+
+		if (i > 0) {
+			/* Move to MRU position, no refcount changes needed. */
+			tmp = *e;
+			duk_memmove((void *) (heap->re_cache + 1),
+			            (const void *) heap->re_cache,
+			            (size_t) (sizeof(duk_re_cache_entry) * i));
+			heap->re_cache[0] = tmp;
+		}
+
+		DUK_DD(DUK_DDPRINT("regexp cache hit at index %ld", (long) i));
+		return 1;
+	}
+	return 0;
+}
+
+DUK_LOCAL void duk__re_cache_insert(duk_hthread *thr) {
+	duk_heap *heap;
+	duk_re_cache_entry *e;
+	duk_small_uint_t n;
+
+	/* [ ... pattern flags escaped_source bytecode ] */
+
+	heap = thr->heap;
+	n = heap->re_cache_count;
+	if (n >= DUK_USE_REGEXP_CACHE_SIZE) {
+		/* Evict LRU entry.  No side effects: the values are freed by
+		 * mark-and-sweep if they became unreachable.
+		 */
+		n = DUK_USE_REGEXP_CACHE_SIZE - 1;
+		e = heap->re_cache + n;
+		DUK_HSTRING_DECREF_NORZ(thr, e->pattern);
+		DUK_HSTRING_DECREF_NORZ(thr, e->flags);
+		DUK_HSTRING_DECREF_NORZ(thr, e->source);
+		DUK_HBUFFER_DECREF_NORZ(thr, e->bytecode);
+	} else {
+		heap->re_cache_count = (duk_small_uint_t) (n + 1);
+	}
+	duk_memmove((void *) (heap->re_cache + 1), (const void *) heap->re_cache, (size_t) (sizeof(duk_re_cache_entry) * n));
+
+	e = heap->re_cache;
+	e->pattern = duk_known_hstring(thr, -4);
+	e->flags = duk_known_hstring(thr, -3);
+	e->source = duk_known_hstring(thr, -2);
+	e->bytecode = duk_known_hbuffer(thr, -1);
+	DUK_HSTRING_INCREF(thr, e->pattern);
+	DUK_HSTRING_INCREF(thr, e->flags);
+	DUK_HSTRING_INCREF(thr, e->source);
+	DUK_HBUFFER_INCREF(thr, e->bytecode);
+}
+#endif /* DUK_USE_REGEXP_CACHE_SIZE */
+
 /*
  *  Exposed regexp compilation primitive.
  *
@@ -1154,6 +1507,12 @@ DUK_INTERNAL void duk_regexp_compile(duk_hthread *thr) {
 	h_pattern = duk_require_hstring_notsymbol(thr, -2);
 	h_flags = duk_require_hstring_notsymbol(thr, -1);
 
+#if defined(DUK_USE_REGEXP_CACHE_SIZE)
+	if (duk__re_cache_lookup(thr, h_pattern, h_flags)) {
+		goto finalize;
+	}
+#endif
+
 	/*
 	 *  Create normalized 'source' property (E5 Section 15.10.3).
 	 */
@@ -1221,9 +1580,25 @@ DUK_INTERNAL void duk_regexp_compile(duk_hthread *thr) {
 		DUK_WO_NORETURN(return;);
 	}
 
+#if defined(DUK_USE_REGEXP_PIKEVM)
+	/* Without backreferences and lookaheads the Pike VM executor can be
+	 * used (internal flag, not visible to getters).
+	 */
+	if (re_ctx.highest_backref == 0 && !re_ctx.has_lookahead) {
+		re_ctx.re_flags |= DUK_RE_FLAG_PIKEVM;
+	}
+#endif
+
+#if defined(DUK_USE_REGEXP_PREFIX_SCAN)
+	duk__emit_scan_info(&re_ctx);
+#endif
+
 	/*
 	 *  Emit compiled regexp header: flags, ncaptures
 	 *  (insertion order inverted on purpose)
+	 *
+	 *  Optional match start scan info follows the header, see
+	 *  duk__emit_scan_info().
 	 */
 
 	duk__insert_u32(&re_ctx, 0, (re_ctx.captures + 1) * 2);
@@ -1235,10 +1610,17 @@ DUK_INTERNAL void duk_regexp_compile(duk_hthread *thr) {
 
 	/* [ ... pattern flags escaped_source bytecode ] */
 
+#if defined(DUK_USE_REGEXP_CACHE_SIZE)
+	duk__re_cache_insert(thr);
+#endif
+
 	/*
 	 *  Finalize stack
 	 */
 
+#if defined(DUK_USE_REGEXP_CACHE_SIZE)
+finalize:
+#endif
 	duk_remove(thr, -4); /* -> [ ... flags escaped_source bytecode ] */
 	duk_remove(thr, -3); /* -> [ ... escaped_source bytecode ] */
 
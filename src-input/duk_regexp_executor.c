@@ -20,6 +20,21 @@
 
 #define DUK__RE_SP_VALID(x) ((x) >= 0)
 
+#if defined(DUK_USE_REGEXP_PIKEVM)
+/* Backtracking aborted because its budget ran out, see duk__regexp_match_helper(). */
+#define DUK__RE_SP_ABORT          (-2)
+#define DUK__RE_CHECK_ABORT(sp) \
+	do { \
+		if (DUK_UNLIKELY((sp) == DUK__RE_SP_ABORT)) { \
+			goto abort; \
+		} \
+	} while (0)
+#else
+#define DUK__RE_CHECK_ABORT(sp) \
+	do { \
+	} while (0)
+#endif
+
 #if defined(DUK_USE_DEBUG_LEVEL) && (DUK_USE_DEBUG_LEVEL >= 2)
 DUK_LOCAL void duk__regexp_dump_state(duk_re_matcher_ctx *re_ctx) {
 	duk_uint32_t i;
@@ -85,11 +100,108 @@ DUK_LOCAL duk_codepoint_t duk__inp_get_prev_cp(duk_re_matcher_ctx *re_ctx, duk_r
 	return duk__inp_get_cp(re_ctx, &sp);
 }
 
+/* Match a (possibly canonicalized) character against a RANGES/INVRANGES
+ * range list.  All ranges are read from bytecode so that 'pc' is left
+ * pointing to the next instruction.
+ */
+DUK_LOCAL DUK_ALWAYS_INLINE duk_small_int_t duk__match_ranges(duk_re_matcher_ctx *re_ctx, const duk_uint8_t **pc, duk_codepoint_t c) {
+	duk_uint32_t n;
+	duk_small_int_t match;
+
+	n = duk__bc_get_u32(re_ctx, pc);
+	match = 0;
+	while (n) {
+		duk_codepoint_t r1, r2;
+		r1 = (duk_codepoint_t) duk__bc_get_u32(re_ctx, pc);
+		r2 = (duk_codepoint_t) duk__bc_get_u32(re_ctx, pc);
+		DUK_DDD(DUK_DDDPRINT("matching ranges/invranges, n=%ld, r1=%ld, r2=%ld, c=%ld",
+		                     (long) n,
+		                     (long) r1,
+		                     (long) r2,
+		                     (long) c));
+		if (c >= r1 && c <= r2) {
+			/* Note: don't bail out early, we must read all the ranges from
+			 * bytecode.  Another option is to skip them efficiently after
+			 * breaking out of here.  Prefer smallest code.
+			 */
+			match = 1;
+		}
+		n--;
+	}
+	return match;
+}
+
+/* Check a zero-width assertion (DUK_REOP_ASSERT_xxx) at 'sp'. */
+DUK_LOCAL duk_small_int_t duk__check_assertion(duk_re_matcher_ctx *re_ctx, duk_small_int_t op, duk_re_sp_t sp) {
+	duk_codepoint_t c;
+	duk_re_sp_t tmp_sp;
+
+	switch (op) {
+	case DUK_REOP_ASSERT_START: {
+		if (sp <= 0) {
+			return 1;
+		}
+		if (!(re_ctx->re_flags & DUK_RE_FLAG_MULTILINE)) {
+			return 0;
+		}
+		c = duk__inp_get_prev_cp(re_ctx, sp);
+		/* E5 Sections 15.10.2.8, 7.3 */
+		return duk_unicode_is_line_terminator(c);
+	}
+	case DUK_REOP_ASSERT_END: {
+		tmp_sp = sp;
+		c = duk__inp_get_cp(re_ctx, &tmp_sp);
+		if (c < 0) {
+			return 1;
+		}
+		if (!(re_ctx->re_flags & DUK_RE_FLAG_MULTILINE)) {
+			return 0;
+		}
+		/* E5 Sections 15.10.2.8, 7.3 */
+		return duk_unicode_is_line_terminator(c);
+	}
+	default: {
+		/*
+		 *  E5 Section 15.10.2.6.  The previous and current character
+		 *  should -not- be canonicalized as they are now.  However,
+		 *  canonicalization does not affect the result of IsWordChar()
+		 *  (which depends on Unicode characters never canonicalizing
+		 *  into ASCII characters) so this does not matter.
+		 */
+		duk_small_int_t w1, w2;
+
+		DUK_ASSERT(op == DUK_REOP_ASSERT_WORD_BOUNDARY || op == DUK_REOP_ASSERT_NOT_WORD_BOUNDARY);
+
+		if (sp <= 0) {
+			w1 = 0; /* not a wordchar */
+		} else {
+			c = duk__inp_get_prev_cp(re_ctx, sp);
+			w1 = duk_unicode_re_is_wordchar(c);
+		}
+		if (sp >= re_ctx->sp_end) {
+			w2 = 0; /* not a wordchar */
+		} else {
+			tmp_sp = sp; /* dummy so sp won't get updated */
+			c = duk__inp_get_cp(re_ctx, &tmp_sp);
+			w2 = duk_unicode_re_is_wordchar(c);
+		}
+
+		if (op == DUK_REOP_ASSERT_WORD_BOUNDARY) {
+			return (w1 != w2);
+		} else {
+			return (w1 == w2);
+		}
+	}
+	}
+}
+
 /*
  *  Regexp recursive matching function.
  *
  *  Returns 'sp' on successful match (points to character after last matched one),
- *  -1 otherwise.
+ *  -1 otherwise.  When re_ctx->pikevm_switch is set, exceeding the step or
+ *  recursion limit unwinds the whole match with DUK__RE_SP_ABORT instead of
+ *  throwing an error.
  *
  *  The C recursion depth limit check is only performed in this function, this
  *  suffices because the function is present in all true recursion required by
@@ -99,6 +211,11 @@ DUK_LOCAL duk_codepoint_t duk__inp_get_prev_cp(duk_re_matcher_ctx *re_ctx, duk_r
 DUK_LOCAL duk_re_sp_t duk__match_regexp(duk_re_matcher_ctx *re_ctx, const duk_uint8_t *pc, duk_re_sp_t sp) {
 	duk_native_stack_check(re_ctx->thr);
 	if (re_ctx->recursion_depth >= re_ctx->recursion_limit) {
+#if defined(DUK_USE_REGEXP_PIKEVM)
+		if (re_ctx->pikevm_switch) {
+			return DUK__RE_SP_ABORT;
+		}
+#endif
 		DUK_ERROR_RANGE(re_ctx->thr, DUK_STR_REGEXP_EXECUTOR_RECURSION_LIMIT);
 		DUK_WO_NORETURN(return -1;);
 	}
@@ -108,6 +225,11 @@ DUK_LOCAL duk_re_sp_t duk__match_regexp(duk_re_matcher_ctx *re_ctx, const duk_ui
 		duk_small_int_t op;
 
 		if (re_ctx->steps_count >= re_ctx->steps_limit) {
+#if defined(DUK_USE_REGEXP_PIKEVM)
+			if (re_ctx->pikevm_switch) {
+				goto abort;
+			}
+#endif
 			DUK_ERROR_RANGE(re_ctx->thr, DUK_STR_REGEXP_EXECUTOR_STEP_LIMIT);
 			DUK_WO_NORETURN(return -1;);
 		}
@@ -185,35 +307,14 @@ DUK_LOCAL duk_re_sp_t duk__match_regexp(duk_re_matcher_ctx *re_ctx, const duk_ui
 		}
 		case DUK_REOP_RANGES:
 		case DUK_REOP_INVRANGES: {
-			duk_uint32_t n;
 			duk_codepoint_t c;
 			duk_small_int_t match;
 
-			n = duk__bc_get_u32(re_ctx, &pc);
 			c = duk__inp_get_cp(re_ctx, &sp);
 			if (c < 0) {
 				goto fail;
 			}
-
-			match = 0;
-			while (n) {
-				duk_codepoint_t r1, r2;
-				r1 = (duk_codepoint_t) duk__bc_get_u32(re_ctx, &pc);
-				r2 = (duk_codepoint_t) duk__bc_get_u32(re_ctx, &pc);
-				DUK_DDD(DUK_DDDPRINT("matching ranges/invranges, n=%ld, r1=%ld, r2=%ld, c=%ld",
-				                     (long) n,
-				                     (long) r1,
-				                     (long) r2,
-				                     (long) c));
-				if (c >= r1 && c <= r2) {
-					/* Note: don't bail out early, we must read all the ranges from
-					 * bytecode.  Another option is to skip them efficiently after
-					 * breaking out of here.  Prefer smallest code.
-					 */
-					match = 1;
-				}
-				n--;
-			}
+			match = duk__match_ranges(re_ctx, &pc, c);
 
 			if (op == DUK_REOP_RANGES) {
 				if (!match) {
@@ -227,76 +328,12 @@ DUK_LOCAL duk_re_sp_t duk__match_regexp(duk_re_matcher_ctx *re_ctx, const duk_ui
 			}
 			break;
 		}
-		case DUK_REOP_ASSERT_START: {
-			duk_codepoint_t c;
-
-			if (sp <= 0) {
-				break;
-			}
-			if (!(re_ctx->re_flags & DUK_RE_FLAG_MULTILINE)) {
-				goto fail;
-			}
-			c = duk__inp_get_prev_cp(re_ctx, sp);
-			if (duk_unicode_is_line_terminator(c)) {
-				/* E5 Sections 15.10.2.8, 7.3 */
-				break;
-			}
-			goto fail;
-		}
-		case DUK_REOP_ASSERT_END: {
-			duk_codepoint_t c;
-			duk_re_sp_t tmp_sp;
-
-			tmp_sp = sp;
-			c = duk__inp_get_cp(re_ctx, &tmp_sp);
-			if (c < 0) {
-				break;
-			}
-			if (!(re_ctx->re_flags & DUK_RE_FLAG_MULTILINE)) {
-				goto fail;
-			}
-			if (duk_unicode_is_line_terminator(c)) {
-				/* E5 Sections 15.10.2.8, 7.3 */
-				break;
-			}
-			goto fail;
-		}
+		case DUK_REOP_ASSERT_START:
+		case DUK_REOP_ASSERT_END:
 		case DUK_REOP_ASSERT_WORD_BOUNDARY:
 		case DUK_REOP_ASSERT_NOT_WORD_BOUNDARY: {
-			/*
-			 *  E5 Section 15.10.2.6.  The previous and current character
-			 *  should -not- be canonicalized as they are now.  However,
-			 *  canonicalization does not affect the result of IsWordChar()
-			 *  (which depends on Unicode characters never canonicalizing
-			 *  into ASCII characters) so this does not matter.
-			 */
-			duk_small_int_t w1, w2;
-
-			if (sp <= 0) {
-				w1 = 0; /* not a wordchar */
-			} else {
-				duk_codepoint_t c;
-				c = duk__inp_get_prev_cp(re_ctx, sp);
-				w1 = duk_unicode_re_is_wordchar(c);
-			}
-			if (sp >= re_ctx->sp_end) {
-				w2 = 0; /* not a wordchar */
-			} else {
-				duk_re_sp_t tmp_sp = sp; /* dummy so sp won't get updated */
-				duk_codepoint_t c;
-				c = duk__inp_get_cp(re_ctx, &tmp_sp);
-				w2 = duk_unicode_re_is_wordchar(c);
-			}
-
-			if (op == DUK_REOP_ASSERT_WORD_BOUNDARY) {
-				if (w1 == w2) {
-					goto fail;
-				}
-			} else {
-				DUK_ASSERT(op == DUK_REOP_ASSERT_NOT_WORD_BOUNDARY);
-				if (w1 != w2) {
-					goto fail;
-				}
+			if (!duk__check_assertion(re_ctx, op, sp)) {
+				goto fail;
 			}
 			break;
 		}
@@ -314,6 +351,7 @@ DUK_LOCAL duk_re_sp_t duk__match_regexp(duk_re_matcher_ctx *re_ctx, const duk_ui
 
 			skip = duk__bc_get_i32(re_ctx, &pc);
 			sub_sp = duk__match_regexp(re_ctx, pc, sp);
+			DUK__RE_CHECK_ABORT(sub_sp);
 			if (DUK__RE_SP_VALID(sub_sp)) {
 				sp = sub_sp;
 				goto match;
@@ -328,6 +366,7 @@ DUK_LOCAL duk_re_sp_t duk__match_regexp(duk_re_matcher_ctx *re_ctx, const duk_ui
 
 			skip = duk__bc_get_i32(re_ctx, &pc);
 			sub_sp = duk__match_regexp(re_ctx, pc + skip, sp);
+			DUK__RE_CHECK_ABORT(sub_sp);
 			if (DUK__RE_SP_VALID(sub_sp)) {
 				sp = sub_sp;
 				goto match;
@@ -351,12 +390,14 @@ DUK_LOCAL duk_re_sp_t duk__match_regexp(duk_re_matcher_ctx *re_ctx, const duk_ui
 			while (q <= qmax) {
 				if (q >= qmin) {
 					sub_sp = duk__match_regexp(re_ctx, pc + skip, sp);
+					DUK__RE_CHECK_ABORT(sub_sp);
 					if (DUK__RE_SP_VALID(sub_sp)) {
 						sp = sub_sp;
 						goto match;
 					}
 				}
 				sub_sp = duk__match_regexp(re_ctx, pc, sp);
+				DUK__RE_CHECK_ABORT(sub_sp);
 				if (!DUK__RE_SP_VALID(sub_sp)) {
 					break;
 				}
@@ -383,6 +424,7 @@ DUK_LOCAL duk_re_sp_t duk__match_regexp(duk_re_matcher_ctx *re_ctx, const duk_ui
 			q = 0;
 			while (q < qmax) {
 				sub_sp = duk__match_regexp(re_ctx, pc, sp);
+				DUK__RE_CHECK_ABORT(sub_sp);
 				if (!DUK__RE_SP_VALID(sub_sp)) {
 					break;
 				}
@@ -391,6 +433,7 @@ DUK_LOCAL duk_re_sp_t duk__match_regexp(duk_re_matcher_ctx *re_ctx, const duk_ui
 			}
 			while (q >= qmin) {
 				sub_sp = duk__match_regexp(re_ctx, pc + skip, sp);
+				DUK__RE_CHECK_ABORT(sub_sp);
 				if (DUK__RE_SP_VALID(sub_sp)) {
 					sp = sub_sp;
 					goto match;
@@ -424,6 +467,7 @@ DUK_LOCAL duk_re_sp_t duk__match_regexp(duk_re_matcher_ctx *re_ctx, const duk_ui
 			old = re_ctx->saved[idx];
 			re_ctx->saved[idx] = sp;
 			sub_sp = duk__match_regexp(re_ctx, pc, sp);
+			DUK__RE_CHECK_ABORT(sub_sp);
 			if (DUK__RE_SP_VALID(sub_sp)) {
 				sp = sub_sp;
 				goto match;
@@ -474,6 +518,7 @@ DUK_LOCAL duk_re_sp_t duk__match_regexp(duk_re_matcher_ctx *re_ctx, const duk_ui
 			duk_memset((void *) (re_ctx->saved + idx_start), 0xffU, sizeof(duk_re_sp_t) * idx_count);
 
 			sub_sp = duk__match_regexp(re_ctx, pc, sp);
+			DUK__RE_CHECK_ABORT(sub_sp);
 			if (DUK__RE_SP_VALID(sub_sp)) {
 				/* match: keep wiped/resaved values */
 				DUK_DDD(DUK_DDDPRINT("match: keep wiped/resaved values [%ld,%ld] (captures [%ld,%ld])",
@@ -527,6 +572,7 @@ DUK_LOCAL duk_re_sp_t duk__match_regexp(duk_re_matcher_ctx *re_ctx, const duk_ui
 
 			skip = duk__bc_get_i32(re_ctx, &pc);
 			sub_sp = duk__match_regexp(re_ctx, pc, sp);
+			DUK__RE_CHECK_ABORT(sub_sp);
 			if (op == DUK_REOP_LOOKPOS) {
 				if (!DUK__RE_SP_VALID(sub_sp)) {
 					goto lookahead_fail;
@@ -537,6 +583,7 @@ DUK_LOCAL duk_re_sp_t duk__match_regexp(duk_re_matcher_ctx *re_ctx, const duk_ui
 				}
 			}
 			sub_sp = duk__match_regexp(re_ctx, pc + skip, sp);
+			DUK__RE_CHECK_ABORT(sub_sp);
 			if (DUK__RE_SP_VALID(sub_sp)) {
 				/* match: keep saves */
 				duk_pop_known(re_ctx->thr);
@@ -627,11 +674,716 @@ fail:
 	re_ctx->recursion_depth--;
 	return -1;
 
+#if defined(DUK_USE_REGEXP_PIKEVM)
+abort:
+	/* Value stack temporaries and saved[] are cleaned up by the caller. */
+	re_ctx->recursion_depth--;
+	return DUK__RE_SP_ABORT;
+#endif
+
 internal_error:
 	DUK_ERROR_INTERNAL(re_ctx->thr);
 	DUK_WO_NORETURN(return -1;);
 }
 
+/*
+ *  Pike VM executor (DUK_USE_REGEXP_PIKEVM).
+ *
+ *  Executes the same bytecode as duk__match_regexp() by simulating all
+ *  backtracking alternatives in lockstep over the input, so that execution
+ *  time is O(input length * program size) regardless of the pattern.  Only
+ *  patterns without backreferences and lookaheads (DUK_RE_FLAG_PIKEVM set
+ *  by the compiler) can be executed this way.
+ *
+ *  Threads are kept in priority order, i.e. the order in which the
+ *  backtracking matcher would try them, and a lower priority thread reaching
+ *  a state already reached by a higher priority thread at the same input
+ *  position is dropped.  Without backreferences captures don't affect
+ *  matching, so this yields the same match and captures as backtracking.
+ *  A thread looping back into a state it already visited without consuming
+ *  input is dropped too, which implements the ES empty check for quantified
+ *  atoms (the backtracking matcher hits its recursion limit instead).
+ *
+ *  Thread state is an instruction and, inside a SQGREEDY/SQMINIMAL atom, the
+ *  current iteration count.  Simple quantifier atoms never nest so a single
+ *  count is enough.  Each (instruction, count) pair has a 'slot' index used
+ *  for duplicate detection; for unbounded quantifiers counts >= qmin are
+ *  equivalent and share a slot.
+ */
+
+#if defined(DUK_USE_REGEXP_PIKEVM)
+
+/* Backtracking step budget before switching to the Pike VM: base plus
+ * a multiplier for each remaining input character.
+ */
+#define DUK__RE_PIKE_SWITCH_STEPS_BASE 10000L
+#define DUK__RE_PIKE_SWITCH_STEPS_MULT 32L
+
+/* Upper limits for Pike VM state, larger programs are left to the
+ * backtracking matcher.  Thread captures need nslots * nsaved entries
+ * for both the current and the next thread list.
+ */
+#define DUK__RE_PIKE_MAX_SLOTS 65536L
+#define DUK__RE_PIKE_MAX_CAPS  262144L
+
+typedef struct {
+	duk_uint8_t op;
+	duk_uint32_t arg1; /* CHAR: codepoint; RANGES: bytecode offset of range count;
+	                    * SAVE/WIPERANGE: saved[] index; SQxxx: qmin
+	                    */
+	duk_uint32_t arg2; /* WIPERANGE: count; SQxxx: qmax */
+	duk_uint32_t target; /* JUMP/SPLITx: jump target; SQxxx: sequel (instruction indices) */
+	duk_uint32_t sq; /* index + 1 of the enclosing SQxxx instruction, 0 if none */
+	duk_uint32_t slot; /* first slot index of the instruction */
+	duk_uint32_t offset; /* bytecode offset, for resolving jump targets */
+} duk__re_pike_instr;
+
+typedef struct {
+	duk_uint32_t ins;
+	duk_uint32_t q;
+} duk__re_pike_thread;
+
+/* Closure job: visit (ins, q), or restore saved[idx] = val when ins == DUK__RE_PIKE_RESTORE. */
+#define DUK__RE_PIKE_RESTORE 0xffffffffUL
+typedef struct {
+	duk_uint32_t ins;
+	duk_uint32_t q;
+	duk_re_sp_t val;
+} duk__re_pike_job;
+
+typedef struct {
+	duk__re_pike_thread *threads;
+	duk_re_sp_t *caps;
+	duk_uint32_t count;
+} duk__re_pike_list;
+
+typedef struct {
+	duk_re_matcher_ctx *re_ctx;
+	duk__re_pike_instr *instrs;
+	duk_uint32_t ninstrs;
+	duk_uint32_t nslots;
+	duk_uint32_t *marks; /* per slot: generation of last visit */
+	duk_uint32_t gen;
+	duk_re_sp_t *work; /* captures of the thread being expanded */
+	duk_idx_t idx_jobs; /* dynamic buffer for closure jobs */
+	duk__re_pike_job *jobs;
+	duk_uint32_t jobs_size;
+	duk_uint32_t jobs_top;
+} duk__re_pike_ctx;
+
+/* Decode bytecode into 'instrs', or just count instructions if 'instrs' is
+ * NULL.  Returns number of instructions, 0 if the program can't be executed
+ * with the Pike VM.
+ */
+DUK_LOCAL duk_uint32_t duk__pike_decode(duk_re_matcher_ctx *re_ctx, duk__re_pike_instr *instrs) {
+	const duk_uint8_t *pc;
+	duk_uint32_t n = 0;
+	duk_uint32_t sq = 0;
+	duk_uint32_t sq_end = 0;
+
+	pc = re_ctx->bytecode;
+	while (pc < re_ctx->bytecode_end) {
+		duk__re_pike_instr tmp;
+		duk_int32_t skip;
+
+		duk_memzero(&tmp, sizeof(tmp));
+		tmp.offset = (duk_uint32_t) (pc - re_ctx->bytecode);
+		if (sq != 0 && tmp.offset >= sq_end) {
+			sq = 0;
+		}
+		tmp.sq = sq;
+		tmp.op = *pc++;
+
+		switch (tmp.op) {
+		case DUK_REOP_MATCH:
+		case DUK_REOP_PERIOD:
+		case DUK_REOP_ASSERT_START:
+		case DUK_REOP_ASSERT_END:
+		case DUK_REOP_ASSERT_WORD_BOUNDARY:
+		case DUK_REOP_ASSERT_NOT_WORD_BOUNDARY: {
+			break;
+		}
+		case DUK_REOP_CHAR:
+		case DUK_REOP_SAVE: {
+			tmp.arg1 = duk__bc_get_u32(re_ctx, &pc);
+			if (tmp.op == DUK_REOP_SAVE && tmp.arg1 >= re_ctx->nsaved) {
+				return 0;
+			}
+			break;
+		}
+		case DUK_REOP_RANGES:
+		case DUK_REOP_INVRANGES: {
+			duk_uint32_t count;
+
+			tmp.arg1 = (duk_uint32_t) (pc - re_ctx->bytecode);
+			count = duk__bc_get_u32(re_ctx, &pc);
+			while (count > 0) {
+				(void) duk__bc_get_u32(re_ctx, &pc);
+				(void) duk__bc_get_u32(re_ctx, &pc);
+				count--;
+			}
+			break;
+		}
+		case DUK_REOP_JUMP:
+		case DUK_REOP_SPLIT1:
+		case DUK_REOP_SPLIT2: {
+			skip = duk__bc_get_i32(re_ctx, &pc);
+			/* Bytecode offset for now, resolved by duk__pike_resolve(). */
+			tmp.target = (duk_uint32_t) ((pc - re_ctx->bytecode) + skip);
+			break;
+		}
+		case DUK_REOP_SQMINIMAL:
+		case DUK_REOP_SQGREEDY: {
+			if (sq != 0) {
+				return 0; /* simple atoms never nest */
+			}
+			tmp.arg1 = duk__bc_get_u32(re_ctx, &pc);
+			tmp.arg2 = duk__bc_get_u32(re_ctx, &pc);
+			if (tmp.op == DUK_REOP_SQGREEDY) {
+				(void) duk__bc_get_u32(re_ctx, &pc); /* atomlen, not needed */
+			}
+			skip = duk__bc_get_i32(re_ctx, &pc);
+			if (skip <= 0) {
+				return 0;
+			}
+			sq = n + 1;
+			sq_end = (duk_uint32_t) (pc - re_ctx->bytecode) + (duk_uint32_t) skip;
+			tmp.target = sq_end;
+			break;
+		}
+		case DUK_REOP_WIPERANGE: {
+			tmp.arg1 = duk__bc_get_u32(re_ctx, &pc);
+			tmp.arg2 = duk__bc_get_u32(re_ctx, &pc);
+			if (tmp.arg2 == 0 || tmp.arg1 + tmp.arg2 > re_ctx->nsaved) {
+				return 0;
+			}
+			break;
+		}
+		default: {
+			/* Backreferences and lookaheads. */
+			return 0;
+		}
+		}
+
+		if (instrs != NULL) {
+			instrs[n] = tmp;
+		}
+		n++;
+	}
+
+	return n;
+}
+
+/* Resolve jump targets and assign slots.  Returns 0 if limits are exceeded. */
+DUK_LOCAL duk_bool_t duk__pike_resolve(duk__re_pike_ctx *pk) {
+	duk__re_pike_instr *instrs = pk->instrs;
+	duk_uint32_t i;
+	duk_uint32_t nslots = 0;
+
+	for (i = 0; i < pk->ninstrs; i++) {
+		duk__re_pike_instr *ins = instrs + i;
+		duk_uint32_t mult = 1;
+
+		switch (ins->op) {
+		case DUK_REOP_JUMP:
+		case DUK_REOP_SPLIT1:
+		case DUK_REOP_SPLIT2:
+		case DUK_REOP_SQMINIMAL:
+		case DUK_REOP_SQGREEDY: {
+			duk_uint32_t lo = 0;
+			duk_uint32_t hi = pk->ninstrs;
+
+			/* Binary search, instruction offsets are increasing. */
+			while (lo < hi) {
+				duk_uint32_t mid = lo + (hi - lo) / 2;
+				if (instrs[mid].offset < ins->target) {
+					lo = mid + 1;
+				} else {
+					hi = mid;
+				}
+			}
+			if (lo >= pk->ninstrs || instrs[lo].offset != ins->target) {
+				return 0;
+			}
+			ins->target = lo;
+			break;
+		}
+		}
+
+		if (ins->sq != 0) {
+			const duk__re_pike_instr *sq = instrs + (ins->sq - 1);
+
+			/* Iteration counts inside the atom are [0,qmax-1], or
+			 * [0,qmin] when unbounded (counts >= qmin are equivalent).
+			 */
+			mult = (sq->arg2 == DUK_RE_QUANTIFIER_INFINITE) ? sq->arg1 + 1 : sq->arg2;
+			if (mult == 0) {
+				mult = 1;
+			}
+			if (mult > (duk_uint32_t) DUK__RE_PIKE_MAX_SLOTS) {
+				return 0;
+			}
+		}
+		ins->slot = nslots;
+		nslots += mult;
+		if (nslots > (duk_uint32_t) DUK__RE_PIKE_MAX_SLOTS) {
+			return 0;
+		}
+	}
+
+	pk->nslots = nslots;
+	return 1;
+}
+
+DUK_LOCAL void duk__pike_push_job(duk__re_pike_ctx *pk, duk_uint32_t ins, duk_uint32_t q, duk_re_sp_t val) {
+	duk__re_pike_job *job;
+
+	if (pk->jobs_top >= pk->jobs_size) {
+		pk->jobs_size = pk->jobs_size * 2 + 16;
+		pk->jobs = (duk__re_pike_job *) duk_resize_buffer(pk->re_ctx->thr,
+		                                                  pk->idx_jobs,
+		                                                  sizeof(duk__re_pike_job) * (duk_size_t) pk->jobs_size);
+	}
+	job = pk->jobs + pk->jobs_top++;
+	job->ins = ins;
+	job->q = q;
+	job->val = val;
+}
+
+DUK_LOCAL void duk__pike_add_thread(duk__re_pike_ctx *pk, duk__re_pike_list *list, duk_uint32_t ins, duk_uint32_t q) {
+	duk__re_pike_thread *t = list->threads + list->count;
+
+	DUK_ASSERT(list->count < pk->nslots);
+	t->ins = ins;
+	t->q = q;
+	duk_memcpy((void *) (list->caps + (duk_size_t) list->count * pk->re_ctx->nsaved),
+	           (const void *) pk->work,
+	           sizeof(duk_re_sp_t) * pk->re_ctx->nsaved);
+	list->count++;
+}
+
+/* Continue a quantifier atom after 'q' completed iterations. */
+DUK_LOCAL void duk__pike_push_sq(duk__re_pike_ctx *pk, duk_uint32_t sq_idx, duk_uint32_t q) {
+	const duk__re_pike_instr *sq = pk->instrs + sq_idx;
+	duk_uint32_t qmin = sq->arg1;
+	duk_uint32_t qmax = sq->arg2;
+
+	if (qmax == DUK_RE_QUANTIFIER_INFINITE && q > qmin) {
+		q = qmin;
+	}
+
+	/* Jobs are pushed in reverse priority order. */
+	if (sq->op == DUK_REOP_SQGREEDY) {
+		if (q >= qmin) {
+			duk__pike_push_job(pk, sq->target, 0, 0);
+		}
+		if (q < qmax) {
+			duk__pike_push_job(pk, sq_idx + 1, q, 0);
+		}
+	} else {
+		if (q < qmax) {
+			duk__pike_push_job(pk, sq_idx + 1, q, 0);
+		}
+		if (q >= qmin) {
+			duk__pike_push_job(pk, sq->target, 0, 0);
+		}
+	}
+}
+
+/* Add thread (ins, q) with captures pk->work to 'list' at input position 'sp',
+ * following all zero-width instructions in priority order.  pk->work is
+ * unchanged on return.
+ */
+DUK_LOCAL void duk__pike_add(duk__re_pike_ctx *pk, duk__re_pike_list *list, duk_uint32_t ins_idx, duk_uint32_t q, duk_re_sp_t sp) {
+	duk_re_matcher_ctx *re_ctx = pk->re_ctx;
+
+	DUK_ASSERT(pk->jobs_top == 0);
+	duk__pike_push_job(pk, ins_idx, q, 0);
+
+	while (pk->jobs_top > 0) {
+		duk__re_pike_job job = pk->jobs[--pk->jobs_top];
+		const duk__re_pike_instr *ins;
+		duk_uint32_t slot;
+
+		if (job.ins == DUK__RE_PIKE_RESTORE) {
+			pk->work[job.q] = job.val;
+			continue;
+		}
+
+		DUK_ASSERT(job.ins < pk->ninstrs);
+		ins = pk->instrs + job.ins;
+		slot = ins->slot + job.q;
+		DUK_ASSERT(slot < pk->nslots);
+		if (pk->marks[slot] == pk->gen) {
+			continue;
+		}
+		pk->marks[slot] = pk->gen;
+
+		switch (ins->op) {
+		case DUK_REOP_JUMP: {
+			duk__pike_push_job(pk, ins->target, job.q, 0);
+			break;
+		}
+		case DUK_REOP_SPLIT1: {
+			/* prefer direct execution */
+			duk__pike_push_job(pk, ins->target, job.q, 0);
+			duk__pike_push_job(pk, job.ins + 1, job.q, 0);
+			break;
+		}
+		case DUK_REOP_SPLIT2: {
+			/* prefer jump execution */
+			duk__pike_push_job(pk, job.ins + 1, job.q, 0);
+			duk__pike_push_job(pk, ins->target, job.q, 0);
+			break;
+		}
+		case DUK_REOP_SAVE: {
+			/* Restore is popped after everything reachable from here. */
+			duk__pike_push_job(pk, DUK__RE_PIKE_RESTORE, ins->arg1, pk->work[ins->arg1]);
+			pk->work[ins->arg1] = sp;
+			duk__pike_push_job(pk, job.ins + 1, job.q, 0);
+			break;
+		}
+		case DUK_REOP_WIPERANGE: {
+			duk_uint32_t i;
+
+			for (i = ins->arg1; i < ins->arg1 + ins->arg2; i++) {
+				duk__pike_push_job(pk, DUK__RE_PIKE_RESTORE, i, pk->work[i]);
+				pk->work[i] = -1;
+			}
+			duk__pike_push_job(pk, job.ins + 1, job.q, 0);
+			break;
+		}
+		case DUK_REOP_ASSERT_START:
+		case DUK_REOP_ASSERT_END:
+		case DUK_REOP_ASSERT_WORD_BOUNDARY:
+		case DUK_REOP_ASSERT_NOT_WORD_BOUNDARY: {
+			if (duk__check_assertion(re_ctx, (duk_small_int_t) ins->op, sp)) {
+				duk__pike_push_job(pk, job.ins + 1, job.q, 0);
+			}
+			break;
+		}
+		case DUK_REOP_SQMINIMAL:
+		case DUK_REOP_SQGREEDY: {
+			duk__pike_push_sq(pk, job.ins, 0);
+			break;
+		}
+		case DUK_REOP_MATCH: {
+			if (ins->sq != 0) {
+				/* End of quantifier atom. */
+				duk__pike_push_sq(pk, ins->sq - 1, job.q + 1);
+			} else {
+				duk__pike_add_thread(pk, list, job.ins, job.q);
+			}
+			break;
+		}
+		default: {
+			/* Character matchers wait for the next step. */
+			duk__pike_add_thread(pk, list, job.ins, job.q);
+			break;
+		}
+		}
+	}
+}
+
+/* Try to match starting from 'sp' or any later offset.  Returns 1 and fills
+ * re_ctx->saved on match, 0 on no match, and -1 if the program can't be
+ * executed with the Pike VM.  Value stack is unchanged on return.
+ */
+DUK_LOCAL duk_small_int_t duk__pike_match(duk_re_matcher_ctx *re_ctx, duk_re_sp_t sp) {
+	duk_hthread *thr = re_ctx->thr;
+	duk__re_pike_ctx pk;
+	duk__re_pike_list lists[2];
+	duk__re_pike_list *clist;
+	duk__re_pike_list *nlist;
+	duk_uint32_t nsaved = re_ctx->nsaved;
+	duk_uint8_t *p;
+	duk_size_t caps_size;
+	duk_small_int_t matched = 0;
+	duk_uint32_t i;
+
+	duk_memzero(&pk, sizeof(pk));
+	pk.re_ctx = re_ctx;
+
+	pk.ninstrs = duk__pike_decode(re_ctx, NULL);
+	if (pk.ninstrs == 0) {
+		return -1;
+	}
+	pk.instrs = (duk__re_pike_instr *) duk_push_fixed_buffer_nozero(thr, sizeof(duk__re_pike_instr) * pk.ninstrs);
+	(void) duk__pike_decode(re_ctx, pk.instrs);
+	if (!duk__pike_resolve(&pk) || (duk_size_t) pk.nslots * nsaved > (duk_size_t) DUK__RE_PIKE_MAX_CAPS) {
+		duk_pop(thr);
+		return -1;
+	}
+
+	DUK_DD(DUK_DDPRINT("regexp pike vm: ninstrs=%ld, nslots=%ld, nsaved=%ld, start sp=%ld",
+	                   (long) pk.ninstrs,
+	                   (long) pk.nslots,
+	                   (long) nsaved,
+	                   (long) sp));
+
+	/* Slot marks are zeroed (generation 0 is never used), other state is
+	 * always written before being read.
+	 */
+	caps_size = sizeof(duk_re_sp_t) * (duk_size_t) pk.nslots * nsaved;
+	p = (duk_uint8_t *) duk_push_fixed_buffer_zero(thr,
+	                                               sizeof(duk_uint32_t) * pk.nslots +
+	                                                   2 * (sizeof(duk__re_pike_thread) * pk.nslots + caps_size) +
+	                                                   sizeof(duk_re_sp_t) * nsaved);
+	pk.marks = (duk_uint32_t *) (void *) p;
+	p += sizeof(duk_uint32_t) * pk.nslots;
+	for (i = 0; i < 2; i++) {
+		lists[i].threads = (duk__re_pike_thread *) (void *) p;
+		p += sizeof(duk__re_pike_thread) * pk.nslots;
+		lists[i].caps = (duk_re_sp_t *) (void *) p;
+		p += caps_size;
+		lists[i].count = 0;
+	}
+	pk.work = (duk_re_sp_t *) (void *) p;
+
+	pk.jobs_size = pk.nslots * 2 + nsaved;
+	pk.jobs = (duk__re_pike_job *) duk_push_dynamic_buffer(thr, sizeof(duk__re_pike_job) * (duk_size_t) pk.jobs_size);
+	pk.idx_jobs = duk_get_top_index(thr);
+
+	clist = lists + 0;
+	nlist = lists + 1;
+	pk.gen = 1;
+
+	for (;;) {
+		duk__re_pike_list *tmp;
+		duk_codepoint_t c;
+		duk_re_sp_t tmp_sp;
+
+		/* Start a new lowest priority thread at each offset until a
+		 * match is found: leftmost match wins.
+		 */
+		if (!matched && sp <= re_ctx->sp_end) {
+			duk_memset((void *) pk.work, 0xffU, sizeof(duk_re_sp_t) * nsaved);
+			duk__pike_add(&pk, clist, 0, 0, sp);
+		}
+		if (clist->count == 0 && (matched || sp >= re_ctx->sp_end)) {
+			break;
+		}
+
+		tmp_sp = sp;
+		c = duk__inp_get_cp(re_ctx, &tmp_sp);
+
+		pk.gen++;
+		DUK_ASSERT(pk.gen != 0);
+		nlist->count = 0;
+
+		for (i = 0; i < clist->count; i++) {
+			const duk__re_pike_thread *t = clist->threads + i;
+			const duk__re_pike_instr *ins = pk.instrs + t->ins;
+			duk_re_sp_t *caps = clist->caps + (duk_size_t) i * nsaved;
+			duk_small_int_t ok;
+
+			switch (ins->op) {
+			case DUK_REOP_MATCH: {
+				/* Lower priority threads are cut off, higher priority
+				 * threads may still override this match later.
+				 */
+				DUK_ASSERT(ins->sq == 0);
+				duk_memcpy((void *) re_ctx->saved, (const void *) caps, sizeof(duk_re_sp_t) * nsaved);
+				matched = 1;
+				goto step_done;
+			}
+			case DUK_REOP_CHAR: {
+				ok = (c == (duk_codepoint_t) ins->arg1);
+				break;
+			}
+			case DUK_REOP_PERIOD: {
+				ok = (c >= 0 && !duk_unicode_is_line_terminator(c));
+				break;
+			}
+			case DUK_REOP_RANGES:
+			case DUK_REOP_INVRANGES: {
+				const duk_uint8_t *pc = re_ctx->bytecode + ins->arg1;
+
+				ok = 0;
+				if (c >= 0) {
+					ok = duk__match_ranges(re_ctx, &pc, c);
+					if (ins->op == DUK_REOP_INVRANGES) {
+						ok = !ok;
+					}
+				}
+				break;
+			}
+			default: {
+				DUK_D(DUK_DPRINT("internal error, regexp pike vm opcode error: %ld", (long) ins->op));
+				DUK_ERROR_INTERNAL(thr);
+				DUK_WO_NORETURN(return 0;);
+			}
+			}
+
+			if (ok) {
+				duk_memcpy((void *) pk.work, (const void *) caps, sizeof(duk_re_sp_t) * nsaved);
+				duk__pike_add(&pk, nlist, t->ins + 1, t->q, sp + 1);
+			}
+		}
+
+	step_done:
+		tmp = clist;
+		clist = nlist;
+		nlist = tmp;
+		sp++;
+	}
+
+	duk_pop_3_known(thr);
+	return matched;
+}
+
+#endif /* DUK_USE_REGEXP_PIKEVM */
+
+/*
+ *  Match start scanning.
+ *
+ *  If the compiler found a required literal prefix or a first character set
+ *  (see duk__emit_scan_info()), input offsets which cannot start a match are
+ *  skipped by scanning the WTF-8 input bytes directly.  The prefix contains
+ *  no surrogates so a byte match is always a character match, and WTF-8 is
+ *  self-synchronizing so a match can't start in the middle of a codepoint.
+ */
+
+#if defined(DUK_USE_REGEXP_PREFIX_SCAN)
+/* Use Boyer-Moore-Horspool instead of memchr() for long enough prefixes
+ * and inputs; the shift table setup isn't worth it otherwise.
+ */
+#define DUK__RE_BMH_MIN_PREFIX 4
+#define DUK__RE_BMH_MIN_INPUT  256
+
+DUK_LOCAL void duk__scan_init(duk_re_matcher_ctx *re_ctx, const duk_uint8_t **pc) {
+	if (re_ctx->re_flags & DUK_RE_FLAG_PREFIX) {
+		duk_uint32_t n;
+
+		n = duk__bc_get_u32(re_ctx, pc);
+		if (n == 0 || n > DUK_RE_PREFIX_MAX_CHARS) {
+			goto internal_error;
+		}
+		while (n-- > 0) {
+			duk_uint32_t cp;
+
+			cp = duk__bc_get_u32(re_ctx, pc);
+			if (cp >= 0xd800UL) {
+				goto internal_error;
+			}
+			re_ctx->prefix_len += (duk_size_t) duk_unicode_encode_xutf8((duk_ucodepoint_t) cp,
+			                                                            re_ctx->prefix + re_ctx->prefix_len);
+			DUK_ASSERT(re_ctx->prefix_len <= DUK_RE_PREFIX_MAX_BYTES);
+		}
+
+		if (re_ctx->prefix_len >= DUK__RE_BMH_MIN_PREFIX &&
+		    (duk_size_t) (re_ctx->input_end - re_ctx->input) >= DUK__RE_BMH_MIN_INPUT) {
+			duk_size_t i;
+
+			DUK_ASSERT(re_ctx->prefix_len <= 0xffU);
+			duk_memset((void *) re_ctx->skip, (duk_small_int_t) re_ctx->prefix_len, sizeof(re_ctx->skip));
+			for (i = 0; i < re_ctx->prefix_len - 1; i++) {
+				re_ctx->skip[re_ctx->prefix[i]] = (duk_uint8_t) (re_ctx->prefix_len - 1 - i);
+			}
+			re_ctx->has_skip = 1;
+		}
+	} else if (re_ctx->re_flags & DUK_RE_FLAG_FIRSTSET) {
+		duk_small_uint_t i;
+
+		for (i = 0; i < 4; i++) {
+			re_ctx->firstset[i] = duk__bc_get_u32(re_ctx, pc);
+		}
+		re_ctx->firstset_nonascii = (duk_bool_t) (duk__bc_get_u32(re_ctx, pc) != 0);
+		re_ctx->has_firstset = 1;
+	}
+	return;
+
+internal_error:
+	DUK_ERROR_INTERNAL(re_ctx->thr);
+	DUK_WO_NORETURN(return;);
+}
+
+/* Find the first offset >= sp which may start a match, or return -1 if no
+ * offset can.  Every match consumes at least one character so the end of
+ * input never needs to be attempted.
+ */
+DUK_LOCAL duk_re_sp_t duk__scan_start(duk_re_matcher_ctx *re_ctx, duk_re_sp_t sp) {
+	duk_uint32_t boff;
+	duk_uint32_t coff;
+	const duk_uint8_t *p_start;
+	const duk_uint8_t *p_end;
+	const duk_uint8_t *p;
+
+	if (sp >= re_ctx->sp_end) {
+		return -1;
+	}
+	duk_strcache_scan_char2byte_wtf8(re_ctx->thr, re_ctx->h_input, (duk_uint32_t) sp, &boff, &coff);
+	if ((duk_re_sp_t) coff != sp) {
+		/* Low surrogate of a non-BMP codepoint, just attempt it. */
+		return sp;
+	}
+	p_start = re_ctx->input + boff;
+	p_end = re_ctx->input_end;
+
+	if (re_ctx->prefix_len > 0) {
+		duk_size_t len = re_ctx->prefix_len;
+
+		if ((duk_size_t) (p_end - p_start) < len) {
+			return -1;
+		}
+		if (re_ctx->has_skip) {
+			const duk_uint8_t *p_last = p_end - len;
+			duk_uint8_t t_last = re_ctx->prefix[len - 1];
+
+			p = p_start;
+			while (p <= p_last) {
+				duk_uint8_t t = p[len - 1];
+
+				if (t == t_last && duk_memcmp((const void *) p, (const void *) re_ctx->prefix, len - 1) == 0) {
+					goto found;
+				}
+				p += re_ctx->skip[t];
+			}
+			return -1;
+		} else {
+			p = p_start;
+			for (;;) {
+				duk_size_t avail = (duk_size_t) (p_end - p);
+
+				if (avail < len) {
+					return -1;
+				}
+				p = (const duk_uint8_t *) duk_memchr((const void *) p, re_ctx->prefix[0], avail - len + 1);
+				if (p == NULL) {
+					return -1;
+				}
+				if (duk_memcmp_unsafe((const void *) (p + 1), (const void *) (re_ctx->prefix + 1), len - 1) == 0) {
+					goto found;
+				}
+				p++;
+			}
+		}
+	} else {
+		DUK_ASSERT(re_ctx->has_firstset);
+
+		for (p = p_start; p < p_end; p++) {
+			duk_uint8_t t = *p;
+
+			if (t < 0x80U) {
+				if (re_ctx->firstset[t >> 5] & ((duk_uint32_t) 1U << (t & 0x1fU))) {
+					goto found;
+				}
+			} else if (t >= 0xc0U && re_ctx->firstset_nonascii) {
+				/* Non-ASCII initial byte, continuation bytes are skipped. */
+				goto found;
+			}
+		}
+		return -1;
+	}
+
+found:
+	if (duk_hstring_is_ascii(re_ctx->h_input)) {
+		return sp + (duk_re_sp_t) (p - p_start);
+	}
+	return sp + (duk_re_sp_t) duk_unicode_wtf8_charlength(p_start, (duk_size_t) (p - p_start));
+}
+#endif /* DUK_USE_REGEXP_PREFIX_SCAN */
+
 /*
  *  Exposed matcher function which provides the semantics of RegExp.prototype.exec().
  *
@@ -658,6 +1410,9 @@ DUK_LOCAL void duk__regexp_match_helper(duk_hthread *thr, duk_small_int_t force_
 	duk_uint_fast32_t i;
 	double d;
 	duk_uint32_t char_offset;
+#if defined(DUK_USE_REGEXP_PIKEVM)
+	duk_idx_t idx_top;
+#endif
 
 	DUK_ASSERT(thr != NULL);
 
@@ -691,6 +1446,11 @@ DUK_LOCAL void duk__regexp_match_helper(duk_hthread *thr, duk_small_int_t force_
 	 *
 	 *    uint   flags
 	 *    uint   nsaved (even, 2n+2 where n = num captures)
+	 *
+	 *  followed by optional match start scan info:
+	 *
+	 *    uint   prefix length n, uint[n] prefix codepoints  (DUK_RE_FLAG_PREFIX)
+	 *    uint[4] ASCII first set, uint non-ASCII flag      (DUK_RE_FLAG_FIRSTSET)
 	 */
 
 	/* [ ... re_obj input bc ] */
@@ -714,6 +1474,9 @@ DUK_LOCAL void duk__regexp_match_helper(duk_hthread *thr, duk_small_int_t force_
 	pc = re_ctx.bytecode;
 	re_ctx.re_flags = duk__bc_get_u32(&re_ctx, &pc);
 	re_ctx.nsaved = duk__bc_get_u32(&re_ctx, &pc);
+#if defined(DUK_USE_REGEXP_PREFIX_SCAN)
+	duk__scan_init(&re_ctx, &pc);
+#endif
 	re_ctx.bytecode = pc;
 
 	DUK_ASSERT(DUK_RE_FLAG_GLOBAL < 0x10000UL); /* must fit into duk_small_int_t */
@@ -780,6 +1543,28 @@ DUK_LOCAL void duk__regexp_match_helper(duk_hthread *thr, duk_small_int_t force_
 	DUK_ASSERT(char_offset <= duk_hstring_get_charlen(h_input));
 	sp = (duk_re_sp_t) char_offset;
 
+#if defined(DUK_USE_REGEXP_PIKEVM)
+	/* Backtracking is usually fastest, but patterns which the Pike VM can
+	 * execute get a step budget linear in the input length.  If backtracking
+	 * runs out of the budget (or recursion depth), the match is finished
+	 * with the Pike VM which has a linear worst case.
+	 */
+	idx_top = duk_get_top(thr);
+	if (re_ctx.re_flags & DUK_RE_FLAG_PIKEVM) {
+		duk_uint32_t budget;
+
+		budget = (duk_uint32_t) DUK__RE_PIKE_SWITCH_STEPS_MULT * (duk_uint32_t) (re_ctx.sp_end - sp + 1);
+		if (budget / (duk_uint32_t) DUK__RE_PIKE_SWITCH_STEPS_MULT != (duk_uint32_t) (re_ctx.sp_end - sp + 1) ||
+		    budget > re_ctx.steps_limit - (duk_uint32_t) DUK__RE_PIKE_SWITCH_STEPS_BASE) {
+			budget = re_ctx.steps_limit;
+		} else {
+			budget += (duk_uint32_t) DUK__RE_PIKE_SWITCH_STEPS_BASE;
+		}
+		re_ctx.steps_limit = budget;
+		re_ctx.pikevm_switch = 1;
+	}
+#endif
+
 	/*
 	 *  Match loop.
 	 *
@@ -798,6 +1583,18 @@ DUK_LOCAL void duk__regexp_match_helper(duk_hthread *thr, duk_small_int_t force_
 		/* Note: re_ctx.steps is intentionally not reset, it applies to the entire unanchored match */
 		DUK_ASSERT(re_ctx.recursion_depth == 0);
 
+#if defined(DUK_USE_REGEXP_PREFIX_SCAN)
+		if (re_ctx.re_flags & (DUK_RE_FLAG_PREFIX | DUK_RE_FLAG_FIRSTSET)) {
+			sp = duk__scan_start(&re_ctx, sp);
+			if (sp < 0) {
+				DUK_DDD(DUK_DDDPRINT("no possible match start after char offset %ld", (long) char_offset));
+				break;
+			}
+			DUK_ASSERT((duk_uint32_t) sp >= char_offset);
+			char_offset = (duk_uint32_t) sp;
+		}
+#endif
+
 		DUK_DDD(DUK_DDDPRINT("attempt match at char offset %ld; %ld (len %ld)",
 		                     (long) char_offset,
 		                     (long) sp,
@@ -822,11 +1619,49 @@ DUK_LOCAL void duk__regexp_match_helper(duk_hthread *thr, duk_small_int_t force_
 		 *      at every non-zero offset.
 		 */
 
+#if defined(DUK_USE_REGEXP_PIKEVM)
+		{
+			duk_re_sp_t res_sp;
+
+			res_sp = duk__match_regexp(&re_ctx, re_ctx.bytecode, sp);
+			if (DUK__RE_SP_VALID(res_sp)) {
+				DUK_DDD(DUK_DDDPRINT("match at offset %ld", (long) char_offset));
+				match = 1;
+				break;
+			}
+			if (res_sp == DUK__RE_SP_ABORT) {
+				duk_small_int_t pike_res;
+
+				DUK_DD(DUK_DDPRINT("regexp backtracking budget exceeded at offset %ld, switch to pike vm",
+				                   (long) char_offset));
+				duk_set_top(thr, idx_top);
+				re_ctx.recursion_depth = 0;
+				duk_memset((void *) re_ctx.saved, 0xffU, sizeof(duk_re_sp_t) * re_ctx.nsaved);
+				pike_res = duk__pike_match(&re_ctx, sp);
+				if (pike_res >= 0) {
+					if (pike_res > 0) {
+						DUK_ASSERT(DUK__RE_SP_VALID(re_ctx.saved[0]));
+						char_offset = (duk_uint32_t) re_ctx.saved[0];
+						match = 1;
+					}
+					break;
+				}
+
+				/* Program too large for the Pike VM, continue backtracking
+				 * with normal limits (retrying the current offset).
+				 */
+				re_ctx.steps_limit = DUK_RE_EXECUTE_STEPS_LIMIT;
+				re_ctx.pikevm_switch = 0;
+				continue;
+			}
+		}
+#else
 		if (DUK__RE_SP_VALID(duk__match_regexp(&re_ctx, re_ctx.bytecode, sp))) {
 			DUK_DDD(DUK_DDDPRINT("match at offset %ld", (long) char_offset));
 			match = 1;
 			break;
 		}
+#endif
 
 		/* advance by one character (code point) and one char_offset */
 		char_offset++;
@@ -36,6 +36,7 @@ const sourceFiles = [
     'duk_bi_function.c',
     'duk_bi_global.c',
     'duk_bi_json.c',
+    'duk_bi_map.c',
     'duk_bi_math.c',
     'duk_bi_number.c',
     'duk_bi_object.c',
@@ -86,6 +87,8 @@ const sourceFiles = [
     'duk_heap_refcount.c',
     'duk_heap_stringcache.c',
     'duk_heap_stringtable.c',
+    'duk_hmap.c',
+    'duk_hmap.h',
     'duk_hnatfunc.h',
     'duk_hobject_alloc.c',
     'duk_hobject_array.c',
@@ -98,7 +101,10 @@ const sourceFiles = [
     'duk_hobject_props.c',
     'duk_hobject_proxy.c',
     'duk_hobject_resize.c',
+    'duk_hpromise.h',
     'duk_hproxy.h',
+    'duk_hshape.c',
+    'duk_hshape.h',
     'duk_hstring.h',
     'duk_hstring_assert.c',
     'duk_hstring_misc.c',
@@ -133,9 +139,12 @@ const sourceFiles = [
     'duk_prop_getown.c',
     'duk_prop.h',
     'duk_prop_has.c',
+    'duk_prop_icache.c',
     'duk_prop_ownpropkeys.c',
     'duk_prop_set.c',
     'duk_prop_util.c',
+    'duk_profiler.c',
+    'duk_profiler.h',
     'duk_refcount.h',
     'duk_regexp_compiler.c',
     'duk_regexp_executor.c',
@@ -89,6 +89,7 @@ static duk_ret_t test_func(duk_context *ctx, void *udata) {
 	(void) duk_free(ctx, NULL);
 	(void) duk_freeze(ctx, 0);
 	(void) duk_gc(ctx, 0);
+	(void) duk_gc_step(ctx, 0);
 	duk_generic_error(ctx, "dummy");
 	duk_generic_error_va(ctx, "dummy", dummy_ap);
 	(void) duk_get_boolean(ctx, 0);
@@ -225,6 +226,9 @@ static duk_ret_t test_func(duk_context *ctx, void *udata) {
 	(void) duk_pop_3(ctx);
 	(void) duk_pop_n(ctx, 0);
 	(void) duk_pop(ctx);
+	(void) duk_profiler_dump(ctx, 0);
+	(void) duk_profiler_start(ctx, 0);
+	(void) duk_profiler_stop(ctx);
 	(void) duk_pull(ctx, 0);
 	(void) duk_push_array(ctx);
 	(void) duk_push_bare_object(ctx);
@@ -315,6 +319,7 @@ static duk_ret_t test_func(duk_context *ctx, void *udata) {
 	(void) duk_require_valid_index(ctx, 0);
 	(void) duk_resize_buffer(ctx, 0, 0);
 	(void) duk_resume(ctx, NULL);
+	(void) duk_run_jobs(ctx, 0);
 	(void) duk_safe_call(ctx, NULL, NULL, 0, 0);
 	(void) duk_safe_to_lstring(ctx, 0, NULL);
 	(void) duk_safe_to_stacktrace(ctx, 0);
@@ -0,0 +1,80 @@
+/*
+ *  DUK_USE_GC_FREE_BATCH(): memory released by mark-and-sweep is handed
+ *  to the application in batches.
+ */
+
+/*---
+duktape_config:
+  DUK_USE_GC_FREE_BATCH:
+    verbatim: "void test_gc_free_batch(void *udata, void **ptrs, duk_size_t count);\n#define DUK_USE_GC_FREE_BATCH(udata,ptrs,count) test_gc_free_batch((udata), (ptrs), (count))"
+---*/
+
+/*===
+*** test_basic (duk_safe_call)
+batches: 1
+pointers: 1
+max batch ok: 1
+no batches without garbage: 1
+finalized: 1
+final top: 0
+==> rc=0, result='undefined'
+===*/
+
+static long batch_count = 0;
+static long ptr_count = 0;
+static long max_count = 0;
+
+/* Default allocator is in use, so free the batch with free(). */
+void test_gc_free_batch(void *udata, void **ptrs, duk_size_t count) {
+	duk_size_t i;
+
+	(void) udata;
+
+	batch_count++;
+	ptr_count += (long) count;
+	if ((long) count > max_count) {
+		max_count = (long) count;
+	}
+	for (i = 0; i < count; i++) {
+		free(ptrs[i]);
+	}
+	free((void *) ptrs);
+}
+
+static duk_ret_t test_basic(duk_context *ctx, void *udata) {
+	long prev;
+
+	(void) udata;
+
+	duk_gc(ctx, 0);
+	batch_count = 0;
+	ptr_count = 0;
+	duk_eval_string_noresult(ctx,
+		"var finalized = 0;\n"
+		"for (var i = 0; i < 10000; i++) { var o = { i: i, arr: [ i ] }; o.self = o; }\n"
+		"(function () {\n"
+		"    var f = {}; f.self = f;\n"
+		"    Duktape.fin(f, function () { finalized++; });\n"
+		"})();\n");
+	duk_gc(ctx, 0);
+	printf("batches: %d\n", (int) (batch_count > 1));
+	printf("pointers: %d\n", (int) (ptr_count >= 30000));
+	printf("max batch ok: %d\n", (int) (max_count > 0 && max_count <= 1024));
+
+	/* Finalizer ran on the previous gc; the object is freed now. */
+	duk_gc(ctx, 0);
+	prev = batch_count;
+	duk_gc(ctx, 0);
+	printf("no batches without garbage: %d\n", (int) (batch_count == prev));
+
+	duk_eval_string(ctx, "finalized");
+	printf("finalized: %ld\n", (long) duk_get_int(ctx, -1));
+	duk_pop(ctx);
+
+	printf("final top: %ld\n", (long) duk_get_top(ctx));
+	return 0;
+}
+
+void test(duk_context *ctx) {
+	TEST_SAFE_CALL(test_basic);
+}
@@ -0,0 +1,76 @@
+/*
+ *  duk_gc_step()
+ */
+
+/*---
+duktape_config:
+  DUK_USE_INCREMENTAL_GC: true
+---*/
+
+/*===
+*** test_basic (duk_safe_call)
+cycle done: 1
+multiple steps: 1
+finalized: 1
+live: 1234
+final top: 0
+==> rc=0, result='undefined'
+===*/
+
+static duk_ret_t test_basic(duk_context *ctx, void *udata) {
+	long steps = 0;
+
+	(void) udata;
+
+	duk_eval_string_noresult(ctx,
+		"var finalized = 0;\n"
+		"var live = [];\n"
+		"for (var i = 0; i < 10000; i++) { live.push({ i: i }); }\n"
+		"live.length = 1234;\n"
+		"(function () {\n"
+		"    var o = {}; o.self = o;\n"
+		"    Duktape.fin(o, function () { finalized++; });\n"
+		"})();\n");
+
+	/* Run one full cycle in small steps. */
+	while (duk_gc_step(ctx, 100)) {
+		steps++;
+	}
+	printf("cycle done: 1\n");
+	printf("multiple steps: %d\n", (int) (steps > 1));
+
+	duk_eval_string(ctx, "finalized");
+	printf("finalized: %ld\n", (long) duk_get_int(ctx, -1));
+	duk_pop(ctx);
+	duk_eval_string(ctx, "live.length");
+	printf("live: %ld\n", (long) duk_get_int(ctx, -1));
+	duk_pop(ctx);
+
+	printf("final top: %ld\n", (long) duk_get_top(ctx));
+	return 0;
+}
+
+/*===
+*** test_default_budget (duk_safe_call)
+done
+final top: 0
+==> rc=0, result='undefined'
+===*/
+
+static duk_ret_t test_default_budget(duk_context *ctx, void *udata) {
+	(void) udata;
+
+	/* Zero budget uses a default step size. */
+	while (duk_gc_step(ctx, 0)) {
+		;
+	}
+	duk_gc(ctx, 0);
+	printf("done\n");
+	printf("final top: %ld\n", (long) duk_get_top(ctx));
+	return 0;
+}
+
+void test(duk_context *ctx) {
+	TEST_SAFE_CALL(test_basic);
+	TEST_SAFE_CALL(test_default_budget);
+}
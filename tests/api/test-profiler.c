@@ -0,0 +1,138 @@
+/*
+ *  duk_profiler_start(), duk_profiler_stop(), duk_profiler_dump()
+ */
+
+/*---
+duktape_config:
+  DUK_USE_INTERRUPT_COUNTER: true
+  DUK_USE_PROFILER: true
+---*/
+
+/*===
+*** test_stacks (duk_safe_call)
+empty dump: ''
+has outer;inner: 1
+has native frame: 1
+lines well formed: 1
+samples >= 100: 1
+final top: 0
+==> rc=0, result='undefined'
+*** test_opcodes (duk_safe_call)
+has opcode lines: 1
+lines well formed: 1
+final top: 0
+==> rc=0, result='undefined'
+*** test_stop_restart (duk_safe_call)
+samples kept after stop: 1
+no samples while stopped: 1
+restart clears samples: 1
+final top: 0
+==> rc=0, result='undefined'
+===*/
+
+static const char *test_code =
+	"function inner(n) { var s = 0; for (var i = 0; i < n; i++) { s += i; } return s; }\n"
+	"function outer() { var t = 0; for (var j = 0; j < 200; j++) { t += inner(500); } return t; }\n"
+	"function sorter() { [ 3, 1, 2 ].sort(function cmp(a, b) { inner(2000); return a - b; }); }\n"
+	"outer(); sorter();\n";
+
+/* Check each line is '<key> <count>' and return the sum of counts, or -1. */
+static long check_lines(duk_context *ctx, duk_idx_t idx) {
+	idx = duk_normalize_index(ctx, idx);
+	duk_push_string(ctx,
+	                "(function (d) {\n"
+	                "    var sum = 0;\n"
+	                "    var lines = d.split('\\n');\n"
+	                "    if (lines.pop() !== '') { return -1; }\n"
+	                "    for (var i = 0; i < lines.length; i++) {\n"
+	                "        var m = /^([^\\n]+) (\\d+)$/.exec(lines[i]);\n"
+	                "        if (!m) { return -1; }\n"
+	                "        sum += Number(m[2]);\n"
+	                "    }\n"
+	                "    return sum;\n"
+	                "})");
+	duk_eval(ctx);
+	duk_dup(ctx, idx);
+	duk_call(ctx, 1);
+	return (long) duk_get_int(ctx, -1);
+}
+
+static duk_ret_t test_stacks(duk_context *ctx, void *udata) {
+	const char *dump;
+	long sum;
+
+	(void) udata;
+
+	duk_profiler_dump(ctx, 0);
+	printf("empty dump: '%s'\n", duk_get_string(ctx, -1));
+	duk_pop(ctx);
+
+	duk_profiler_start(ctx, 100);
+	duk_push_string(ctx, test_code);
+	duk_push_string(ctx, "prof.js");
+	duk_compile(ctx, 0);
+	duk_call(ctx, 0);
+	duk_pop(ctx);
+	duk_profiler_stop(ctx);
+
+	duk_profiler_dump(ctx, 0);
+	dump = duk_get_string(ctx, -1);
+	printf("has outer;inner: %d\n", (strstr(dump, "outer (prof.js:2);inner (prof.js:1)") != NULL ? 1 : 0));
+	printf("has native frame: %d\n", (strstr(dump, "sort (native);cmp (prof.js:3);inner (prof.js:1)") != NULL ? 1 : 0));
+	sum = check_lines(ctx, -1);
+	printf("lines well formed: %d\n", (sum >= 0 ? 1 : 0));
+	printf("samples >= 100: %d\n", (sum >= 100 ? 1 : 0));
+	duk_pop_2(ctx);
+
+	printf("final top: %ld\n", (long) duk_get_top(ctx));
+	return 0;
+}
+
+static duk_ret_t test_opcodes(duk_context *ctx, void *udata) {
+	const char *dump;
+
+	(void) udata;
+
+	duk_profiler_start(ctx, 0);
+	duk_eval_string_noresult(ctx, "for (var i = 0; i < 1e5; i++) { }");
+	duk_profiler_stop(ctx);
+
+	duk_profiler_dump(ctx, DUK_PROFILER_DUMP_OPCODES);
+	dump = duk_get_string(ctx, -1);
+	printf("has opcode lines: %d\n", (strlen(dump) > 0 ? 1 : 0));
+	printf("lines well formed: %d\n", (check_lines(ctx, -1) > 0 ? 1 : 0));
+	duk_pop_2(ctx);
+
+	printf("final top: %ld\n", (long) duk_get_top(ctx));
+	return 0;
+}
+
+static duk_ret_t test_stop_restart(duk_context *ctx, void *udata) {
+	(void) udata;
+
+	duk_profiler_start(ctx, 10);
+	duk_eval_string_noresult(ctx, "for (var i = 0; i < 1e4; i++) { }");
+	duk_profiler_stop(ctx);
+	duk_profiler_dump(ctx, 0);
+	printf("samples kept after stop: %d\n", (duk_get_length(ctx, -1) > 0 ? 1 : 0));
+
+	duk_eval_string_noresult(ctx, "for (var i = 0; i < 1e4; i++) { }");
+	duk_profiler_dump(ctx, 0);
+	printf("no samples while stopped: %d\n", (duk_equals(ctx, -1, -2) ? 1 : 0));
+	duk_pop_2(ctx);
+
+	duk_profiler_start(ctx, 10);
+	duk_profiler_stop(ctx);
+	duk_profiler_dump(ctx, 0);
+	printf("restart clears samples: %d\n", (duk_get_length(ctx, -1) == 0 ? 1 : 0));
+	duk_pop(ctx);
+
+	printf("final top: %ld\n", (long) duk_get_top(ctx));
+	return 0;
+}
+
+void test(duk_context *ctx) {
+	TEST_SAFE_CALL(test_stacks);
+	TEST_SAFE_CALL(test_opcodes);
+	TEST_SAFE_CALL(test_stop_restart);
+}
@@ -0,0 +1,79 @@
+/*
+ *  duk_run_jobs()
+ */
+
+/*---
+duktape_config:
+  DUK_USE_PROMISE_BUILTIN: true
+---*/
+
+/*===
+*** test_basic (duk_safe_call)
+no jobs: 0
+script done
+pending: 1
+then: 1
+pending: 1
+then: 2
+pending: 0
+final top: 0
+==> rc=0, result='undefined'
+===*/
+
+static duk_ret_t test_basic(duk_context *ctx, void *udata) {
+	duk_bool_t rc;
+
+	(void) udata;
+
+	rc = duk_run_jobs(ctx, -1);
+	printf("no jobs: %d\n", (int) rc);
+
+	/* Jobs are not run automatically. */
+	duk_eval_string_noresult(ctx,
+		"Promise.resolve(1).then(function (v) { print('then:', v); return v + 1; })\n"
+		"    .then(function (v) { print('then:', v); });\n"
+		"print('script done');");
+
+	/* First reaction job queues the second. */
+	rc = duk_run_jobs(ctx, 0);
+	printf("pending: %d\n", (int) rc);
+	rc = duk_run_jobs(ctx, 1);
+	printf("pending: %d\n", (int) rc);
+	rc = duk_run_jobs(ctx, -1);
+	printf("pending: %d\n", (int) rc);
+
+	printf("final top: %ld\n", (long) duk_get_top(ctx));
+	return 0;
+}
+
+/*===
+*** test_handler_error (duk_safe_call)
+catch: Error: aiee
+pending: 0
+final top: 1
+==> rc=0, result='undefined'
+===*/
+
+static duk_ret_t test_handler_error(duk_context *ctx, void *udata) {
+	duk_bool_t rc;
+
+	(void) udata;
+
+	/* Handler errors reject the derived Promise and don't propagate.
+	 * Value stack below the call is untouched.
+	 */
+	duk_push_string(ctx, "dummy");
+	duk_eval_string_noresult(ctx,
+		"var P = Promise.resolve().then(function () { throw new Error('aiee'); });\n"
+		"P.catch(function (e) { print('catch:', String(e)); });");
+	rc = duk_run_jobs(ctx, -1);
+	printf("pending: %d\n", (int) rc);
+
+	printf("final top: %ld\n", (long) duk_get_top(ctx));
+	return 0;
+}
+
+void test(duk_context *ctx) {
+	TEST_SAFE_CALL(test_basic);
+	TEST_SAFE_CALL(test_handler_error);
+}
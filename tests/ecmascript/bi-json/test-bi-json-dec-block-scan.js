@@ -0,0 +1,118 @@
+/*
+ *  JSON.parse() scans string contents and whitespace runs in blocks when
+ *  DUK_USE_JSON_DEC_SIMD is enabled.  Exercise quotes, escapes, control
+ *  characters, and end of input at every offset relative to a block.
+ */
+
+/*===
+quote 0 64
+escape 0 64
+nonascii 0 64
+control SyntaxError SyntaxError
+unterminated SyntaxError SyntaxError
+whitespace 0 64
+ws-mixed [1,2]
+ws-trailing 1
+ws-invalid SyntaxError
+long 100000 true
+===*/
+
+function rep(s, n) {
+    return new Array(n + 1).join(s);
+}
+
+function test() {
+    var i, fails, res, first, last, txt;
+
+    // Closing quote at offsets 0...63.
+    fails = 0;
+    for (i = 0; i < 64; i++) {
+        if (JSON.parse('"' + rep('x', i) + '"') !== rep('x', i)) {
+            fails++;
+        }
+    }
+    print('quote', fails, i);
+
+    // Escape at offsets 0...63, followed by more plain text.
+    fails = 0;
+    for (i = 0; i < 64; i++) {
+        res = JSON.parse('"' + rep('y', i) + '\\n\\u0041' + rep('z', 70 - i) + '"');
+        if (res !== rep('y', i) + '\nA' + rep('z', 70 - i)) {
+            fails++;
+        }
+    }
+    print('escape', fails, i);
+
+    // Non-ASCII characters are copied through as is.
+    fails = 0;
+    for (i = 0; i < 64; i++) {
+        txt = rep('ä', i) + '€' + rep('😀', 64 - i);
+        if (JSON.parse(JSON.stringify(txt)) !== txt) {
+            fails++;
+        }
+    }
+    print('nonascii', fails, i);
+
+    // Control characters are rejected at any offset; the error message
+    // includes the offset so compare it too.
+    first = null;
+    last = null;
+    for (i = 0; i < 64; i++) {
+        try {
+            JSON.parse('"' + rep('w', i) + '\u0001' + rep('w', 20) + '"');
+            print('never here');
+        } catch (e) {
+            if (e.message.indexOf(String(i + 2)) < 0) {
+                print('offset mismatch', i, e.message);
+            }
+            if (first === null) {
+                first = e.name;
+            }
+            last = e.name;
+        }
+    }
+    print('control', first, last);
+
+    // Unterminated strings end at the NUL terminator at any offset.
+    first = null;
+    last = null;
+    for (i = 0; i < 64; i++) {
+        try {
+            JSON.parse('"' + rep('v', i));
+            print('never here');
+        } catch (e) {
+            if (first === null) {
+                first = e.name;
+            }
+            last = e.name;
+        }
+    }
+    print('unterminated', first, last);
+
+    // Whitespace runs of varying length.
+    fails = 0;
+    for (i = 0; i < 64; i++) {
+        res = JSON.parse(rep(' ', i) + '[' + rep(' ', i) + '1' + rep('\n', i) + ']' + rep(' ', i));
+        if (res.length !== 1 || res[0] !== 1) {
+            fails++;
+        }
+    }
+    print('whitespace', fails, i);
+
+    print('ws-mixed', JSON.stringify(JSON.parse('[' + rep(' \t\r\n', 20) + '1,' + rep(' ', 33) + '\t2' + rep('\r\n', 17) + ']')));
+    print('ws-trailing', JSON.parse('1' + rep(' ', 48)));
+
+    try {
+        // Vertical tab is not JSON whitespace.
+        JSON.parse('[' + rep(' ', 20) + '\u000b' + rep(' ', 20) + '1]');
+        print('never here');
+    } catch (e) {
+        print('ws-invalid', e.name);
+    }
+
+    txt = rep('abcdefghij', 10000);
+    res = JSON.parse('"' + txt + '"');
+    print('long', res.length, res === txt);
+}
+
+test();
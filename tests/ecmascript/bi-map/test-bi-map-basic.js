@@ -0,0 +1,65 @@
+/*
+ *  Map basic behavior: SameValueZero keys, insertion order, size.
+ */
+
+/*===
+4 a 2 nan zero true zero
+b 4
+true false 3
+1 b true
+NaN nan true
+0 zero true
+undefined false
+0
+[object Map]
+bar idx 0 0,foo
+0 Map 2 1 1
+TypeError
+TypeError
+TypeError
+===*/
+
+function test() {
+    var m, obj;
+
+    m = new Map([ [ 1, 'a' ], [ 'x', 2 ], [ NaN, 'nan' ], [ -0, 'zero' ] ]);
+    print(m.size, m.get(1), m.get('x'), m.get(NaN), m.get(0), m.has(+0), m.get(-0));
+
+    print(m.set(1, 'b') === m ? m.get(1) : 'wrong retval', m.size);
+    print(m.delete('x'), m.delete('x'), m.size);
+    m.forEach(function (v, k, map) {
+        print(k, v, map === m);
+    });
+
+    obj = {};
+    m.set(obj, 'obj');
+    print(m.get({}), m.has('1'));
+    m.clear();
+    print(m.size);
+
+    print(Object.prototype.toString.call(m));
+
+    // Map instances are otherwise ordinary objects.
+    m.foo = 'bar';
+    m[0] = 'idx';
+    print(m.foo, m[0], m.size, Object.keys(m).join());
+    print(Map.length, Map.name, Map.prototype.set.length, Map.prototype.get.length, Map.prototype.forEach.length);
+
+    try {
+        Map();
+    } catch (e) {
+        print(e.name);
+    }
+    try {
+        Map.prototype.get.call(new Set(), 1);
+    } catch (e) {
+        print(e.name);
+    }
+    try {
+        new Map([ 1 ]);
+    } catch (e) {
+        print(e.name);
+    }
+}
+
+test();
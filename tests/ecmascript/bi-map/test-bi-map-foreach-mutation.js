@@ -0,0 +1,81 @@
+/*
+ *  Entries added during forEach() are visited, deleted ones are skipped,
+ *  also when the collection grows or is cleared during the loop.
+ */
+
+/*===
+
+0
+boom
+2 3
+3 y
+visited 1000
+===*/
+
+function test() {
+    var s, m, arr, n, i;
+
+    s = new Set([ 1, 2, 3 ]);
+    s.forEach(function (v) {
+        if (v < 10) {
+            s.add(v + 10);
+        }
+        s.delete(v);
+    });
+    arr = [];
+    s.forEach(function (v) {
+        arr.push(v);
+    });
+    print(arr.join());
+
+    s.forEach(function (v) {
+        s.delete(v);
+    });
+    print(s.size);
+
+    // An error thrown by the callback leaves the collection usable.
+    m = new Map([ [ 1, 1 ], [ 2, 2 ], [ 3, 3 ] ]);
+    try {
+        m.forEach(function (v, k) {
+            m.delete(k);
+            if (k === 2) {
+                throw new Error('boom');
+            }
+        });
+    } catch (e) {
+        print(e.message);
+    }
+    for (i = 0; i < 100; i++) {
+        m.set('tmp' + i, i);
+        m.delete('tmp' + i);
+    }
+    m.set(4, 4);
+    print(m.size, m.get(3));
+
+    n = 0;
+    m.forEach(function (v, k) {
+        n++;
+        if (k === 4) {
+            m.clear();
+            m.set('y', 1);
+        }
+    });
+    arr = [];
+    m.forEach(function (v, k) {
+        arr.push(k);
+    });
+    print(n, arr.join());
+
+    // Growing the table during the loop.
+    m = new Map([ [ 0, 0 ] ]);
+    n = 0;
+    m.forEach(function (v, k) {
+        n++;
+        if (k < 999) {
+            m.set(k + 1, k + 1);
+        }
+    });
+    print('visited', n);
+}
+
+test();
@@ -0,0 +1,47 @@
+/*
+ *  Set basic behavior and construction from array-likes and collections.
+ */
+
+/*===
+3 true false
+4
+a,b,c,[object Object]
+3 3
+[1,"a"]
+[2,"b"]
+[3,"c"]
+1,2,3
+[object Set] 0 1
+===*/
+
+function test() {
+    var s, m, arr;
+
+    s = new Set('abca');
+    print(s.size, s.has('a'), s.has('d'));
+    print(s.add({}) === s ? s.size : 'wrong retval');
+    arr = [];
+    s.forEach(function (v, k, set) {
+        if (v !== k || set !== s) {
+            throw new Error('unexpected callback args');
+        }
+        arr.push(String(v));
+    });
+    print(arr.join());
+
+    m = new Map([ [ 1, 'a' ], [ 2, 'b' ], [ 3, 'c' ] ]);
+    s = new Set(m);
+    print(new Map(m).size, s.size);
+    s.forEach(function (v) {
+        print(JSON.stringify(v));
+    });
+    arr = [];
+    new Set(new Set([ 1, 2, 2, 3, 1 ])).forEach(function (v) {
+        arr.push(v);
+    });
+    print(arr.join());
+
+    print(Object.prototype.toString.call(s), Set.length, Set.prototype.add.length);
+}
+
+test();
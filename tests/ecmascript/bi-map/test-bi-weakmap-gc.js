@@ -0,0 +1,105 @@
+/*
+ *  WeakMap and WeakSet entries are released by mark-and-sweep when the key
+ *  becomes unreachable, and values are kept alive only through reachable
+ *  keys (ephemeron semantics).
+ */
+
+/*===
+TypeError
+TypeError
+false undefined false
+finalized 1
+a b c
+value finalized 1
+100 49500
+[object WeakMap] [object WeakSet]
+deep
+===*/
+
+function test() {
+    var wm = new WeakMap();
+    var ws = new WeakSet();
+    var k1 = {};
+    var keys = [];
+    var fin = 0;
+    var valueFin = 0;
+    var a, b, i, sum, outer, ok, rec;
+
+    try {
+        wm.set(1, 2);
+    } catch (e) {
+        print(e.name);
+    }
+    try {
+        ws.add('foo');
+    } catch (e) {
+        print(e.name);
+    }
+    print(wm.has(1), wm.get('x'), ws.delete(null));
+
+    // Key only reachable through the collections is finalized.
+    (function () {
+        var tmp = {};
+        Duktape.fin(tmp, function () { fin++; });
+        wm.set(tmp, 'tmp');
+        ws.add(tmp);
+    })();
+    Duktape.gc();
+    Duktape.gc();
+    print('finalized', fin);
+
+    // Values reachable through a chain of weak entries.
+    (function () {
+        var a = { name: 'a' };
+        var b = { name: 'b' };
+        wm.set(k1, a);
+        wm.set(a, b);
+        wm.set(b, { name: 'c' });
+    })();
+    Duktape.gc();
+    a = wm.get(k1);
+    b = wm.get(a);
+    print(a.name, b.name, wm.get(b).name);
+
+    // Value is released with its key, also when it references the key.
+    (function () {
+        var x = {};
+        var y = { ref: x };
+        Duktape.fin(y, function () { valueFin++; });
+        wm.set(x, y);
+    })();
+    Duktape.gc();
+    Duktape.gc();
+    print('value finalized', valueFin);
+
+    for (i = 0; i < 1000; i++) {
+        a = {};
+        wm.set(a, { i: i });
+        if (i % 10 === 0) {
+            keys.push(a);
+        }
+    }
+    Duktape.gc();
+    sum = 0;
+    for (i = 0; i < keys.length; i++) {
+        sum += wm.get(keys[i]).i;
+    }
+    print(keys.length, sum);
+
+    print(Object.prototype.toString.call(wm), Object.prototype.toString.call(ws));
+
+    // WeakMap held as a value of another WeakMap.
+    outer = new WeakMap();
+    ok = {};
+    (function () {
+        var inner = new WeakMap();
+        var ik = {};
+        inner.set(ik, 'deep');
+        outer.set(ok, { inner: inner, ik: ik });
+    })();
+    Duktape.gc();
+    rec = outer.get(ok);
+    print(rec.inner.get(rec.ik));
+}
+
+test();
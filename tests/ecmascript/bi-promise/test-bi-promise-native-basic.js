@@ -0,0 +1,97 @@
+/*
+ *  Native Promise combinators and resolving functions.
+ */
+
+/*---
+duktape_config:
+  DUK_USE_PROMISE_BUILTIN: true
+---*/
+
+/*===
+function 1 function 1
+true false
+bar foo [object Promise]
+TypeError
+TypeError
+sync done
+resolved: first
+self resolution: TypeError
+executor: ok
+non-callable then: true
+throwing getter: getter
+reject with Promise: true
+all empty: true 0
+all reject: RangeError
+race: r1
+all: 1,2,3,4
+race reject: custom
+===*/
+
+function test() {
+    var resolveFn, rejectFn;
+    var P, Q;
+
+    // Resolving functions: anonymous, length 1, first call wins.
+    P = new Promise(function (resolve, reject) {
+        resolveFn = resolve;
+        rejectFn = reject;
+    });
+    print(typeof resolveFn, resolveFn.length, typeof rejectFn, rejectFn.length);
+    resolveFn('first');
+    rejectFn('second');
+    resolveFn('third');
+    P.then(function (v) { print('resolved:', v); });
+
+    // Self resolution rejects with a TypeError.
+    Q = new Promise(function (resolve) { resolveFn = resolve; });
+    resolveFn(Q);
+    Q.catch(function (e) { print('self resolution:', e.name); });
+
+    // Executor throw after resolve is ignored.
+    new Promise(function (resolve) {
+        resolve('ok');
+        throw new Error('ignored');
+    }).then(function (v) { print('executor:', v); });
+
+    // Thenable detection: non-callable 'then' and throwing getter.
+    var nonCallable = { then: 123 };
+    Promise.resolve(nonCallable).then(function (v) { print('non-callable then:', v === nonCallable); });
+    var throwing = {};
+    Object.defineProperty(throwing, 'then', { get: function () { throw 'getter'; } });
+    Promise.resolve(throwing).catch(function (e) { print('throwing getter:', e); });
+
+    // Promise.resolve() returns Promises as is.
+    var R = Promise.resolve(1);
+    Q = Promise.reject(R);
+    Q.catch(function (e) { print('reject with Promise:', e === R); });
+    print(Promise.resolve(R) === R, Q === R);
+
+    Promise.all([ 1, Promise.resolve(2), { then: function (f) { f(3); } }, new Promise(function (f) { f(4); }) ]).then(function (v) {
+        print('all:', v.join(','));
+    });
+    Promise.all([]).then(function (v) { print('all empty:', Array.isArray(v), v.length); });
+    Promise.all([ 1, Promise.reject(new RangeError('aiee')), 3 ]).catch(function (e) { print('all reject:', e.name); });
+    Promise.race([ new Promise(function () {}), Promise.resolve('r1'), 'r2' ]).then(function (v) { print('race:', v); });
+    Promise.race([ { then: function (f, r) { r('custom'); } } ]).catch(function (e) { print('race reject:', e); });
+    Promise.race([]).then(function () { print('never here'); });
+
+    // Promise instances are otherwise ordinary objects.
+    P = Promise.resolve('value');
+    P.foo = 'bar';
+    print(P.foo, Object.keys(P).join(','), Object.prototype.toString.call(P));
+
+    try {
+        Promise.prototype.then.call({}, function () {});
+    } catch (e) {
+        print(e.name);
+    }
+    try {
+        new Promise(123);
+    } catch (e) {
+        print(e.name);
+    }
+
+    print('sync done');
+}
+
+test();
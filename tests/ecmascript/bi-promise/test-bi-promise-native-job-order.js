@@ -0,0 +1,65 @@
+/*
+ *  Native Promise job ordering: reactions run in registration order, one
+ *  job per reaction, and thenables (including Promises returned from
+ *  handlers) are adopted through a separate job.
+ */
+
+/*---
+duktape_config:
+  DUK_USE_PROMISE_BUILTIN: true
+---*/
+
+/*===
+sync done
+A1
+B1
+A2
+B2
+thenable then called
+B3
+A3 thenable
+B4
+B5
+B6
+A4 nested
+B7
+===*/
+
+function test() {
+    Promise.resolve().then(function () {
+        print('A1');
+    }).then(function () {
+        print('A2');
+        return {
+            then: function (resolve) {
+                print('thenable then called');
+                resolve('thenable');
+            }
+        };
+    }).then(function (v) {
+        print('A3', v);
+        return Promise.resolve('nested');
+    }).then(function (v) {
+        print('A4', v);
+    });
+
+    Promise.resolve().then(function () {
+        print('B1');
+    }).then(function () {
+        print('B2');
+    }).then(function () {
+        print('B3');
+    }).then(function () {
+        print('B4');
+    }).then(function () {
+        print('B5');
+    }).then(function () {
+        print('B6');
+    }).then(function () {
+        print('B7');
+    });
+
+    print('sync done');
+}
+
+test();
@@ -0,0 +1,101 @@
+/*
+ *  Generational GC: minor collections run on voluntary GC and must only
+ *  free unreachable nursery objects, keeping nursery objects referenced
+ *  from old objects, value stacks, and objects with pending finalizers.
+ */
+
+/*---
+duktape_config:
+  DUK_USE_GENERATIONAL_GC: true
+custom: true
+---*/
+
+/*===
+old references ok 200 19900000
+closures ok 49995000
+finalized 20
+weak ok 2
+done
+===*/
+
+var old = { list: [] };
+var finCount = 0;
+
+function churn(n) {
+    var i, a, b;
+
+    // Young reference cycles, only collectable by mark-and-sweep.
+    for (i = 0; i < n; i++) {
+        a = { i: i };
+        b = { a: a, arr: [ a ] };
+        a.b = b;
+    }
+}
+
+function testOldReferences() {
+    var i, a, sum = 0;
+
+    Duktape.gc();  // Promote 'old'.
+    for (i = 0; i < 200000; i++) {
+        a = { i: i };
+        a.self = { back: a };
+        if (i % 1000 === 0) {
+            // Old object referencing a young cycle.
+            old.list.push(a.self);
+        }
+    }
+    churn(100000);
+    for (i = 0; i < old.list.length; i++) {
+        sum += old.list[i].back.self.back.i;
+    }
+    print('old references ok', old.list.length, sum);
+}
+
+function testClosures() {
+    var fns = [];
+    var i, sum = 0;
+
+    for (i = 0; i < 10000; i++) {
+        fns.push((function (v) {
+            var self = function () { return v + (self ? 0 : 1); };
+            return self;
+        })(i));
+        churn(10);
+    }
+    for (i = 0; i < fns.length; i++) {
+        sum += fns[i]();
+    }
+    print('closures ok', sum);
+}
+
+function testFinalizers() {
+    var i, o;
+
+    for (i = 0; i < 20; i++) {
+        o = { self: null };
+        o.self = o;
+        Duktape.fin(o, function () { finCount++; });
+        o = null;
+        churn(20000);
+    }
+    // Minor collections keep finalizable cycles for a full collection.
+    Duktape.gc();
+    Duktape.gc();
+    print('finalized', finCount);
+}
+
+function testWeak() {
+    var wm = new WeakMap();
+    var k1 = {}, k2 = {};
+
+    wm.set(k1, { k: k1 });
+    wm.set(k2, { k: k2 });
+    churn(100000);
+    print('weak ok', (wm.get(k1).k === k1 ? 1 : 0) + (wm.get(k2).k === k2 ? 1 : 0));
+}
+
+testOldReferences();
+testClosures();
+testFinalizers();
+testWeak();
+print('done');
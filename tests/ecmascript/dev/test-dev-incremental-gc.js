@@ -0,0 +1,127 @@
+/*
+ *  Incremental GC: voluntary collections run in steps interleaved with
+ *  execution, so objects are created and references moved around while
+ *  marking is in progress.  Reachable objects must never be freed, and
+ *  garbage (including cycles, finalizable objects and weak collection
+ *  entries) must eventually be collected.
+ */
+
+/*---
+duktape_config:
+  DUK_USE_INCREMENTAL_GC: true
+custom: true
+---*/
+
+/*===
+moved references ok 200 20095000
+closures ok 49995000
+finalized 20
+weak ok 2
+weak values finalized 1000
+done
+===*/
+
+var holder = { list: [] };
+var finCount = 0;
+
+function churn(n) {
+    var i, a, b;
+
+    // Reference cycles, only collectable by mark-and-sweep.
+    for (i = 0; i < n; i++) {
+        a = { i: i };
+        b = { a: a, arr: [ a ] };
+        a.b = b;
+    }
+}
+
+function testMovedReferences() {
+    var i, a, tmp = [], sum = 0;
+
+    for (i = 0; i < 200000; i++) {
+        a = { i: i };
+        a.self = { back: a };
+        tmp.push(a.self);
+        if (tmp.length === 50) {
+            // Move a reference from a new object into an object which
+            // has probably been marked already, and drop the only other
+            // reference.
+            if (i % 1000 === 999) {
+                holder.list.push(tmp[25]);
+            }
+            tmp = [];
+        }
+    }
+    churn(100000);
+    for (i = 0; i < holder.list.length; i++) {
+        sum += holder.list[i].back.self.back.i;
+    }
+    print('moved references ok', holder.list.length, sum);
+}
+
+function testClosures() {
+    var fns = [];
+    var i, sum = 0;
+
+    for (i = 0; i < 10000; i++) {
+        fns.push((function (v) {
+            var self = function () { return v + (self ? 0 : 1); };
+            return self;
+        })(i));
+        churn(10);
+    }
+    for (i = 0; i < fns.length; i++) {
+        sum += fns[i]();
+    }
+    print('closures ok', sum);
+}
+
+function testFinalizers() {
+    var i, o;
+
+    for (i = 0; i < 20; i++) {
+        o = { self: null };
+        o.self = o;
+        Duktape.fin(o, function () { finCount++; });
+        o = null;
+        churn(20000);
+    }
+    Duktape.gc();
+    Duktape.gc();
+    print('finalized', finCount);
+}
+
+function testWeak() {
+    var wm = new WeakMap();
+    var ws = new WeakSet();
+    var k1 = {}, k2 = {};
+    var i, k;
+    var valueFinCount = 0;
+
+    wm.set(k1, { k: k1 });
+    wm.set(k2, { k: k2 });
+    churn(100000);
+    print('weak ok', (wm.get(k1).k === k1 ? 1 : 0) + (wm.get(k2).k === k2 ? 1 : 0));
+
+    // Entries whose key is only referenced by its own value.
+    function valueFin() { valueFinCount++; }
+    for (i = 0; i < 1000; i++) {
+        k = { i: i };
+        wm.set(k, Duktape.fin({ k: k }, valueFin));
+        ws.add(k);
+        if (i % 10 === 0) {
+            churn(1000);
+        }
+    }
+    k = null;
+    churn(100000);
+    Duktape.gc();
+    Duktape.gc();
+    print('weak values finalized', valueFinCount);
+}
+
+testMovedReferences();
+testClosures();
+testFinalizers();
+testWeak();
+print('done');
@@ -0,0 +1,183 @@
+/*
+ *  Comparisons used directly as conditions are compiled into fused
+ *  compare-and-skip opcodes.  Results, coercion order, and side effects
+ *  must match the plain comparison operators.
+ */
+
+/*===
+values
+1 2 TTFFFTFT TTFFFTFT
+2 1 FFTTFTFT FFTTFTFT
+1 1 FTFTTFTF FTFTTFTF
+NaN 1 FFFFFTFT FFFFFTFT
+1 NaN FFFFFTFT FFFFFTFT
+NaN NaN FFFFFTFT FFFFFTFT
+0 0 FTFTTFTF FTFTTFTF
+Infinity -Infinity FFTTFTFT FFTTFTFT
+1 1 FTFTTFFT FTFTTFFT
+a b TTFFFTFT TTFFFTFT
+b a FFTTFTFT FFTTFTFT
+null undefined FFFFTFFT FFFFTFFT
+null 0 FTFTFTFT FTFTFTFT
+true 1 FTFTTFFT FTFTTFFT
+[object Object] [object Object] FTFTFTFT FTFTFTFT
+statements
+if lt
+if-else ge
+while 10
+do-while 6
+for 45
+for-empty 3
+for-no-cond 5
+ternary yes no
+switch two
+switch fallthrough default
+coercion
+valueOf left
+valueOf right
+lt false
+valueOf left
+valueOf right
+gt false
+valueOf left
+valueOf right
+le true
+valueOf left
+valueOf right
+ge true
+valueOf left
+valueOf right
+eq true
+symbol TypeError
+shuffle
+regs 1 1 1 1
+consts 1 0
+===*/
+
+function cmpCond(a, b) {
+    var r = '';
+    if (a < b) { r += 'T'; } else { r += 'F'; }
+    if (a <= b) { r += 'T'; } else { r += 'F'; }
+    if (a > b) { r += 'T'; } else { r += 'F'; }
+    if (a >= b) { r += 'T'; } else { r += 'F'; }
+    if (a == b) { r += 'T'; } else { r += 'F'; }
+    if (a != b) { r += 'T'; } else { r += 'F'; }
+    if (a === b) { r += 'T'; } else { r += 'F'; }
+    if (a !== b) { r += 'T'; } else { r += 'F'; }
+    return r;
+}
+
+function cmpValue(a, b) {
+    var r = '';
+    var res = [ a < b, a <= b, a > b, a >= b, a == b, a != b, a === b, a !== b ];
+    res.forEach(function (v) { r += (v ? 'T' : 'F'); });
+    return r;
+}
+
+function valuesTest() {
+    var obj = {};
+    var pairs = [
+        [ 1, 2 ], [ 2, 1 ], [ 1, 1 ], [ NaN, 1 ], [ 1, NaN ], [ NaN, NaN ],
+        [ 0, -0 ], [ 1 / 0, -1 / 0 ], [ 1, '1' ], [ 'a', 'b' ], [ 'b', 'a' ],
+        [ null, undefined ], [ null, 0 ], [ true, 1 ], [ obj, {} ]
+    ];
+
+    pairs.forEach(function (p) {
+        print(String(p[0]), String(p[1]), cmpCond(p[0], p[1]), cmpValue(p[0], p[1]));
+    });
+}
+
+function statementsTest() {
+    var i, n, x;
+
+    x = 1;
+    if (x < 2) { print('if lt'); }
+    if (x < 0) { print('never'); } else { print('if-else ge'); }
+
+    i = 0;
+    while (i < 10) { i++; }
+    print('while', i);
+
+    i = 10;
+    do { i -= 2; } while (i >= 7);
+    print('do-while', i);
+
+    n = 0;
+    for (i = 0; i < 10; i++) { n += i; }
+    print('for', n);
+
+    for (i = 0; ; i++) { if (i === 3) { break; } }
+    print('for-empty', i);
+
+    for (i = 0; ; ) { if (++i > 4) { break; } }
+    print('for-no-cond', i);
+
+    print('ternary', x <= 1 ? 'yes' : 'no', x !== 1 ? 'yes' : 'no');
+
+    switch (x + 1) {
+    case 1: print('switch one'); break;
+    case 2: print('switch two'); break;
+    default: print('switch default');
+    }
+    switch ('2') {
+    case 2: print('switch number');
+    default: print('switch fallthrough default');
+    }
+}
+
+function coercionTest() {
+    var left = { valueOf: function () { print('valueOf left'); return 1; } };
+    var right = { valueOf: function () { print('valueOf right'); return 1; } };
+
+    if (left < right) { print('lt true'); } else { print('lt false'); }
+    if (left > right) { print('gt true'); } else { print('gt false'); }
+    if (left <= right) { print('le true'); } else { print('le false'); }
+    if (left >= right) { print('ge true'); } else { print('ge false'); }
+    if (left == 1 && 1 == right) { print('eq true'); } else { print('eq false'); }
+
+    try {
+        if (Symbol() < 1) { print('never'); }
+    } catch (e) {
+        print('symbol', e.name);
+    }
+}
+
+function shuffleTest() {
+    // Enough registers and constants to force shuffling of the fused
+    // opcode's B and C arguments.
+    var src = [];
+    var i;
+
+    src.push('(function () {');
+    for (i = 0; i < 300; i++) {
+        src.push('var v' + i + ' = ' + i + ';');
+    }
+    src.push('var r = [];');
+    src.push('if (v298 < v299) { r.push(1); } else { r.push(0); }');
+    src.push('if (v299 >= v1) { r.push(1); } else { r.push(0); }');
+    src.push('var n = 0; while (v290 < v299 - n) { n++; } r.push(n === 9 ? 1 : 0);');
+    src.push('r.push(v299 === 299 ? 1 : 0);');
+    src.push('return "regs " + r.join(" ");');
+    src.push('})()');
+    print(eval(src.join('\n')));
+
+    src = [];
+    src.push('(function (x) {');
+    src.push('var k = [');
+    for (i = 0; i < 300; i++) {
+        src.push('"str' + i + '",');
+    }
+    src.push('];');
+    src.push('return "consts " + (x === "str299" ? 1 : 0) + " " + (x !== "str299" ? 1 : 0);');
+    src.push('})("str299")');
+    print(eval(src.join('\n')));
+}
+
+print('values');
+valuesTest();
+print('statements');
+statementsTest();
+print('coercion');
+coercionTest();
+print('shuffle');
+shuffleTest();
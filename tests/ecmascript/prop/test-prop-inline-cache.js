@@ -0,0 +1,175 @@
+/*
+ *  Property accesses with a constant key are cached per instruction by
+ *  the executor.  Cached slots must be revalidated when objects change
+ *  shape (property added, deleted, redefined as accessor, prototype
+ *  changed, object frozen) so that results are always the same as for
+ *  an uncached lookup.
+ */
+
+/*===
+own and inherited
+1 2 3
+10 20 30
+100 200 300
+delete and re-add
+1 undefined
+1 5
+accessor redefine
+1 getter
+prototype change
+proto-a proto-b
+shadowing
+proto shadow shadow
+put
+0 1 2
+frozen
+1 1
+TypeError
+setter
+set:9
+array and string object
+3 3 xyz
+3 3 xyz
+polymorphic sum 5777
+===*/
+
+function readAll(objs) {
+    var res = [];
+    var i;
+    for (i = 0; i < objs.length; i++) {
+        res.push(objs[i].x);
+    }
+    return res.join(' ');
+}
+
+function readX(o) {
+    return o.x;
+}
+
+function writeX(o, v) {
+    o.x = v;
+}
+
+function strictWriteX(o, v) {
+    'use strict';
+    o.x = v;
+}
+
+function test() {
+    var i, o, p, q, res, arr, s, sum;
+
+    print('own and inherited');
+    for (i = 0; i < 3; i++) {
+        // Same instruction, own property in different slots and inherited.
+        o = { x: 1 };
+        p = { a: 0, b: 0, x: 2 };
+        q = Object.create(Object.create({ x: 3 }));
+        print(readAll([ o, p, q ]).split(' ').map(function (v) { return v * Math.pow(10, i); }).join(' '));
+    }
+
+    print('delete and re-add');
+    o = { a: 1, x: 1 };
+    res = [];
+    for (i = 0; i < 3; i++) {
+        if (i === 1) {
+            delete o.x;
+        }
+        if (i === 2) {
+            o.x = 5;
+        }
+        res.push(readX(o));
+    }
+    print(res[0], res[1]);
+    print(res[0], res[2]);
+
+    print('accessor redefine');
+    o = { x: 1 };
+    res = [];
+    for (i = 0; i < 2; i++) {
+        res.push(readX(o));
+        Object.defineProperty(o, 'x', { get: function () { return 'getter'; } });
+    }
+    print(res.join(' '));
+
+    print('prototype change');
+    p = Object.create({ x: 'proto-a' });
+    res = [];
+    for (i = 0; i < 2; i++) {
+        res.push(readX(p));
+        Object.setPrototypeOf(p, { x: 'proto-b' });
+    }
+    print(res.join(' '));
+
+    print('shadowing');
+    q = { x: 'proto' };
+    p = Object.create(q);
+    o = Object.create(p);
+    res = [];
+    for (i = 0; i < 3; i++) {
+        res.push(readX(o));
+        if (i === 0) {
+            p.x = 'shadow';
+        }
+    }
+    print(res.join(' '));
+
+    print('put');
+    o = { x: 0 };
+    res = [];
+    for (i = 0; i < 3; i++) {
+        writeX(o, i);
+        res.push(o.x);
+    }
+    print(res.join(' '));
+
+    print('frozen');
+    o = { x: 1 };
+    for (i = 0; i < 3; i++) {
+        writeX(o, 1);
+        if (i === 1) {
+            Object.freeze(o);
+        }
+    }
+    writeX(o, 2);
+    print(o.x, readX(o));
+    try {
+        strictWriteX(o, 3);
+        print('never here');
+    } catch (e) {
+        print(e.name);
+    }
+
+    print('setter');
+    res = [];
+    o = { x: 1 };
+    for (i = 0; i < 3; i++) {
+        writeX(o, i);
+    }
+    Object.defineProperty(o, 'x', { set: function (v) { res.push('set:' + v); } });
+    writeX(o, 9);
+    print(res.join(' '));
+
+    print('array and string object');
+    arr = [ 1, 2, 3 ];
+    arr.x = 'xyz';
+    s = new String('abc');
+    s.x = 'xyz';
+    for (i = 0; i < 2; i++) {
+        print(arr.length, s.length, readX(i === 0 ? arr : s));
+    }
+
+    sum = 0;
+    res = [ { x: 1 }, { y: 0, x: 10 }, Object.create({ x: 100 }), { z: 0, y: 0, x: 1000 }, [] ];
+    for (i = 0; i < 5; i++) {
+        res.forEach(function (v) {
+            var t = readX(v);
+            sum += (typeof t === 'number' ? t : 0);
+        });
+        if (i === 2) {
+            res[4].x = 111;
+        }
+    }
+    print('polymorphic sum', sum);
+}
+
+test();
@@ -0,0 +1,145 @@
+/*
+ *  Objects sharing a property layout (shape) must behave like objects with
+ *  private property tables: adding, deleting, and redefining properties on
+ *  one object must not affect other objects with the same layout.
+ */
+
+/*---
+duktape_config:
+  DUK_USE_HOBJECT_SHAPES: true
+---*/
+
+/*===
+shared layout
+1 2 3
+10 20 30
+a,b,c a,b,c
+delete last
+a,b 10 20 undefined
+a,b,c 1 2 3
+a,b,x 10 20 99
+delete middle
+a,c 1 undefined 3
+a,b,c 10 20 30
+attribute change
+false true
+true true
+a,b,c a,b,c
+7 20
+freeze and seal
+true false
+TypeError
+5 10
+accessor
+getter 2
+a,b,c 10 20 30
+many properties
+40 0 39 780
+40 0 39 780
+p35,p36,p37,p38,p39
+p38,p39
+json
+{"id":1,"name":"foo"} {"id":2,"name":"bar"}
+{"id":1,"name":"FOO","extra":true} {"id":2,"name":"bar"}
+constructor
+x,y 0 1 x,y 2 3
+===*/
+
+function Point(x, y) {
+    this.x = x;
+    this.y = y;
+}
+
+function make(a, b, c) {
+    return { a: a, b: b, c: c };
+}
+
+function test() {
+    var o1, o2, o3, i, sum, arr, t;
+
+    print('shared layout');
+    o1 = make(1, 2, 3);
+    o2 = make(10, 20, 30);
+    print(o1.a, o1.b, o1.c);
+    print(o2.a, o2.b, o2.c);
+    print(Object.keys(o1).join(), Object.keys(o2).join());
+
+    print('delete last');
+    o1 = make(1, 2, 3);
+    o2 = make(10, 20, 30);
+    delete o2.c;
+    print(Object.keys(o2).join(), o2.a, o2.b, o2.c);
+    print(Object.keys(o1).join(), o1.a, o1.b, o1.c);
+    o2.x = 99;
+    print(Object.keys(o2).join(), o2.a, o2.b, o2.x);
+
+    print('delete middle');
+    o1 = make(1, 2, 3);
+    o2 = make(10, 20, 30);
+    delete o1.b;
+    print(Object.keys(o1).join(), o1.a, o1.b, o1.c);
+    print(Object.keys(o2).join(), o2.a, o2.b, o2.c);
+
+    print('attribute change');
+    o1 = make(1, 2, 3);
+    o2 = make(10, 20, 30);
+    Object.defineProperty(o1, 'a', { writable: false });
+    print(Object.getOwnPropertyDescriptor(o1, 'a').writable, Object.getOwnPropertyDescriptor(o2, 'a').writable);
+    Object.defineProperty(o2, 'a', { value: 7 });  // value only, attributes unchanged
+    print(Object.getOwnPropertyDescriptor(o2, 'a').writable, Object.getOwnPropertyDescriptor(o2, 'a').enumerable);
+    print(Object.keys(o1).join(), Object.keys(o2).join());
+    print(o2.a, o2.b);
+
+    print('freeze and seal');
+    o1 = new Point(1, 2);
+    o2 = new Point(5, 10);
+    Object.freeze(o1);
+    print(Object.isFrozen(o1), Object.isFrozen(o2));
+    try {
+        (function () { 'use strict'; o1.x = 100; })();
+    } catch (e) {
+        print(e.name);
+    }
+    print(o2.x, o2.y);
+
+    print('accessor');
+    o1 = make(1, 2, 3);
+    o2 = make(10, 20, 30);
+    Object.defineProperty(o1, 'a', { get: function () { return 'getter'; } });
+    print(o1.a, o1.b);
+    print(Object.keys(o2).join(), o2.a, o2.b, o2.c);
+
+    print('many properties');
+    for (t = 0; t < 2; t++) {
+        o1 = {};
+        for (i = 0; i < 40; i++) {
+            o1['p' + i] = i;
+        }
+        sum = 0;
+        arr = Object.keys(o1);
+        for (i = 0; i < arr.length; i++) {
+            sum += o1[arr[i]];
+        }
+        print(arr.length, o1.p0, o1.p39, sum);
+    }
+    print(arr.slice(35).join());
+    for (i = 0; i < 38; i++) {
+        delete o1['p' + i];
+    }
+    print(Object.keys(o1).join());
+
+    print('json');
+    arr = JSON.parse('[{"id":1,"name":"foo"},{"id":2,"name":"bar"}]');
+    print(JSON.stringify(arr[0]), JSON.stringify(arr[1]));
+    arr[0].name = 'FOO';
+    arr[0].extra = true;
+    print(JSON.stringify(arr[0]), JSON.stringify(arr[1]));
+
+    print('constructor');
+    o1 = new Point(0, 1);
+    o2 = new Point(2, 3);
+    o3 = new Point(0, 1);
+    print(Object.keys(o1).join(), o1.x, o1.y, Object.keys(o3).join(), o2.x, o2.y);
+}
+
+test();
@@ -0,0 +1,84 @@
+/*
+ *  Compiled RegExp bytecode is cached and shared between RegExp instances
+ *  created from the same pattern and flags.  Instances must still be fully
+ *  independent and match results unaffected.
+ */
+
+/*===
+distinct false
+lastIndex 3 0
+match 1 3 null
+flags true false
+source a\/b a\/b
+source-empty (?:) (?:)
+syntaxerror SyntaxError
+syntaxerror SyntaxError
+evict 40 true
+evict-again 40 true
+string match ["b12"]
+string search 3
+string split a,b,c
+literal true
+gc 200 true
+===*/
+
+function test() {
+    var r1, r2, i, j, re, res, ok;
+
+    r1 = new RegExp('ab', 'g');
+    r2 = new RegExp('ab', 'g');
+    print('distinct', r1 === r2);
+    r1.exec('xab');
+    print('lastIndex', r1.lastIndex, r2.lastIndex);
+    print('match', r2.exec('xab').index, r2.lastIndex, r2.exec('xab'));
+
+    print('flags', new RegExp('a', 'i').test('A'), new RegExp('a', '').test('A'));
+    print('source', new RegExp('a/b').source, new RegExp('a/b').source);
+    print('source-empty', new RegExp('').source, new RegExp('').source);
+
+    for (i = 0; i < 2; i++) {
+        try {
+            new RegExp('(', '');
+            print('never here');
+        } catch (e) {
+            print('syntaxerror', e.name);
+        }
+    }
+
+    // More distinct patterns than there are cache entries.
+    for (j = 0; j < 2; j++) {
+        ok = true;
+        for (i = 0; i < 40; i++) {
+            re = new RegExp('x' + i + 'y', 'g');
+            res = re.exec('--x' + i + 'y--');
+            if (!res || res.index !== 2 || re.lastIndex !== 4 + String(i).length) {
+                ok = false;
+            }
+        }
+        print(j === 0 ? 'evict' : 'evict-again', i, ok);
+    }
+
+    print('string match', JSON.stringify('a1b12'.match('b\\d+')));
+    print('string search', 'abcd'.search('d'));
+    print('string split', 'a1b2c'.split(/\d/).join(','));
+
+    ok = true;
+    for (i = 0; i < 3; i++) {
+        ok = ok && eval('/q+/g').exec('aqq')[0] === 'qq';
+    }
+    print('literal', ok);
+
+    ok = true;
+    for (i = 0; i < 200; i++) {
+        re = new RegExp('(' + (i % 20) + ')+z');
+        if (re.exec('--' + (i % 20) + 'z')[1] !== String(i % 20)) {
+            ok = false;
+        }
+        if ((i % 50) === 0) {
+            Duktape.gc();
+        }
+    }
+    print('gc', i, ok);
+}
+
+test();
@@ -2,8 +2,12 @@
  *  RegExp executor step limit
  */
 
-/* Marked custom because limit is custom behavior. */
+/* Marked custom because limit is custom behavior.  The Pike VM fallback
+ * would otherwise take over when the limit is reached.
+ */
 /*---
+duktape_config:
+  DUK_USE_REGEXP_PIKEVM: false
 custom: true
 ---*/
 
@@ -0,0 +1,75 @@
+/*
+ *  Patterns without backreferences or lookaheads fall back to a linear
+ *  time Pike VM when backtracking exceeds its step budget.  Results,
+ *  including captures and quantifier preferences, must be unchanged.
+ */
+
+/*---
+duktape_config:
+  DUK_USE_REGEXP_PIKEVM: true
+custom: true
+---*/
+
+/*===
+alt-star null
+nested-plus null
+nested-star null
+dotstar-nomatch null
+nested-plus-match ["aaaaaaaaaaaaaaaaaaaaaaaaaaaaaab","aaaaaaaaaaaaaaaaaaaaaaaaaaaaaa"] 0
+alt-star-match 2001 a
+lazy ["xxxxy","xxxx"]
+greedy ["xxxxy","xxxx",""]
+counted ["xyxxyxyz","x"]
+captures ["foo=bar;","foo","bar",null]
+multiline 0 end
+backref-limit RangeError
+done
+===*/
+
+function rep(s, n) {
+    return new Array(n + 1).join(s);
+}
+
+function show(name, re, input) {
+    var m;
+    try {
+        m = re.exec(input);
+        print(name, JSON.stringify(m));
+    } catch (e) {
+        print(name, e.name);
+    }
+}
+
+function test() {
+    var a30 = rep('a', 30);
+    var big = rep('some log line text ', 1000);
+    var m;
+
+    // Catastrophic backtracking cases.
+    show('alt-star', /(a|a)*b/, a30);
+    show('nested-plus', /(a+)+b/, a30);
+    show('nested-star', /(x+x+)+y/, rep('x', 40));
+    show('dotstar-nomatch', /.*error/, big);
+
+    m = /(a+)+b/.exec(rep('a', 30) + 'c' + rep('a', 30) + 'b');
+    print('nested-plus-match', JSON.stringify(m), m.index - 31);
+
+    m = /(a|a)*$/.exec(rep('a', 2000) + 'b' + rep('a', 2000));
+    print('alt-star-match', m.index, m[1]);
+
+    // Quantifier preferences after the fallback has kicked in: the input
+    // first triggers the step budget with a long failing prefix.
+    show('lazy', /((?:x|x)+?)y/, rep('x', 28) + 'q' + 'xxxxy');
+    show('greedy', /((?:x|x)+)(x*)y/, rep('x', 28) + 'q' + 'xxxxy');
+    show('counted', /(?:(x|x)+y){3}z/, rep('x', 28) + 'q' + 'xyxxyxyz');
+    show('captures', /(\w+)=(\w*)(?:;|(,))/, rep('k', 30) + '=' + rep('v', 30) + ' foo=bar;');
+
+    m = /(?:a|a)*^end$/m.exec(rep('a', 30) + '\nend');
+    print('multiline', m.index - 31, m[0]);
+
+    // Backreferences keep the backtracking engine and its limits.
+    show('backref-limit', /((?:a|b)*)\1c/, rep('ab', 10000));
+}
+
+test();
+print('done');
@@ -0,0 +1,74 @@
+/*
+ *  Match start scanning based on a literal prefix or a first character set
+ *  must not change match results, including for non-ASCII inputs where the
+ *  scan works on WTF-8 bytes but match offsets are in characters.
+ */
+
+/*===
+literal ["ERROR: disk","disk"] 5994
+literal-nomatch null
+long-prefix ["abcdef"] 1495
+long-prefix-nomatch null
+nonascii ["€uro"] 1350
+nonascii-prefix ["xyz"] 2701
+surrogate 56832 2 2
+firstset ["WARN"] 4000
+firstset-nonascii ["éa"] 2
+icase ["eRRor"] 2
+alt ["FATAL"] 4
+star ["aab"] 3
+empty-possible [""] 0
+assertion ["foo"] 5
+lookahead ["foo"] 2
+global 1:3 6:8 11:13
+split a,b,c
+replace _a_b_
+===*/
+
+function rep(s, n) {
+    return new Array(n + 1).join(s);
+}
+
+function show(name, re, input) {
+    var m = re.exec(input);
+    if (m) {
+        print(name, JSON.stringify(m), m.index);
+    } else {
+        print(name, 'null');
+    }
+}
+
+function test() {
+    var lines = rep('INFO some message\n', 333) + 'ERROR: disk full\n';
+    var s, re, m, res;
+
+    show('literal', /ERROR: (\w+)/, lines);
+    show('literal-nomatch', /ERROR: net/, lines);
+    show('long-prefix', /abcdef/, rep('abcde', 299) + 'abcdef');
+    show('long-prefix-nomatch', /abcdef/, rep('abcde', 300));
+    show('nonascii', /€uro/, rep('€ur', 450) + '€uro');
+    show('nonascii-prefix', /xyz/, rep('😀', 1350) + 'ä' + 'xyz');
+    m = /\ude00x/.exec('a😀x');
+    print('surrogate', m[0].charCodeAt(0), m[0].length, m.index);
+    show('firstset', /[EW](?:RROR|ARN)/, rep('info ', 800) + 'WARN');
+    show('firstset-nonascii', /[é-ü]a/, 'aaéa');
+    show('icase', /error/i, 'x eRRor');
+    show('alt', /ERROR|FATAL/, 'xxx FATAL');
+    show('star', /a*b/, 'cccaab');
+    show('empty-possible', /x*/, 'abc');
+    show('assertion', /\bfoo/, 'afoo foo');
+    show('lookahead', /(?=foo)foo/, 'fofoo');
+
+    re = /ab/g;
+    s = 'xab xxab xxab';
+    res = [];
+    while ((m = re.exec(s)) !== null) {
+        res.push(m.index + ':' + re.lastIndex);
+    }
+    print('global', res.join(' '));
+
+    print('split', 'a-b-c'.split(/-/).join(','));
+    print('replace', 'xaxbx'.replace(/x/g, '_'));
+}
+
+test();
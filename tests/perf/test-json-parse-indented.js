@@ -0,0 +1,28 @@
+/*
+ *  Test JSON.parse() on a pretty printed document with a mix of short keys,
+ *  medium length string values, and deep indentation.
+ */
+
+function test() {
+    var doc = [];
+    var i, j, obj, txt;
+
+    for (i = 0; i < 200; i++) {
+        obj = {
+            id: i,
+            name: 'item-' + i,
+            description: 'A medium length description text for item number ' + i + ', with some punctuation.',
+            tags: [ 'alpha', 'beta', 'gamma' ],
+            nested: { level1: { level2: { level3: { value: 'deep value ' + i, flag: (i & 1) === 0 } } } }
+        };
+        doc.push(obj);
+    }
+    txt = JSON.stringify(doc, null, 4);
+    print(txt.length);
+
+    for (j = 0; j < 1000; j++) {
+        void JSON.parse(txt);
+    }
+}
+
+test();
@@ -0,0 +1,20 @@
+/*
+ *  Unanchored RegExp match against a long input where the match is near
+ *  the end.  Literal prefix scanning avoids attempting a match at every
+ *  input offset.
+ */
+
+function test() {
+    var i;
+    var txt = new Array(20001).join('INFO 2017-01-01 some log message\n') + 'ERROR: disk full\n';
+    var re1 = /ERROR: (\w+)/;
+    var re2 = /[EF](?:RROR|ATAL)/;
+    var t;
+
+    for (i = 0; i < 100; i++) {
+        t = re1.exec(txt);
+        t = re2.exec(txt);
+    }
+}
+
+test();
@@ -81,6 +81,7 @@ rejected_plain_identifiers_list = [
     'memcpy',
     'memmove',
     'memcmp',
+    'memchr',
     'memset',
 
     # string functions
@@ -138,6 +139,7 @@ rejected_plain_identifiers_list = [
     'DUK_MEMCPY',
     'DUK_MEMMOVE',
     'DUK_MEMCMP',
+    'DUK_MEMCHR',
     'DUK_MEMSET',
     'DUK_MEMZERO'
 ]
@@ -309,7 +311,7 @@ def checkIdentifiers(lines, idx, filename):
         if rejected_plain_identifiers.has_key(m.group(0)):
             if m.group(0) in [ 'duk_context' ] and bn == 'duktape.h.in':
                 continue  # duk_context allowed in public API header
-            if m.group(0) in [ 'DUK_MEMCPY', 'DUK_MEMMOVE', 'DUK_MEMCMP', 'DUK_MEMSET', 'DUK_MEMZERO' ] and \
+            if m.group(0) in [ 'DUK_MEMCPY', 'DUK_MEMMOVE', 'DUK_MEMCMP', 'DUK_MEMCHR', 'DUK_MEMSET', 'DUK_MEMZERO' ] and \
                bn in [ 'duk_util_memory.c', 'duk_util.h' ]:
                 continue
             if not excludePlain: